@@ -143,6 +143,56 @@ typedef enum {
 
 typedef enum { RPG_IMAGE_FORMAT_PNG, RPG_IMAGE_FORMAT_JPG, RPG_IMAGE_FORMAT_BMP } RPG_IMAGE_FORMAT;
 
+typedef enum {
+    RPG_ANIMATION_ONCE,      /* Stops on the last frame */
+    RPG_ANIMATION_LOOP,      /* Restarts from the first frame after the last */
+    RPG_ANIMATION_PING_PONG  /* Reverses direction at the first and last frames */
+} RPG_ANIMATION_MODE;
+
+typedef enum {
+    RPG_DISTORTION_WAVE,   /* Shifts each row horizontally along a sine wave, which travels down the object */
+    RPG_DISTORTION_RIPPLE, /* Shifts each row vertically along a sine wave, stretching and compressing the object */
+    RPG_DISTORTION_SWAY    /* Swings the top of the object side to side while the bottom stays anchored, length is unused */
+} RPG_DISTORTION;
+
+typedef enum {
+    RPG_TILEMAP_MODE_INSTANCED, /* Each tile within the visible chunks is drawn as a quad, suited to sparse layers */
+    RPG_TILEMAP_MODE_INDEXED    /* The view is drawn as a single quad, looking up each tile from an index texture, suited to dense layers */
+} RPG_TILEMAP_MODE;
+
+typedef enum {
+    RPG_TWEEN_X,        /* The location on the x-axis, 1 component */
+    RPG_TWEEN_Y,        /* The location on the y-axis, 1 component */
+    RPG_TWEEN_LOCATION, /* The location on both axes, 2 components */
+    RPG_TWEEN_ALPHA,    /* The opacity, 1 component */
+    RPG_TWEEN_HUE,      /* The hue shift in degrees, 1 component */
+    RPG_TWEEN_SCALE,    /* The scale on both axes, 2 components */
+    RPG_TWEEN_ROTATION, /* The rotation in degrees, 1 component */
+    RPG_TWEEN_COLOR,    /* The blended color, 4 components */
+    RPG_TWEEN_TONE      /* The tone, 4 components */
+} RPG_TWEEN_PROPERTY;
+
+typedef enum {
+    RPG_EASING_LINEAR,
+    RPG_EASING_QUAD_IN,
+    RPG_EASING_QUAD_OUT,
+    RPG_EASING_QUAD_IN_OUT,
+    RPG_EASING_CUBIC_IN,
+    RPG_EASING_CUBIC_OUT,
+    RPG_EASING_CUBIC_IN_OUT,
+    RPG_EASING_SINE_IN,
+    RPG_EASING_SINE_OUT,
+    RPG_EASING_SINE_IN_OUT,
+    RPG_EASING_EXPO_IN,
+    RPG_EASING_EXPO_OUT,
+    RPG_EASING_EXPO_IN_OUT,
+    RPG_EASING_BACK_IN,
+    RPG_EASING_BACK_OUT,
+    RPG_EASING_BACK_IN_OUT,
+    RPG_EASING_ELASTIC_OUT,
+    RPG_EASING_BOUNCE_OUT
+} RPG_EASING;
+
 typedef enum {
     RPG_KEY_UNKNOWN       = -1,
     RPG_KEY_SPACE         = 32,
@@ -400,6 +450,16 @@ typedef struct RPGimage RPGimage;
 typedef struct RPGfont RPGfont;
 typedef struct RPGshader RPGshader;
 typedef struct RPGtilemap RPGtilemap;
+typedef struct RPGmaterial RPGmaterial;
+typedef struct RPGpostfx RPGpostfx;
+typedef struct RPGlightmap RPGlightmap;
+typedef struct RPGemitter RPGemitter;
+typedef struct RPGanimation RPGanimation;
+typedef struct RPGtween RPGtween;
+typedef struct RPGwindow RPGwindow;
+typedef struct RPGprimitives RPGprimitives;
+typedef struct RPGworld RPGworld;
+typedef struct RPGtileworld RPGtileworld;
 
 // Complete types
 
@@ -490,6 +550,14 @@ typedef struct {
     RPGint h; /** The dimension on the y-axis. */
 } RPGrect;
 
+/**
+ * @brief A pair of overlapping shapes found by a collision world.
+ */
+typedef struct {
+    RPGint a; /** The identifier of the first shape, always less than b. */
+    RPGint b; /** The identifier of the second shape. */
+} RPGcontact;
+
 // Function protoypes
 typedef void (*RPGupdatefunc)(RPGint64 time);
 typedef void (*RPGrenderfunc)(void *basic);
@@ -502,6 +570,7 @@ typedef void (*RPGfiledropfunc)(RPGgame *game, RPGint count, const char **files)
 typedef void (*RPGmovefunc)(RPGgame *game, RPGint x, RPGint y);
 typedef void (*RPGsizefunc)(RPGgame *game, RPGint width, RPGint height);
 typedef void (*RPGtransitionfunc)(RPGgame *game, RPGshader *shader);
+typedef void (*RPGtweenfunc)(RPGtween *tween, void *user);
 
 // Game
 RPG_RESULT RPG_Game_Create(const char *title, RPGint width, RPGint height, RPG_INIT_FLAGS flags, RPGgame **game);
@@ -550,6 +619,17 @@ RPG_RESULT RPG_Game_SetFileDropCallback(RPGgame *game, RPGfiledropfunc func);
 RPG_RESULT RPG_Game_SetMoveCallback(RPGgame *game, RPGmovefunc func);
 RPG_RESULT RPG_Game_SetResizeCallback(RPGgame *game, RPGsizefunc func);
 RPG_RESULT RPG_Game_Transition(RPGgame *game, RPGshader *shader, RPGint duration, RPGtransitionfunc func);
+RPG_RESULT RPG_Game_GetTone(RPGgame *game, RPGtone *tone);
+RPG_RESULT RPG_Game_SetTone(RPGgame *game, RPGtone *tone, RPGint duration);
+RPG_RESULT RPG_Game_Flash(RPGgame *game, RPGcolor *color, RPGint duration);
+RPG_RESULT RPG_Game_Shake(RPGgame *game, RPGfloat power, RPGfloat speed, RPGint duration);
+RPG_RESULT RPG_Game_GetBrightness(RPGgame *game, RPGfloat *brightness);
+RPG_RESULT RPG_Game_SetBrightness(RPGgame *game, RPGfloat brightness);
+RPG_RESULT RPG_Game_SetColorLookup(RPGgame *game, RPGimage *image, RPGfloat amount);
+RPG_RESULT RPG_Game_AddPostFX(RPGgame *game, RPGpostfx *fx);
+RPG_RESULT RPG_Game_RemovePostFX(RPGgame *game, RPGpostfx *fx);
+RPG_RESULT RPG_Game_PickPoint(RPGgame *game, RPGint x, RPGint y, RPGrenderable **result);
+RPG_RESULT RPG_Game_PickRect(RPGgame *game, RPGrect *rect, RPGrenderable **result);
 
 // Bitmap
 RPG_RESULT RPG_Bitmap_CreateFromFile(const char *filename, RPGbitmap **bitmap);
@@ -575,6 +655,7 @@ RPG_RESULT RPG_Image_Blit(RPGimage *dst, RPGrect *dstRect, RPGimage *src, RPGrec
 RPG_RESULT RPG_Image_GetPixel(RPGimage *image, RPGint x, RPGint y, RPGcolor *color);
 RPG_RESULT RPG_Image_SetPixel(RPGimage *image, RPGint x, RPGint y, RPGcolor *color);
 RPG_RESULT RPG_Image_GetPixels(RPGimage *image, void *buffer, RPGsize sizeBuffer);
+RPG_RESULT RPG_Image_UpdateMask(RPGimage *image);
 RPG_RESULT RPG_Image_Save(RPGimage *image, const char *filename, RPG_IMAGE_FORMAT format, RPGfloat quality);
 
 // Renderable
@@ -583,6 +664,8 @@ RPG_RESULT RPG_Renderable_SetZ(RPGrenderable *renderable, RPGint z);
 RPG_RESULT RPG_Renderable_GetVisible(RPGrenderable *renderable, RPGbool *visible);
 RPG_RESULT RPG_Renderable_SetVisible(RPGrenderable *renderable, RPGbool visible);
 RPG_RESULT RPG_Renderable_SetRenderFunc(RPGrenderable *renderable, RPGrenderfunc func);
+RPG_RESULT RPG_Renderable_GetMaterial(RPGrenderable *renderable, RPGmaterial **material);
+RPG_RESULT RPG_Renderable_SetMaterial(RPGrenderable *renderable, RPGmaterial *material);
 RPG_RESULT RPG_Renderable_Free(RPGrenderable *renderable);
 
 // BasicSprite (base for Sprite, Viewport, Plane)
@@ -607,6 +690,12 @@ RPG_RESULT RPG_BasicSprite_GetFlash(RPGbasic *basic, RPGcolor *color, RPGubyte *
 RPG_RESULT RPG_BasicSprite_SetFlash(RPGbasic *basic, RPGcolor *color, RPGubyte duration);
 RPG_RESULT RPG_BasicSprite_GetLocation(RPGbasic *basic, RPGint *x, RPGint *y);
 RPG_RESULT RPG_BasicSprite_SetLocation(RPGbasic *basic, RPGint x, RPGint y);
+RPG_RESULT RPG_BasicSprite_GetParent(RPGbasic *basic, RPGbasic **parent);
+RPG_RESULT RPG_BasicSprite_SetParent(RPGbasic *basic, RPGbasic *parent);
+RPG_RESULT RPG_BasicSprite_GetDistortion(RPGbasic *basic, RPG_DISTORTION type, RPGfloat *amplitude, RPGfloat *length, RPGfloat *speed,
+                                         RPGfloat *phase);
+RPG_RESULT RPG_BasicSprite_SetDistortion(RPGbasic *basic, RPG_DISTORTION type, RPGfloat amplitude, RPGfloat length, RPGfloat speed,
+                                         RPGfloat phase);
 
 // Sprite
 RPG_RESULT RPG_Sprite_Create(RPGviewport *viewport, RPGsprite **sprite);
@@ -620,6 +709,69 @@ RPG_RESULT RPG_Sprite_GetSourceBounds(RPGsprite *sprite, RPGint *x, RPGint *y, R
 RPG_RESULT RPG_Sprite_SetSourceBounds(RPGsprite *sprite, RPGint x, RPGint y, RPGint width, RPGint height);
 RPG_RESULT RPG_Sprite_GetOrigin(RPGsprite *sprite, RPGint *x, RPGint *y);
 RPG_RESULT RPG_Sprite_SetOrigin(RPGsprite *sprite, RPGint x, RPGint y);
+RPG_RESULT RPG_Sprite_Play(RPGsprite *sprite, RPGanimation *animation, RPGbool restart);
+RPG_RESULT RPG_Sprite_Stop(RPGsprite *sprite);
+RPG_RESULT RPG_Sprite_Resume(RPGsprite *sprite);
+RPG_RESULT RPG_Sprite_GetAnimation(RPGsprite *sprite, RPGanimation **animation);
+RPG_RESULT RPG_Sprite_IsPlaying(RPGsprite *sprite, RPGbool *playing);
+RPG_RESULT RPG_Sprite_GetFrame(RPGsprite *sprite, RPGint *frame);
+RPG_RESULT RPG_Sprite_SetFrame(RPGsprite *sprite, RPGint frame);
+
+// Animation
+RPG_RESULT RPG_Animation_Create(RPGimage *image, RPG_ANIMATION_MODE mode, RPGanimation **animation);
+RPG_RESULT RPG_Animation_CreateFromGrid(RPGimage *image, RPGint columns, RPGint rows, RPGint first, RPGint count, RPGint duration,
+                                        RPG_ANIMATION_MODE mode, RPGanimation **animation);
+RPG_RESULT RPG_Animation_Free(RPGanimation *animation);
+RPG_RESULT RPG_Animation_AddFrame(RPGanimation *animation, RPGint x, RPGint y, RPGint width, RPGint height, RPGint duration);
+RPG_RESULT RPG_Animation_GetFrameCount(RPGanimation *animation, RPGint *count);
+RPG_RESULT RPG_Animation_GetFrameDuration(RPGanimation *animation, RPGint index, RPGint *duration);
+RPG_RESULT RPG_Animation_SetFrameDuration(RPGanimation *animation, RPGint index, RPGint duration);
+RPG_RESULT RPG_Animation_GetImage(RPGanimation *animation, RPGimage **image);
+RPG_RESULT RPG_Animation_GetMode(RPGanimation *animation, RPG_ANIMATION_MODE *mode);
+RPG_RESULT RPG_Animation_SetMode(RPGanimation *animation, RPG_ANIMATION_MODE mode);
+RPG_RESULT RPG_Animation_GetUserPointer(RPGanimation *animation, void **user);
+RPG_RESULT RPG_Animation_SetUserPointer(RPGanimation *animation, void *user);
+
+// Tween
+RPG_RESULT RPG_Tween_Create(RPGbasic *target, RPG_TWEEN_PROPERTY property, RPGfloat *values, RPGint duration, RPG_EASING easing,
+                            RPGtween **tween);
+RPG_RESULT RPG_Tween_CreateDelay(RPGint duration, RPGtween **tween);
+RPG_RESULT RPG_Tween_CreateSequence(RPGtween **tween);
+RPG_RESULT RPG_Tween_CreateParallel(RPGtween **tween);
+RPG_RESULT RPG_Tween_Free(RPGtween *tween);
+RPG_RESULT RPG_Tween_Add(RPGtween *group, RPGtween *tween);
+RPG_RESULT RPG_Tween_SetFrom(RPGtween *tween, RPGfloat *values);
+RPG_RESULT RPG_Tween_SetRepeat(RPGtween *tween, RPGint count, RPGbool yoyo);
+RPG_RESULT RPG_Tween_SetCallback(RPGtween *tween, RPGtweenfunc func, void *user);
+RPG_RESULT RPG_Tween_Start(RPGtween *tween);
+RPG_RESULT RPG_Tween_Stop(RPGtween *tween);
+RPG_RESULT RPG_Tween_IsRunning(RPGtween *tween, RPGbool *running);
+RPG_RESULT RPG_Tween_StopAll(RPGbasic *target);
+
+// Window
+RPG_RESULT RPG_Window_Create(RPGviewport *viewport, RPGint x, RPGint y, RPGint width, RPGint height, RPGwindow **window);
+RPG_RESULT RPG_Window_Free(RPGwindow *window);
+RPG_RESULT RPG_Window_GetViewport(RPGwindow *window, RPGviewport **viewport);
+RPG_RESULT RPG_Window_GetSkin(RPGwindow *window, RPGimage **skin);
+RPG_RESULT RPG_Window_SetSkin(RPGwindow *window, RPGimage *skin);
+RPG_RESULT RPG_Window_SetSkinLayout(RPGwindow *window, RPGrect *background, RPGrect *frame, RPGint frameBorder, RPGrect *cursor,
+                                    RPGint cursorBorder);
+RPG_RESULT RPG_Window_GetTiled(RPGwindow *window, RPGbool *tiled);
+RPG_RESULT RPG_Window_SetTiled(RPGwindow *window, RPGbool tiled);
+RPG_RESULT RPG_Window_GetContents(RPGwindow *window, RPGimage **contents);
+RPG_RESULT RPG_Window_SetContents(RPGwindow *window, RPGimage *contents);
+RPG_RESULT RPG_Window_GetSize(RPGwindow *window, RPGint *width, RPGint *height);
+RPG_RESULT RPG_Window_SetSize(RPGwindow *window, RPGint width, RPGint height);
+RPG_RESULT RPG_Window_GetPadding(RPGwindow *window, RPGint *padding);
+RPG_RESULT RPG_Window_SetPadding(RPGwindow *window, RPGint padding);
+RPG_RESULT RPG_Window_GetContentsOrigin(RPGwindow *window, RPGint *x, RPGint *y);
+RPG_RESULT RPG_Window_SetContentsOrigin(RPGwindow *window, RPGint x, RPGint y);
+RPG_RESULT RPG_Window_GetCursorRect(RPGwindow *window, RPGrect *rect);
+RPG_RESULT RPG_Window_SetCursorRect(RPGwindow *window, RPGrect *rect);
+RPG_RESULT RPG_Window_GetOpenness(RPGwindow *window, RPGfloat *openness);
+RPG_RESULT RPG_Window_SetOpenness(RPGwindow *window, RPGfloat openness);
+RPG_RESULT RPG_Window_Open(RPGwindow *window, RPGint duration);
+RPG_RESULT RPG_Window_Close(RPGwindow *window, RPGint duration);
 
 // Plane
 RPG_RESULT RPG_Plane_Create(RPGviewport *viewport, RPGplane **plane);
@@ -645,6 +797,8 @@ RPG_RESULT RPG_Viewport_GetRect(RPGviewport *viewport, RPGrect *rect);
 RPG_RESULT RPG_Viewport_GetBounds(RPGviewport *viewport, RPGint *x, RPGint *y, RPGint *width, RPGint *height);
 RPG_RESULT RPG_Viewport_GetOrigin(RPGviewport *viewport, RPGint *x, RPGint *y);
 RPG_RESULT RPG_Viewport_SetOrigin(RPGviewport *viewport, RPGint x, RPGint y);
+RPG_RESULT RPG_Viewport_AddPostFX(RPGviewport *viewport, RPGpostfx *fx);
+RPG_RESULT RPG_Viewport_RemovePostFX(RPGviewport *viewport, RPGpostfx *fx);
 
 // Font
 RPG_RESULT RPG_Font_Create(void *buffer, RPGsize sizeBuffer, RPGfont **font);
@@ -691,6 +845,125 @@ RPG_RESULT RPG_Shader_SetUniformMat4(RPGshader *shader, RPGint location, RPGmat4
 RPG_RESULT RPG_Shader_BindImage(RPGshader *shader, RPGint location, RPGint unit, RPGimage *image);
 RPG_RESULT RPG_Shader_UnbindImage(RPGshader *shader, RPGint unit);
 
+// Material
+RPG_RESULT RPG_Material_Create(RPGshader *shader, RPGmaterial **material);
+RPG_RESULT RPG_Material_Free(RPGmaterial *material);
+RPG_RESULT RPG_Material_GetShader(RPGmaterial *material, RPGshader **shader);
+RPG_RESULT RPG_Material_GetUserPointer(RPGmaterial *material, void **user);
+RPG_RESULT RPG_Material_SetUserPointer(RPGmaterial *material, void *user);
+RPG_RESULT RPG_Material_SetUniform1f(RPGmaterial *material, RPGint location, RPGfloat v1);
+RPG_RESULT RPG_Material_SetUniform2f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2);
+RPG_RESULT RPG_Material_SetUniform3f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2, RPGfloat v3);
+RPG_RESULT RPG_Material_SetUniform4f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2, RPGfloat v3, RPGfloat v4);
+RPG_RESULT RPG_Material_SetUniform1i(RPGmaterial *material, RPGint location, RPGint v1);
+RPG_RESULT RPG_Material_SetUniform2i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2);
+RPG_RESULT RPG_Material_SetUniform3i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2, RPGint v3);
+RPG_RESULT RPG_Material_SetUniform4i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2, RPGint v3, RPGint v4);
+RPG_RESULT RPG_Material_SetUniformMat4(RPGmaterial *material, RPGint location, RPGmat4 *mat);
+RPG_RESULT RPG_Material_BindImage(RPGmaterial *material, RPGint location, RPGint unit, RPGimage *image);
+
+// PostFX
+RPG_RESULT RPG_PostFX_Create(const char *fragSrc, RPGint downsample, RPGpostfx **fx);
+RPG_RESULT RPG_PostFX_CreateBlur(RPGfloat radius, RPGint downsample, RPGpostfx **fx);
+RPG_RESULT RPG_PostFX_CreateBloom(RPGfloat threshold, RPGfloat intensity, RPGfloat radius, RPGpostfx **fx);
+RPG_RESULT RPG_PostFX_Free(RPGpostfx *fx);
+RPG_RESULT RPG_PostFX_GetShader(RPGpostfx *fx, RPGshader **shader);
+RPG_RESULT RPG_PostFX_GetEnabled(RPGpostfx *fx, RPGbool *enabled);
+RPG_RESULT RPG_PostFX_SetEnabled(RPGpostfx *fx, RPGbool enabled);
+RPG_RESULT RPG_PostFX_GetRadius(RPGpostfx *fx, RPGfloat *radius);
+RPG_RESULT RPG_PostFX_SetRadius(RPGpostfx *fx, RPGfloat radius);
+RPG_RESULT RPG_PostFX_GetThreshold(RPGpostfx *fx, RPGfloat *threshold);
+RPG_RESULT RPG_PostFX_SetThreshold(RPGpostfx *fx, RPGfloat threshold);
+RPG_RESULT RPG_PostFX_GetIntensity(RPGpostfx *fx, RPGfloat *intensity);
+RPG_RESULT RPG_PostFX_SetIntensity(RPGpostfx *fx, RPGfloat intensity);
+RPG_RESULT RPG_PostFX_GetUserPointer(RPGpostfx *fx, void **user);
+RPG_RESULT RPG_PostFX_SetUserPointer(RPGpostfx *fx, void *user);
+
+// Lightmap
+RPG_RESULT RPG_Lightmap_Create(RPGint scale, RPGlightmap **lightmap);
+RPG_RESULT RPG_Lightmap_Free(RPGlightmap *lightmap);
+RPG_RESULT RPG_Lightmap_GetScale(RPGlightmap *lightmap, RPGint *scale);
+RPG_RESULT RPG_Lightmap_GetAmbient(RPGlightmap *lightmap, RPGcolor *color);
+RPG_RESULT RPG_Lightmap_SetAmbient(RPGlightmap *lightmap, RPGcolor *color);
+RPG_RESULT RPG_Lightmap_CreatePointLight(RPGlightmap *lightmap, RPGfloat x, RPGfloat y, RPGfloat radius, RPGcolor *color, RPGint *light);
+RPG_RESULT RPG_Lightmap_CreateConeLight(RPGlightmap *lightmap, RPGfloat x, RPGfloat y, RPGfloat radius, RPGfloat direction,
+                                        RPGfloat angle, RPGcolor *color, RPGint *light);
+RPG_RESULT RPG_Lightmap_RemoveLight(RPGlightmap *lightmap, RPGint light);
+RPG_RESULT RPG_Lightmap_GetLightLocation(RPGlightmap *lightmap, RPGint light, RPGfloat *x, RPGfloat *y);
+RPG_RESULT RPG_Lightmap_SetLightLocation(RPGlightmap *lightmap, RPGint light, RPGfloat x, RPGfloat y);
+RPG_RESULT RPG_Lightmap_SetLightRadius(RPGlightmap *lightmap, RPGint light, RPGfloat radius);
+RPG_RESULT RPG_Lightmap_SetLightColor(RPGlightmap *lightmap, RPGint light, RPGcolor *color);
+RPG_RESULT RPG_Lightmap_SetLightCone(RPGlightmap *lightmap, RPGint light, RPGfloat direction, RPGfloat angle, RPGfloat softness);
+RPG_RESULT RPG_Lightmap_SetOccluders(RPGlightmap *lightmap, RPGtilemap *tilemap, const char *property);
+RPG_RESULT RPG_Lightmap_ClearOccluders(RPGlightmap *lightmap);
+
+// Emitter
+RPG_RESULT RPG_Emitter_Create(RPGviewport *viewport, RPGint capacity, RPGemitter **emitter);
+RPG_RESULT RPG_Emitter_Free(RPGemitter *emitter);
+RPG_RESULT RPG_Emitter_GetViewport(RPGemitter *emitter, RPGviewport **viewport);
+RPG_RESULT RPG_Emitter_GetImage(RPGemitter *emitter, RPGimage **image);
+RPG_RESULT RPG_Emitter_SetImage(RPGemitter *emitter, RPGimage *image);
+RPG_RESULT RPG_Emitter_SetFrames(RPGemitter *emitter, RPGint columns, RPGint rows, RPGbool animate);
+RPG_RESULT RPG_Emitter_GetCapacity(RPGemitter *emitter, RPGint *capacity);
+RPG_RESULT RPG_Emitter_GetCount(RPGemitter *emitter, RPGint *count);
+RPG_RESULT RPG_Emitter_GetEmitting(RPGemitter *emitter, RPGbool *emitting);
+RPG_RESULT RPG_Emitter_SetEmitting(RPGemitter *emitter, RPGbool emitting);
+RPG_RESULT RPG_Emitter_GetRate(RPGemitter *emitter, RPGfloat *rate);
+RPG_RESULT RPG_Emitter_SetRate(RPGemitter *emitter, RPGfloat rate);
+RPG_RESULT RPG_Emitter_Burst(RPGemitter *emitter, RPGint count);
+RPG_RESULT RPG_Emitter_Clear(RPGemitter *emitter);
+RPG_RESULT RPG_Emitter_SetArea(RPGemitter *emitter, RPGfloat width, RPGfloat height);
+RPG_RESULT RPG_Emitter_SetLife(RPGemitter *emitter, RPGfloat min, RPGfloat max);
+RPG_RESULT RPG_Emitter_SetSpeed(RPGemitter *emitter, RPGfloat min, RPGfloat max);
+RPG_RESULT RPG_Emitter_SetDirection(RPGemitter *emitter, RPGfloat direction, RPGfloat spread);
+RPG_RESULT RPG_Emitter_SetGravity(RPGemitter *emitter, RPGfloat x, RPGfloat y);
+RPG_RESULT RPG_Emitter_SetSize(RPGemitter *emitter, RPGfloat start, RPGfloat end);
+RPG_RESULT RPG_Emitter_SetSpin(RPGemitter *emitter, RPGfloat min, RPGfloat max);
+RPG_RESULT RPG_Emitter_SetColorRamp(RPGemitter *emitter, RPGcolor *colors, RPGint count);
+RPG_RESULT RPG_Emitter_SetAlphaRamp(RPGemitter *emitter, RPGfloat *values, RPGint count);
+
+// Primitives
+RPG_RESULT RPG_Primitives_Create(RPGviewport *viewport, RPGprimitives **primitives);
+RPG_RESULT RPG_Primitives_Free(RPGprimitives *primitives);
+RPG_RESULT RPG_Primitives_GetViewport(RPGprimitives *primitives, RPGviewport **viewport);
+RPG_RESULT RPG_Primitives_GetCount(RPGprimitives *primitives, RPGint *count);
+RPG_RESULT RPG_Primitives_Clear(RPGprimitives *primitives);
+RPG_RESULT RPG_Primitives_DrawLine(RPGprimitives *primitives, RPGfloat x1, RPGfloat y1, RPGfloat x2, RPGfloat y2, RPGfloat width,
+                                   RPGcolor *color1, RPGcolor *color2);
+RPG_RESULT RPG_Primitives_DrawRect(RPGprimitives *primitives, RPGrect *rect, RPGfloat width, RPGcolor *color);
+RPG_RESULT RPG_Primitives_FillRect(RPGprimitives *primitives, RPGrect *rect, RPGcolor *color);
+RPG_RESULT RPG_Primitives_FillGradientRect(RPGprimitives *primitives, RPGrect *rect, RPGcolor *color1, RPGcolor *color2,
+                                           RPGbool vertical);
+RPG_RESULT RPG_Primitives_DrawCircle(RPGprimitives *primitives, RPGfloat x, RPGfloat y, RPGfloat radius, RPGfloat width, RPGcolor *color);
+RPG_RESULT RPG_Primitives_FillCircle(RPGprimitives *primitives, RPGfloat x, RPGfloat y, RPGfloat radius, RPGcolor *inner, RPGcolor *outer);
+RPG_RESULT RPG_Primitives_DrawPolygon(RPGprimitives *primitives, RPGvec2 *points, RPGint count, RPGfloat width, RPGcolor *color);
+RPG_RESULT RPG_Primitives_FillPolygon(RPGprimitives *primitives, RPGvec2 *points, RPGint count, RPGcolor *color);
+RPG_RESULT RPG_Primitives_FillTriangles(RPGprimitives *primitives, RPGvec2 *points, RPGcolor *colors, RPGint count);
+RPG_RESULT RPG_Primitives_RenderToImage(RPGprimitives *primitives, RPGimage *image);
+
+// Bulk (strided arrays of values for each handle, a stride of 0 is tightly packed, NULL handles are skipped)
+RPG_RESULT RPG_Bulk_SetLocation(RPGbasic **objects, RPGint count, const RPGint *locations, RPGsize stride);
+RPG_RESULT RPG_Bulk_SetZ(RPGbasic **objects, RPGint count, const RPGint *z, RPGsize stride);
+RPG_RESULT RPG_Bulk_SetAlpha(RPGbasic **objects, RPGint count, const RPGfloat *alpha, RPGsize stride);
+RPG_RESULT RPG_Bulk_SetColor(RPGbasic **objects, RPGint count, const RPGcolor *colors, RPGsize stride);
+RPG_RESULT RPG_Bulk_SetVisible(RPGbasic **objects, RPGint count, const RPGbool *visible, RPGsize stride);
+RPG_RESULT RPG_Bulk_SetSourceRect(RPGsprite **sprites, RPGint count, const RPGrect *rects, RPGsize stride);
+
+// World
+RPG_RESULT RPG_World_Create(RPGworld **world);
+RPG_RESULT RPG_World_Free(RPGworld *world);
+RPG_RESULT RPG_World_AddBox(RPGworld *world, RPGbasic *object, RPGrect *box, RPGuint layer, RPGuint mask, RPGint *shape);
+RPG_RESULT RPG_World_AddCircle(RPGworld *world, RPGbasic *object, RPGint x, RPGint y, RPGint radius, RPGuint layer, RPGuint mask,
+                               RPGint *shape);
+RPG_RESULT RPG_World_RemoveShape(RPGworld *world, RPGint shape);
+RPG_RESULT RPG_World_GetShapeObject(RPGworld *world, RPGint shape, RPGbasic **object);
+RPG_RESULT RPG_World_GetShapeLayers(RPGworld *world, RPGint shape, RPGuint *layer, RPGuint *mask);
+RPG_RESULT RPG_World_SetShapeLayers(RPGworld *world, RPGint shape, RPGuint layer, RPGuint mask);
+RPG_RESULT RPG_World_GetShapePrecise(RPGworld *world, RPGint shape, RPGbool *precise);
+RPG_RESULT RPG_World_SetShapePrecise(RPGworld *world, RPGint shape, RPGbool precise);
+RPG_RESULT RPG_World_Step(RPGworld *world);
+RPG_RESULT RPG_World_GetContacts(RPGworld *world, const RPGcontact **contacts, RPGint *count);
+
 // Input
 RPG_RESULT RPG_Input_Initialize(RPGgame *game);
 RPG_RESULT RPG_Input_Update(void);
@@ -723,11 +996,38 @@ RPG_RESULT RPG_Tilemap_SetOrigin(RPGtilemap *tilemap, RPGint x, RPGint y);
 RPG_RESULT RPG_Tilemap_GetLayerCount(RPGtilemap *tilemap, RPGint *count);
 RPG_RESULT RPG_Tilemap_GetLayerAlpha(RPGtilemap *tilemap, RPGint layer, RPGfloat *alpha);
 RPG_RESULT RPG_Tilemap_SetLayerAlpha(RPGtilemap *tilemap, RPGint layer, RPGfloat alpha);
+RPG_RESULT RPG_Tilemap_GetLayerMode(RPGtilemap *tilemap, RPGint layer, RPG_TILEMAP_MODE *mode);
+RPG_RESULT RPG_Tilemap_SetLayerMode(RPGtilemap *tilemap, RPGint layer, RPG_TILEMAP_MODE mode);
+RPG_RESULT RPG_Tilemap_GetLayerBaked(RPGtilemap *tilemap, RPGint layer, RPGbool *baked);
+RPG_RESULT RPG_Tilemap_SetLayerBaked(RPGtilemap *tilemap, RPGint layer, RPGbool baked);
+RPG_RESULT RPG_Tilemap_GetBakeBudget(RPGtilemap *tilemap, RPGsize *bytes);
+RPG_RESULT RPG_Tilemap_SetBakeBudget(RPGtilemap *tilemap, RPGsize bytes);
+RPG_RESULT RPG_Tilemap_GetStreamRadius(RPGtilemap *tilemap, RPGint *radius);
+RPG_RESULT RPG_Tilemap_SetStreamRadius(RPGtilemap *tilemap, RPGint radius);
+RPG_RESULT RPG_Tilemap_GetTile(RPGtilemap *tilemap, RPGint layer, RPGint x, RPGint y, RPGint *gid);
+RPG_RESULT RPG_Tilemap_SetTile(RPGtilemap *tilemap, RPGint layer, RPGint x, RPGint y, RPGint gid);
+RPG_RESULT RPG_Tilemap_GetTiles(RPGtilemap *tilemap, RPGint layer, RPGrect *rect, RPGint *gids);
+RPG_RESULT RPG_Tilemap_SetTiles(RPGtilemap *tilemap, RPGint layer, RPGrect *rect, const RPGint *gids);
+RPG_RESULT RPG_Tilemap_GetExtrusion(RPGtilemap *tilemap, RPGint *pixels);
+RPG_RESULT RPG_Tilemap_SetExtrusion(RPGtilemap *tilemap, RPGint pixels);
 RPG_RESULT RPG_Tilemap_GetLayerVisible(RPGtilemap *tilemap, RPGint layer, RPGbool *visible);
 RPG_RESULT RPG_Tilemap_SetLayerVisible(RPGtilemap *tilemap, RPGint layer, RPGbool visible);
 RPG_RESULT RPG_Tilemap_GetLayerZ(RPGtilemap *tilemap, RPGint layer, RPGint *z);
 RPG_RESULT RPG_Tilemap_SetLayerZ(RPGtilemap *tilemap, RPGint layer, RPGint z);
 
+// Tile World
+RPG_RESULT RPG_TileWorld_CreateFromFile(const char *path, RPGviewport *viewport, RPGtileworld **world);
+RPG_RESULT RPG_TileWorld_Free(RPGtileworld *world);
+RPG_RESULT RPG_TileWorld_Update(RPGtileworld *world);
+RPG_RESULT RPG_TileWorld_GetOrigin(RPGtileworld *world, RPGint *x, RPGint *y);
+RPG_RESULT RPG_TileWorld_SetOrigin(RPGtileworld *world, RPGint x, RPGint y);
+RPG_RESULT RPG_TileWorld_GetPrefetchRadius(RPGtileworld *world, RPGint *radius);
+RPG_RESULT RPG_TileWorld_SetPrefetchRadius(RPGtileworld *world, RPGint radius);
+RPG_RESULT RPG_TileWorld_GetMapCount(RPGtileworld *world, RPGint *count);
+RPG_RESULT RPG_TileWorld_GetMapBounds(RPGtileworld *world, RPGint index, RPGrect *bounds);
+RPG_RESULT RPG_TileWorld_GetMap(RPGtileworld *world, RPGint index, RPGtilemap **tilemap);
+RPG_RESULT RPG_TileWorld_GetCurrentMap(RPGtileworld *world, RPGint *index);
+
 /**
  * @brief Pointer to the game whose context is current.
  */
@@ -0,0 +1,119 @@
+#include "rpg.h"
+#include "stdio.h"
+#include <string.h>
+#include <time.h>
+
+// Measures the frame time of a large tilemap against the size of the visible area.
+//
+// A 512x512 map with two full layers is generated in memory, and rendered at a range of resolutions with the view
+// centered on the map. As layers are culled by chunk, frame time should follow the visible area, not the map size.
+// Times are taken around RPG_Game_Render over many frames, so they include driver throttling once its queue fills.
+
+#define MAP_SIZE 512
+#define TILE_SIZE 32
+#define TILESET_COLUMNS 8
+#define FRAMES 240
+#define WARMUP 30
+
+static const char *TILESET_PATH = "tilemap_bench.png";
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void create_tileset(void) {
+    const int size = TILESET_COLUMNS * TILE_SIZE;
+    RPGubyte *pixels = malloc(size * size * 4);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            RPGubyte *p = &pixels[(y * size + x) * 4];
+            int tile = (y / TILE_SIZE) * TILESET_COLUMNS + (x / TILE_SIZE);
+            p[0] = (RPGubyte) (tile * 37);
+            p[1] = (RPGubyte) (tile * 91);
+            p[2] = (RPGubyte) ((x ^ y) & 0xFF);
+            p[3] = 0xFF;
+        }
+    }
+    RPGimage *image;
+    RPG_Image_Create(size, size, pixels, RPG_PIXEL_FORMAT_RGBA, &image);
+    RPG_Image_Save(image, TILESET_PATH, RPG_IMAGE_FORMAT_PNG, 1.0f);
+    RPG_Image_Free(image);
+    free(pixels);
+}
+
+static char *create_map(size_t *length) {
+    // Each tile is at most "64," in CSV
+    size_t capacity = 4096 + (size_t) MAP_SIZE * MAP_SIZE * 4 * 2;
+    char *xml = malloc(capacity);
+    size_t n = 0;
+    n += sprintf(xml + n,
+                 "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                 "<map version=\"1.2\" orientation=\"orthogonal\" renderorder=\"right-down\" width=\"%d\" height=\"%d\" "
+                 "tilewidth=\"%d\" tileheight=\"%d\" infinite=\"0\" nextlayerid=\"3\" nextobjectid=\"1\">\n"
+                 " <tileset firstgid=\"1\" name=\"bench\" tilewidth=\"%d\" tileheight=\"%d\" tilecount=\"%d\" columns=\"%d\">\n"
+                 "  <image source=\"%s\" width=\"%d\" height=\"%d\"/>\n"
+                 " </tileset>\n",
+                 MAP_SIZE, MAP_SIZE, TILE_SIZE, TILE_SIZE, TILE_SIZE, TILE_SIZE, TILESET_COLUMNS * TILESET_COLUMNS, TILESET_COLUMNS,
+                 TILESET_PATH, TILESET_COLUMNS * TILE_SIZE, TILESET_COLUMNS * TILE_SIZE);
+    for (int layer = 1; layer <= 2; layer++) {
+        n += sprintf(xml + n, " <layer id=\"%d\" name=\"Layer %d\" width=\"%d\" height=\"%d\">\n  <data encoding=\"csv\">\n", layer, layer,
+                     MAP_SIZE, MAP_SIZE);
+        for (int i = 0; i < MAP_SIZE * MAP_SIZE; i++) {
+            int gid = 1 + (i * 7 + layer) % (TILESET_COLUMNS * TILESET_COLUMNS);
+            n += sprintf(xml + n, i + 1 < MAP_SIZE * MAP_SIZE ? "%d," : "%d\n", gid);
+        }
+        n += sprintf(xml + n, "  </data>\n </layer>\n");
+    }
+    n += sprintf(xml + n, "</map>\n");
+    *length = n;
+    return xml;
+}
+
+int main(int argc, char **argv) {
+    const int sizes[][2] = {{160, 120}, {320, 240}, {640, 480}, {800, 600}, {1280, 720}, {1920, 1080}};
+
+    RPGgame *game;
+    RPG_Game_Create("Tilemap Benchmark", 1920, 1080, RPG_INIT_DEFAULT, &game);
+
+    create_tileset();
+    size_t length;
+    char *xml = create_map(&length);
+    RPGtilemap *tilemap;
+    if (RPG_Tilemap_Create(xml, length, NULL, &tilemap) != RPG_NO_ERROR) {
+        fprintf(stderr, "failed to create tilemap\n");
+        return 1;
+    }
+    free(xml);
+
+    printf("map: %dx%d tiles, 2 layers (%d tiles)\n", MAP_SIZE, MAP_SIZE, MAP_SIZE * MAP_SIZE * 2);
+    printf("%12s %14s %12s %10s\n", "view", "visible tiles", "ms/frame", "fps");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        int w = sizes[i][0], h = sizes[i][1];
+        RPG_Game_SetResolution(game, w, h);
+
+        // Center the view on the map, which also flags the tilemap to upload the new projection
+        int center = MAP_SIZE * TILE_SIZE / 2;
+        RPG_Tilemap_SetOrigin(tilemap, center - w / 2, center - h / 2);
+
+        for (int f = 0; f < WARMUP; f++) {
+            RPG_Game_Render(game);
+        }
+        double start = now();
+        for (int f = 0; f < FRAMES; f++) {
+            RPG_Game_Render(game);
+        }
+        double ms = (now() - start) * 1000.0 / FRAMES;
+
+        int visible = ((w + TILE_SIZE - 1) / TILE_SIZE + 1) * ((h + TILE_SIZE - 1) / TILE_SIZE + 1) * 2;
+        char view[32];
+        snprintf(view, sizeof(view), "%dx%d", w, h);
+        printf("%12s %14d %12.3f %10.1f\n", view, visible, ms, 1000.0 / ms);
+    }
+
+    RPG_Tilemap_Free(tilemap);
+    RPG_Game_Destroy(game);
+    remove(TILESET_PATH);
+    return 0;
+}
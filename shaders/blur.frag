@@ -0,0 +1,19 @@
+#version 330 core
+
+in vec2 coords;
+out vec4 result;
+
+uniform sampler2D image;
+uniform vec2 direction;
+
+// 9-tap gaussian, reduced to 5 fetches by sampling between texels with linear filtering
+const float offsets[3] = float[](0.0, 1.3846153846, 3.2307692308);
+const float weights[3] = float[](0.2270270270, 0.3162162162, 0.0702702703);
+
+void main() {
+    result = texture(image, coords) * weights[0];
+    for (int i = 1; i < 3; i++) {
+        result += texture(image, coords + direction * offsets[i]) * weights[i];
+        result += texture(image, coords - direction * offsets[i]) * weights[i];
+    }
+}
@@ -0,0 +1,13 @@
+#version 330 core
+
+in vec2 coords;
+out vec4 result;
+
+uniform sampler2D image;
+uniform sampler2D bloom;
+uniform float intensity;
+
+void main() {
+    result     = texture(image, coords);
+    result.rgb = result.rgb + texture(bloom, coords).rgb * intensity;
+}
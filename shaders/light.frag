@@ -0,0 +1,27 @@
+#version 330 core
+
+in vec2 local;
+in vec4 tint;
+flat in vec3 spread;
+out vec4 result;
+
+uniform bool occluder;
+uniform vec4 ambient;
+
+const float PI = 3.14159265;
+
+void main() {
+    if (occluder) {
+        result = ambient;
+        return;
+    }
+    float atten = clamp(1.0 - length(local), 0.0, 1.0);
+    atten *= atten;
+
+    // spread.x is the direction, spread.y the half-angle, and spread.z the softness of a cone's edge
+    if (spread.y < PI) {
+        float angle = abs(mod(atan(local.y, local.x) - spread.x + PI, 2.0 * PI) - PI);
+        atten *= 1.0 - smoothstep(spread.y * (1.0 - spread.z), spread.y, angle);
+    }
+    result = vec4(tint.rgb * atten, 1.0);
+}
@@ -0,0 +1,33 @@
+#version 330 core
+
+layout(location = 0) in vec4 shape;
+layout(location = 1) in vec4 color;
+layout(location = 2) in vec4 cone;
+
+out vec2 local;
+out vec4 tint;
+flat out vec3 spread;
+
+uniform mat4 projection;
+uniform vec2 origin;
+uniform bool occluder;
+
+const vec2 corners[6] = vec2[](vec2(-1.0, 1.0), vec2(1.0, -1.0), vec2(-1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0), vec2(1.0, -1.0));
+
+void main() {
+    vec2 corner = corners[gl_VertexID];
+    if (occluder) {
+        // Instance is a rectangle as x, y, width, height
+        local       = vec2(0.0);
+        tint        = vec4(0.0);
+        spread      = vec3(0.0);
+        gl_Position = projection * vec4(shape.xy + (corner * 0.5 + 0.5) * shape.zw - origin, 0.0, 1.0);
+        return;
+    }
+    local  = corner;
+    tint   = vec4(color.rgb * color.a, 1.0);
+    spread = cone.xyz;
+
+    // Collapse unused slots to a degenerate triangle
+    gl_Position = shape.w > 0.0 ? projection * vec4(shape.xy + corner * shape.z - origin, 0.0, 1.0) : vec4(0.0);
+}
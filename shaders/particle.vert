@@ -0,0 +1,28 @@
+#version 330 core
+
+layout(location = 0) in vec4 particle;
+layout(location = 1) in vec4 tint;
+layout(location = 2) in float frame;
+
+out vec2 coords;
+out vec4 shade;
+
+uniform mat4 projection;
+uniform mat4 model;
+uniform vec2 frames;
+
+const vec2 corners[6] = vec2[](vec2(-1.0, 1.0), vec2(1.0, -1.0), vec2(-1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0), vec2(1.0, -1.0));
+
+void main() {
+    // particle.xy is the location, particle.z the size, and particle.w the rotation in radians
+    vec2 corner = corners[gl_VertexID];
+    float s     = sin(particle.w);
+    float c     = cos(particle.w);
+    vec2 offset = mat2(c, s, -s, c) * (corner * 0.5 * particle.z);
+
+    // Select the cell of the atlas, frames are numbered left-to-right, top-to-bottom
+    vec2 cell   = vec2(mod(frame, frames.x), floor(frame / frames.x));
+    coords      = (cell + corner * 0.5 + 0.5) / frames;
+    shade       = tint;
+    gl_Position = projection * model * vec4(particle.xy + offset, 0.0, 1.0);
+}
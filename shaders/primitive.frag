@@ -0,0 +1,28 @@
+#version 330 core
+
+in vec4 shade;
+out vec4 result;
+
+uniform vec4 color;
+uniform vec4 tone;
+uniform vec4 flash;
+uniform float alpha;
+
+void main() {
+    result = shade;
+    if (color.a > 0.0) {
+        result = vec4(mix(result.rgb, color.rgb, color.a), result.a);
+    }
+    if (tone.a > 0.0) {
+        float avg = (result.r + result.g + result.b) / 3.0;
+        result.rgb -= (result.rgb - avg) * tone.a;
+    }
+    result = vec4(clamp(result.rgb + tone.rgb, 0.0, 1.0), result.a);
+
+    if (flash.a > 0.0) {
+        result = vec4(mix(result.rgb, flash.rgb, flash.a), result.a);
+    }
+    if (alpha < 1.0) {
+        result *= alpha;
+    }
+}
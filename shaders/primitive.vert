@@ -0,0 +1,14 @@
+#version 330 core
+
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec4 tint;
+
+out vec4 shade;
+
+uniform mat4 projection;
+uniform mat4 model;
+
+void main() {
+    shade       = tint;
+    gl_Position = projection * model * vec4(position, 0.0, 1.0);
+}
@@ -0,0 +1,28 @@
+#version 330 core
+
+in vec2 coords;
+out vec4 result;
+
+uniform sampler2D image;
+uniform sampler3D lut;
+uniform vec4 tone;
+uniform vec4 flash;
+uniform float brightness;
+uniform vec3 grading;
+
+void main() {
+    result = texture(image, coords);
+    if (tone.a > 0.0) {
+        float avg = (result.r + result.g + result.b) / 3.0;
+        result.rgb = result.rgb - ((result.rgb - avg) * tone.a);
+    }
+    result.rgb = clamp(result.rgb + tone.rgb, 0.0, 1.0);
+
+    // grading.x is the strength, grading.yz the scale/bias to sample texel centers of the lookup table
+    if (grading.x > 0.0) {
+        vec3 graded = texture(lut, result.rgb * grading.y + grading.z).rgb;
+        result.rgb  = mix(result.rgb, graded, grading.x);
+    }
+    result.rgb = mix(result.rgb, flash.rgb, flash.a) * brightness;
+    result.a   = 1.0;
+}
@@ -0,0 +1,12 @@
+#version 330 core
+
+layout(location = 0) in vec4 vertex;
+
+out vec2 coords;
+
+uniform vec2 offset;
+
+void main() {
+    coords      = vertex.zw;
+    gl_Position = vec4(vertex.xy + offset, 0.0, 1.0);
+}
@@ -0,0 +1,13 @@
+#version 330 core
+
+in vec2 coords;
+out vec4 result;
+
+uniform sampler2D image;
+uniform float threshold;
+
+void main() {
+    result       = texture(image, coords);
+    float bright = max(result.r, max(result.g, result.b));
+    result.rgb  *= max(bright - threshold, 0.0) / max(bright, 0.0001);
+}
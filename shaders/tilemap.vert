@@ -0,0 +1,81 @@
+#version 330 core
+precision highp float;
+
+layout(location = 0) in uvec2 position; // The column and row of the tile within the map
+layout(location = 1) in uvec2 tile;     // The index of the tile within its tileset, and its flip flags and tileset index
+
+uniform mat4 projection;
+uniform vec2 origin;
+uniform vec2 offset;    // The offset of the layer, in pixels
+uniform vec2 cellSize;  // The size of a map cell, in pixels
+uniform vec2 imageSize; // The size of the atlas the tilesets are packed into, in pixels
+
+uniform vec4 tilesets[16]; // The location of each tileset within the atlas, and the size of its tiles
+uniform ivec4 layouts[16]; // The columns, margin and spacing of each tileset, and its first entry in the frame table
+
+uniform usamplerBuffer frames; // The first frame and frame count of each tile, followed by the tile and end time of each frame
+uniform bool animated;         // Flag indicating the tileset has animations, and the frame table is bound
+uniform uint time;             // The game time, in milliseconds
+
+const uint FLIPPED_DIAGONALLY   = 1u;
+const uint FLIPPED_VERTICALLY   = 2u;
+const uint FLIPPED_HORIZONTALLY = 4u;
+const uint EMPTY                = 0xFFFFu; // The flags of an instance whose cell has been cleared
+
+const vec2 normal[6] = vec2[](
+    vec2(0.0, 1.0),
+    vec2(1.0, 0.0),
+    vec2(0.0, 0.0),
+    vec2(0.0, 1.0),
+    vec2(1.0, 1.0),
+    vec2(1.0, 0.0)
+);
+
+out vec2 coords;
+
+void main() {
+    // Cleared cells keep their instance until the layer is laid out again, and are placed outside the clip volume
+    if (tile.y == EMPTY) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        return;
+    }
+    vec2 corner = normal[gl_VertexID];
+
+    // Flips are applied to the image in the order diagonal, horizontal, vertical, so are undone in reverse
+    vec2 uv = corner;
+    if ((tile.y & FLIPPED_HORIZONTALLY) != 0u) {
+        uv.x = 1.0 - uv.x;
+    }
+    if ((tile.y & FLIPPED_VERTICALLY) != 0u) {
+        uv.y = 1.0 - uv.y;
+    }
+    if ((tile.y & FLIPPED_DIAGONALLY) != 0u) {
+        uv = uv.yx;
+    }
+
+    int set     = int(tile.y >> 3u);
+    vec4 region = tilesets[set];
+    ivec4 grid  = layouts[set];
+
+    // Find the frame of an animated tile, the frames are few and are searched linearly
+    uint id = tile.x;
+    if (animated) {
+        uvec2 sequence = texelFetch(frames, grid.w + int(id)).xy;
+        if (sequence.y > 0u) {
+            uint last    = sequence.x + sequence.y - 1u;
+            uint elapsed = time % texelFetch(frames, int(last)).y;
+            uint frame   = sequence.x;
+            while (frame < last && elapsed >= texelFetch(frames, int(frame)).y) {
+                frame++;
+            }
+            id = texelFetch(frames, int(frame)).x;
+        }
+    }
+
+    // Sample from texel centers to prevent bleeding from neighboring tiles
+    int index     = int(id);
+    vec2 source   = region.xy + vec2(grid.y) + vec2(index % grid.x, index / grid.x) * (region.zw + float(grid.z));
+    coords        = (source + 0.5 + uv * (region.zw - 1.0)) / imageSize;
+    vec2 location = (vec2(position) + corner) * cellSize + offset - origin;
+    gl_Position   = projection * vec4(location, 0.0, 1.0);
+}
@@ -0,0 +1,117 @@
+#version 330 core
+
+in vec2 world;
+out vec4 result;
+
+uniform sampler2D image;     // The atlas the tilesets are packed into
+uniform usampler2D indices;  // The tile index, and flip flags and tileset index, of each cell of the layer
+uniform vec2 cellSize;       // The size of a map cell, in pixels
+uniform vec2 imageSize;      // The size of the atlas, in pixels
+uniform vec4 tilesets[16];   // The location of each tileset within the atlas, and the size of its tiles
+uniform ivec4 layouts[16];   // The columns, margin and spacing of each tileset, and its first entry in the frame table
+
+uniform usamplerBuffer frames; // The first frame and frame count of each tile, followed by the tile and end time of each frame
+uniform bool animated;         // Flag indicating the tilesets have animations, and the frame table is bound
+uniform uint time;             // The game time, in milliseconds
+
+uniform vec4 color;
+uniform vec4 tone;
+uniform vec4 flash;
+uniform float alpha;
+uniform float hue;
+
+const uint EMPTY                = 0xFFFFu;
+const uint FLIPPED_DIAGONALLY   = 1u;
+const uint FLIPPED_VERTICALLY   = 2u;
+const uint FLIPPED_HORIZONTALLY = 4u;
+
+vec3 hue_shift(vec3 color, float hueAdjust) {
+
+    const vec3 kRGBToYPrime = vec3(0.299, 0.587, 0.114);
+    const vec3 kRGBToI      = vec3(0.596, -0.275, -0.321);
+    const vec3 kRGBToQ      = vec3(0.212, -0.523, 0.311);
+    const vec3 kYIQToR      = vec3(1.0, 0.956, 0.621);
+    const vec3 kYIQToG      = vec3(1.0, -0.272, -0.647);
+    const vec3 kYIQToB      = vec3(1.0, -1.107, 1.704);
+
+    float YPrime = dot(color, kRGBToYPrime);
+    float I      = dot(color, kRGBToI);
+    float Q      = dot(color, kRGBToQ);
+    float h      = atan(Q, I);
+    float chroma = sqrt(I * I + Q * Q);
+
+    h += radians(hue);
+    Q        = chroma * sin(h);
+    I        = chroma * cos(h);
+    vec3 yIQ = vec3(YPrime, I, Q);
+    return vec3(dot(yIQ, kYIQToR), dot(yIQ, kYIQToG), dot(yIQ, kYIQToB));
+}
+
+void main() {
+    ivec2 cell = ivec2(floor(world / cellSize));
+    if (any(lessThan(cell, ivec2(0))) || any(greaterThanEqual(cell, textureSize(indices, 0)))) {
+        discard;
+    }
+    uvec2 tile = texelFetch(indices, cell, 0).xy;
+    if (tile.y == EMPTY) {
+        discard;
+    }
+
+    // Flips are applied to the image in the order diagonal, horizontal, vertical, so are undone in reverse
+    vec2 uv = (world - vec2(cell) * cellSize) / cellSize;
+    if ((tile.y & FLIPPED_HORIZONTALLY) != 0u) {
+        uv.x = 1.0 - uv.x;
+    }
+    if ((tile.y & FLIPPED_VERTICALLY) != 0u) {
+        uv.y = 1.0 - uv.y;
+    }
+    if ((tile.y & FLIPPED_DIAGONALLY) != 0u) {
+        uv = uv.yx;
+    }
+
+    int set     = int(tile.y >> 3u);
+    vec4 region = tilesets[set];
+    ivec4 grid  = layouts[set];
+
+    // Find the frame of an animated tile, the frames are few and are searched linearly
+    uint id = tile.x;
+    if (animated) {
+        uvec2 sequence = texelFetch(frames, grid.w + int(id)).xy;
+        if (sequence.y > 0u) {
+            uint last    = sequence.x + sequence.y - 1u;
+            uint elapsed = time % texelFetch(frames, int(last)).y;
+            uint frame   = sequence.x;
+            while (frame < last && elapsed >= texelFetch(frames, int(frame)).y) {
+                frame++;
+            }
+            id = texelFetch(frames, int(frame)).x;
+        }
+    }
+
+    // Clamp to texel centers within the tile to prevent bleeding from neighboring tiles
+    int index   = int(id);
+    vec2 source = region.xy + vec2(grid.y) + vec2(index % grid.x, index / grid.x) * (region.zw + float(grid.z));
+    vec2 texel  = source + clamp(uv * region.zw, vec2(0.5), region.zw - 0.5);
+    result      = texture(image, texel / imageSize);
+
+    if (hue > 0.0) {
+        result = vec4(hue_shift(result.rgb, hue), result.a);
+    }
+    if (color.a > 0.0) {
+        result = vec4(mix(result.rgb, color.rgb, color.a), result.a);
+    }
+    if (tone.a > 0.0) {
+        float avg = (result.r + result.g + result.b) / 3.0;
+        result.r  = result.r - ((result.r - avg) * tone.a);
+        result.g  = result.g - ((result.g - avg) * tone.a);
+        result.b  = result.b - ((result.b - avg) * tone.a);
+    }
+    result = vec4(clamp(result.rgb + tone.rgb, 0.0, 1.0), result.a);
+
+    if (flash.a > 0.0) {
+        result = vec4(mix(result.rgb, flash.rgb, flash.a), result.a);
+    }
+    if (alpha < 1.0) {
+        result *= alpha;
+    }
+}
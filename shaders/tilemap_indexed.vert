@@ -0,0 +1,24 @@
+#version 330 core
+
+uniform mat4 projection;
+uniform vec2 origin;
+uniform vec2 offset;   // The offset of the layer, in pixels
+uniform vec2 viewSize; // The size of the view, in pixels
+
+const vec2 normal[6] = vec2[](
+    vec2(0.0, 1.0),
+    vec2(1.0, 0.0),
+    vec2(0.0, 0.0),
+    vec2(0.0, 1.0),
+    vec2(1.0, 1.0),
+    vec2(1.0, 0.0)
+);
+
+out vec2 world;
+
+void main() {
+    // A single quad covers the view, and each fragment finds its tile from its location within the layer
+    vec2 location = normal[gl_VertexID] * viewSize;
+    world         = location + origin - offset;
+    gl_Position   = projection * vec4(location, 0.0, 1.0);
+}
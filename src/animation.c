@@ -0,0 +1,380 @@
+#include "internal.h"
+
+#define RPG_ANIMATION_INIT_CAPACITY 8
+
+/**
+ * @brief Displays the current frame of a sprite's animation, and restarts its timer.
+ *
+ * @param sprite The sprite to update.
+ */
+static inline void RPG_Animation_ShowFrame(RPGsprite *sprite)
+{
+    RPGanimframe *frame     = &sprite->animation.clip->frames[sprite->animation.frame];
+    sprite->animation.timer = frame->duration;
+    RPG_Sprite_SetSource(sprite, &frame->rect);
+}
+
+/**
+ * @brief Advances a sprite to the next frame of its animation.
+ *
+ * @param sprite The sprite to advance.
+ * @return RPGbool RPG_TRUE if the animation is still playing, otherwise RPG_FALSE if it has completed.
+ */
+static RPGbool RPG_Animation_Advance(RPGsprite *sprite)
+{
+    RPGanimation *clip = sprite->animation.clip;
+    RPGint next        = sprite->animation.frame + sprite->animation.step;
+    if (next < 0 || next >= clip->count)
+    {
+        switch (clip->mode)
+        {
+            case RPG_ANIMATION_LOOP: next = 0; break;
+            case RPG_ANIMATION_PING_PONG:
+            {
+                sprite->animation.step = -sprite->animation.step;
+                next                   = imax(0, imin(clip->count - 1, sprite->animation.frame + sprite->animation.step));
+                break;
+            }
+            default: return RPG_FALSE;
+        }
+    }
+    sprite->animation.frame = next;
+    RPG_Animation_ShowFrame(sprite);
+    return RPG_TRUE;
+}
+
+/**
+ * @brief Removes the sprite at the specified index from the list of animations by moving the last item into its place.
+ *
+ * @param list The list of animated sprites.
+ * @param index The index to remove.
+ */
+static inline void RPG_Animation_RemoveAt(RPGbatch *list, int index)
+{
+    RPGsprite *sprite         = (RPGsprite *) list->items[index];
+    sprite->animation.playing = RPG_FALSE;
+    list->items[index]        = list->items[--list->total];
+}
+
+void RPG_Animation_UpdateAll(RPGgame *game)
+{
+    // Iterate backwards so completed animations can be removed in place
+    RPGbatch *list = &game->animations;
+    RPGsprite *sprite;
+    for (int i = list->total - 1; i >= 0; i--)
+    {
+        sprite = (RPGsprite *) list->items[i];
+        if (--sprite->animation.timer > 0)
+        {
+            continue;
+        }
+        if (!RPG_Animation_Advance(sprite))
+        {
+            RPG_Animation_RemoveAt(list, i);
+        }
+    }
+}
+
+/**
+ * @brief Removes a sprite from the list of animations, leaving its clip and current frame in place so it can be resumed.
+ *
+ * @param sprite The sprite to stop.
+ */
+static void RPG_Animation_Stop(RPGsprite *sprite)
+{
+    if (!sprite->animation.playing)
+    {
+        return;
+    }
+    RPGbatch *list = &RPG_GAME->animations;
+    for (int i = 0; i < list->total; i++)
+    {
+        if (list->items[i] == &sprite->base.renderable)
+        {
+            RPG_Animation_RemoveAt(list, i);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Changes the clip referenced by a sprite, keeping the list of sprites on each clip current.
+ *
+ * @param sprite The sprite to change.
+ * @param clip The clip to reference, or NULL to release the current one.
+ */
+static void RPG_Animation_SetClip(RPGsprite *sprite, RPGanimation *clip)
+{
+    RPGanimation *previous = sprite->animation.clip;
+    if (previous == clip)
+    {
+        return;
+    }
+    if (previous != NULL)
+    {
+        RPG_Batch_DeleteItem(&previous->sprites, &sprite->base.renderable);
+    }
+    if (clip != NULL)
+    {
+        RPG_Batch_Add(&clip->sprites, &sprite->base.renderable);
+    }
+    sprite->animation.clip = clip;
+}
+
+void RPG_Animation_Detach(RPGsprite *sprite)
+{
+    RPG_Animation_Stop(sprite);
+    RPG_Animation_SetClip(sprite, NULL);
+}
+
+/****************************************************************************************
+ * Animation
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Animation_Create(RPGimage *image, RPG_ANIMATION_MODE mode, RPGanimation **animation)
+{
+    RPG_RETURN_IF_NULL(image);
+    RPG_RETURN_IF_NULL(animation);
+    RPG_ALLOC_ZERO(a, RPGanimation);
+    a->image    = image;
+    a->mode     = mode;
+    a->capacity = RPG_ANIMATION_INIT_CAPACITY;
+    a->frames   = RPG_ALLOC_N(RPGanimframe, RPG_ANIMATION_INIT_CAPACITY);
+    RPG_Batch_Init(&a->sprites);
+    *animation = a;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_CreateFromGrid(RPGimage *image, RPGint columns, RPGint rows, RPGint first, RPGint count, RPGint duration,
+                                        RPG_ANIMATION_MODE mode, RPGanimation **animation)
+{
+    RPG_RETURN_IF_NULL(image);
+    if (columns < 1 || rows < 1 || first < 0 || count < 1 || first + count > columns * rows)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_RESULT result = RPG_Animation_Create(image, mode, animation);
+    if (result)
+    {
+        return result;
+    }
+
+    // Cells are numbered left-to-right, top-to-bottom
+    RPGint w = image->width / columns;
+    RPGint h = image->height / rows;
+    for (RPGint i = first; i < first + count; i++)
+    {
+        RPG_Animation_AddFrame(*animation, (i % columns) * w, (i / columns) * h, w, h, duration);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_Free(RPGanimation *animation)
+{
+    RPG_RETURN_IF_NULL(animation);
+
+    // Stop and release every sprite referencing the animation, including those that are stopped or paused
+    for (int i = 0; i < animation->sprites.total; i++)
+    {
+        RPGsprite *sprite = (RPGsprite *) animation->sprites.items[i];
+        RPG_Animation_Stop(sprite);
+        sprite->animation.clip = NULL;
+    }
+    RPG_Batch_Free(&animation->sprites);
+    RPG_FREE(animation->frames);
+    RPG_FREE(animation);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_AddFrame(RPGanimation *animation, RPGint x, RPGint y, RPGint width, RPGint height, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (duration < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (animation->count == animation->capacity)
+    {
+        animation->capacity *= 2;
+        animation->frames = RPG_REALLOC(animation->frames, sizeof(RPGanimframe) * animation->capacity);
+    }
+    RPGanimframe *frame = &animation->frames[animation->count++];
+    frame->rect         = (RPGrect){x, y, width, height};
+    frame->duration     = duration;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_GetFrameCount(RPGanimation *animation, RPGint *count)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (count != NULL)
+    {
+        *count = animation->count;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_GetFrameDuration(RPGanimation *animation, RPGint index, RPGint *duration)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (index < 0 || index >= animation->count)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (duration != NULL)
+    {
+        *duration = animation->frames[index].duration;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_SetFrameDuration(RPGanimation *animation, RPGint index, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (index < 0 || index >= animation->count || duration < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    animation->frames[index].duration = duration;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_GetImage(RPGanimation *animation, RPGimage **image)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (image != NULL)
+    {
+        *image = animation->image;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_GetMode(RPGanimation *animation, RPG_ANIMATION_MODE *mode)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (mode != NULL)
+    {
+        *mode = animation->mode;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_SetMode(RPGanimation *animation, RPG_ANIMATION_MODE mode)
+{
+    RPG_RETURN_IF_NULL(animation);
+    animation->mode = mode;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_GetUserPointer(RPGanimation *animation, void **user)
+{
+    RPG_RETURN_IF_NULL(animation);
+    if (user != NULL)
+    {
+        *user = animation->user;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Animation_SetUserPointer(RPGanimation *animation, void *user)
+{
+    RPG_RETURN_IF_NULL(animation);
+    animation->user = user;
+    return RPG_NO_ERROR;
+}
+
+/****************************************************************************************
+ * Sprite Playback
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Sprite_Play(RPGsprite *sprite, RPGanimation *animation, RPGbool restart)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    RPG_RETURN_IF_NULL(animation);
+    if (animation->count == 0)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    // Allows the same clip to be requested every update, such as while a direction key is held
+    if (sprite->animation.clip == animation && sprite->animation.playing && !restart)
+    {
+        return RPG_NO_ERROR;
+    }
+
+    // Changing sheets goes through the setter, which flags the picking index that holds the alpha mask of the old image
+    if (sprite->image != animation->image)
+    {
+        RPG_Sprite_SetImage(sprite, animation->image);
+    }
+    RPG_Animation_SetClip(sprite, animation);
+    sprite->animation.frame = 0;
+    sprite->animation.step  = 1;
+    RPG_Animation_ShowFrame(sprite);
+
+    if (!sprite->animation.playing && animation->count > 1)
+    {
+        RPG_Batch_Add(&RPG_GAME->animations, &sprite->base.renderable);
+        sprite->animation.playing = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_Stop(RPGsprite *sprite)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    RPG_Animation_Stop(sprite);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_Resume(RPGsprite *sprite)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    if (sprite->animation.clip != NULL && !sprite->animation.playing)
+    {
+        RPG_Batch_Add(&RPG_GAME->animations, &sprite->base.renderable);
+        sprite->animation.playing = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_GetAnimation(RPGsprite *sprite, RPGanimation **animation)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    if (animation != NULL)
+    {
+        *animation = sprite->animation.clip;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_IsPlaying(RPGsprite *sprite, RPGbool *playing)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    if (playing != NULL)
+    {
+        *playing = sprite->animation.playing;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_GetFrame(RPGsprite *sprite, RPGint *frame)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    if (frame != NULL)
+    {
+        *frame = sprite->animation.frame;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Sprite_SetFrame(RPGsprite *sprite, RPGint frame)
+{
+    RPG_RETURN_IF_NULL(sprite);
+    if (sprite->animation.clip == NULL || frame < 0 || frame >= sprite->animation.clip->count)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    sprite->animation.frame = frame;
+    RPG_Animation_ShowFrame(sprite);
+    return RPG_NO_ERROR;
+}
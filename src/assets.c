@@ -1,20 +1,518 @@
-const char *RPG_TILEMAP_VERTEX = 
+const char *RPG_TILEMAP_VERTEX =
     "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
-    "\x65\x0A\x6F\x75\x74\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
-    "\x73\x3B\x0A\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74"
-    "\x69\x6F\x6E\x3D\x30\x29\x20\x69\x6E\x20\x76\x65\x63\x34\x20\x76"
-    "\x65\x72\x74\x65\x78\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
-    "\x69\x6E\x74\x20\x6D\x61\x70\x57\x69\x64\x74\x68\x3B\x0A\x75\x6E"
+    "\x65\x0A\x70\x72\x65\x63\x69\x73\x69\x6F\x6E\x20\x68\x69\x67\x68"
+    "\x70\x20\x66\x6C\x6F\x61\x74\x3B\x0A\x0A\x6C\x61\x79\x6F\x75\x74"
+    "\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x30\x29\x20\x69"
+    "\x6E\x20\x75\x76\x65\x63\x32\x20\x70\x6F\x73\x69\x74\x69\x6F\x6E"
+    "\x3B\x20\x2F\x2F\x20\x54\x68\x65\x20\x63\x6F\x6C\x75\x6D\x6E\x20"
+    "\x61\x6E\x64\x20\x72\x6F\x77\x20\x6F\x66\x20\x74\x68\x65\x20\x74"
+    "\x69\x6C\x65\x20\x77\x69\x74\x68\x69\x6E\x20\x74\x68\x65\x20\x6D"
+    "\x61\x70\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x31\x29\x20\x69\x6E\x20\x75\x76\x65\x63\x32"
+    "\x20\x74\x69\x6C\x65\x3B\x20\x20\x20\x20\x20\x2F\x2F\x20\x54\x68"
+    "\x65\x20\x69\x6E\x64\x65\x78\x20\x6F\x66\x20\x74\x68\x65\x20\x74"
+    "\x69\x6C\x65\x20\x77\x69\x74\x68\x69\x6E\x20\x69\x74\x73\x20\x74"
+    "\x69\x6C\x65\x73\x65\x74\x2C\x20\x61\x6E\x64\x20\x69\x74\x73\x20"
+    "\x66\x6C\x69\x70\x20\x66\x6C\x61\x67\x73\x20\x61\x6E\x64\x20\x74"
+    "\x69\x6C\x65\x73\x65\x74\x20\x69\x6E\x64\x65\x78\x0A\x0A\x75\x6E"
     "\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74\x34\x20\x70\x72\x6F\x6A\x65"
-    "\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x6D"
-    "\x61\x74\x34\x20\x6D\x6F\x64\x65\x6C\x3B\x0A\x0A\x76\x6F\x69\x64"
-    "\x20\x6D\x61\x69\x6E\x28\x29\x0A\x7B\x0A\x20\x20\x20\x20\x63\x6F"
-    "\x6F\x72\x64\x73\x20\x3D\x20\x76\x65\x72\x74\x65\x78\x2E\x7A\x77"
-    "\x3B\x0A\x20\x20\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F"
-    "\x6E\x20\x3D\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20\x2A"
-    "\x20\x6D\x6F\x64\x65\x6C\x20\x2A\x20\x76\x65\x63\x34\x28\x76\x65"
-    "\x72\x74\x65\x78\x2E\x78\x79\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E"
-    "\x30\x29\x3B\x0A\x7D";
+    "\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76"
+    "\x65\x63\x32\x20\x6F\x72\x69\x67\x69\x6E\x3B\x0A\x75\x6E\x69\x66"
+    "\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x6F\x66\x66\x73\x65\x74\x3B"
+    "\x20\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x6F\x66\x66\x73\x65"
+    "\x74\x20\x6F\x66\x20\x74\x68\x65\x20\x6C\x61\x79\x65\x72\x2C\x20"
+    "\x69\x6E\x20\x70\x69\x78\x65\x6C\x73\x0A\x75\x6E\x69\x66\x6F\x72"
+    "\x6D\x20\x76\x65\x63\x32\x20\x63\x65\x6C\x6C\x53\x69\x7A\x65\x3B"
+    "\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x73\x69\x7A\x65\x20\x6F\x66"
+    "\x20\x61\x20\x6D\x61\x70\x20\x63\x65\x6C\x6C\x2C\x20\x69\x6E\x20"
+    "\x70\x69\x78\x65\x6C\x73\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76"
+    "\x65\x63\x32\x20\x69\x6D\x61\x67\x65\x53\x69\x7A\x65\x3B\x20\x2F"
+    "\x2F\x20\x54\x68\x65\x20\x73\x69\x7A\x65\x20\x6F\x66\x20\x74\x68"
+    "\x65\x20\x61\x74\x6C\x61\x73\x20\x74\x68\x65\x20\x74\x69\x6C\x65"
+    "\x73\x65\x74\x73\x20\x61\x72\x65\x20\x70\x61\x63\x6B\x65\x64\x20"
+    "\x69\x6E\x74\x6F\x2C\x20\x69\x6E\x20\x70\x69\x78\x65\x6C\x73\x0A"
+    "\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x74\x69"
+    "\x6C\x65\x73\x65\x74\x73\x5B\x31\x36\x5D\x3B\x20\x2F\x2F\x20\x54"
+    "\x68\x65\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x6F\x66\x20\x65"
+    "\x61\x63\x68\x20\x74\x69\x6C\x65\x73\x65\x74\x20\x77\x69\x74\x68"
+    "\x69\x6E\x20\x74\x68\x65\x20\x61\x74\x6C\x61\x73\x2C\x20\x61\x6E"
+    "\x64\x20\x74\x68\x65\x20\x73\x69\x7A\x65\x20\x6F\x66\x20\x69\x74"
+    "\x73\x20\x74\x69\x6C\x65\x73\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x69\x76\x65\x63\x34\x20\x6C\x61\x79\x6F\x75\x74\x73\x5B\x31\x36"
+    "\x5D\x3B\x20\x2F\x2F\x20\x54\x68\x65\x20\x63\x6F\x6C\x75\x6D\x6E"
+    "\x73\x2C\x20\x6D\x61\x72\x67\x69\x6E\x20\x61\x6E\x64\x20\x73\x70"
+    "\x61\x63\x69\x6E\x67\x20\x6F\x66\x20\x65\x61\x63\x68\x20\x74\x69"
+    "\x6C\x65\x73\x65\x74\x2C\x20\x61\x6E\x64\x20\x69\x74\x73\x20\x66"
+    "\x69\x72\x73\x74\x20\x65\x6E\x74\x72\x79\x20\x69\x6E\x20\x74\x68"
+    "\x65\x20\x66\x72\x61\x6D\x65\x20\x74\x61\x62\x6C\x65\x0A\x0A\x75"
+    "\x6E\x69\x66\x6F\x72\x6D\x20\x75\x73\x61\x6D\x70\x6C\x65\x72\x42"
+    "\x75\x66\x66\x65\x72\x20\x66\x72\x61\x6D\x65\x73\x3B\x20\x2F\x2F"
+    "\x20\x54\x68\x65\x20\x66\x69\x72\x73\x74\x20\x66\x72\x61\x6D\x65"
+    "\x20\x61\x6E\x64\x20\x66\x72\x61\x6D\x65\x20\x63\x6F\x75\x6E\x74"
+    "\x20\x6F\x66\x20\x65\x61\x63\x68\x20\x74\x69\x6C\x65\x2C\x20\x66"
+    "\x6F\x6C\x6C\x6F\x77\x65\x64\x20\x62\x79\x20\x74\x68\x65\x20\x74"
+    "\x69\x6C\x65\x20\x61\x6E\x64\x20\x65\x6E\x64\x20\x74\x69\x6D\x65"
+    "\x20\x6F\x66\x20\x65\x61\x63\x68\x20\x66\x72\x61\x6D\x65\x0A\x75"
+    "\x6E\x69\x66\x6F\x72\x6D\x20\x62\x6F\x6F\x6C\x20\x61\x6E\x69\x6D"
+    "\x61\x74\x65\x64\x3B\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F"
+    "\x20\x46\x6C\x61\x67\x20\x69\x6E\x64\x69\x63\x61\x74\x69\x6E\x67"
+    "\x20\x74\x68\x65\x20\x74\x69\x6C\x65\x73\x65\x74\x20\x68\x61\x73"
+    "\x20\x61\x6E\x69\x6D\x61\x74\x69\x6F\x6E\x73\x2C\x20\x61\x6E\x64"
+    "\x20\x74\x68\x65\x20\x66\x72\x61\x6D\x65\x20\x74\x61\x62\x6C\x65"
+    "\x20\x69\x73\x20\x62\x6F\x75\x6E\x64\x0A\x75\x6E\x69\x66\x6F\x72"
+    "\x6D\x20\x75\x69\x6E\x74\x20\x74\x69\x6D\x65\x3B\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20"
+    "\x67\x61\x6D\x65\x20\x74\x69\x6D\x65\x2C\x20\x69\x6E\x20\x6D\x69"
+    "\x6C\x6C\x69\x73\x65\x63\x6F\x6E\x64\x73\x0A\x0A\x63\x6F\x6E\x73"
+    "\x74\x20\x75\x69\x6E\x74\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x44"
+    "\x49\x41\x47\x4F\x4E\x41\x4C\x4C\x59\x20\x20\x20\x3D\x20\x31\x75"
+    "\x3B\x0A\x63\x6F\x6E\x73\x74\x20\x75\x69\x6E\x74\x20\x46\x4C\x49"
+    "\x50\x50\x45\x44\x5F\x56\x45\x52\x54\x49\x43\x41\x4C\x4C\x59\x20"
+    "\x20\x20\x3D\x20\x32\x75\x3B\x0A\x63\x6F\x6E\x73\x74\x20\x75\x69"
+    "\x6E\x74\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x48\x4F\x52\x49\x5A"
+    "\x4F\x4E\x54\x41\x4C\x4C\x59\x20\x3D\x20\x34\x75\x3B\x0A\x63\x6F"
+    "\x6E\x73\x74\x20\x75\x69\x6E\x74\x20\x45\x4D\x50\x54\x59\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3D\x20"
+    "\x30\x78\x46\x46\x46\x46\x75\x3B\x20\x2F\x2F\x20\x54\x68\x65\x20"
+    "\x66\x6C\x61\x67\x73\x20\x6F\x66\x20\x61\x6E\x20\x69\x6E\x73\x74"
+    "\x61\x6E\x63\x65\x20\x77\x68\x6F\x73\x65\x20\x63\x65\x6C\x6C\x20"
+    "\x68\x61\x73\x20\x62\x65\x65\x6E\x20\x63\x6C\x65\x61\x72\x65\x64"
+    "\x0A\x0A\x63\x6F\x6E\x73\x74\x20\x76\x65\x63\x32\x20\x6E\x6F\x72"
+    "\x6D\x61\x6C\x5B\x36\x5D\x20\x3D\x20\x76\x65\x63\x32\x5B\x5D\x28"
+    "\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x28\x30\x2E\x30\x2C\x20\x31"
+    "\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x28\x31\x2E"
+    "\x30\x2C\x20\x30\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20\x76\x65\x63"
+    "\x32\x28\x30\x2E\x30\x2C\x20\x30\x2E\x30\x29\x2C\x0A\x20\x20\x20"
+    "\x20\x76\x65\x63\x32\x28\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C"
+    "\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x28\x31\x2E\x30\x2C\x20\x31"
+    "\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x28\x31\x2E"
+    "\x30\x2C\x20\x30\x2E\x30\x29\x0A\x29\x3B\x0A\x0A\x6F\x75\x74\x20"
+    "\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64\x73\x3B\x0A\x0A\x76\x6F"
+    "\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"
+    "\x2F\x2F\x20\x43\x6C\x65\x61\x72\x65\x64\x20\x63\x65\x6C\x6C\x73"
+    "\x20\x6B\x65\x65\x70\x20\x74\x68\x65\x69\x72\x20\x69\x6E\x73\x74"
+    "\x61\x6E\x63\x65\x20\x75\x6E\x74\x69\x6C\x20\x74\x68\x65\x20\x6C"
+    "\x61\x79\x65\x72\x20\x69\x73\x20\x6C\x61\x69\x64\x20\x6F\x75\x74"
+    "\x20\x61\x67\x61\x69\x6E\x2C\x20\x61\x6E\x64\x20\x61\x72\x65\x20"
+    "\x70\x6C\x61\x63\x65\x64\x20\x6F\x75\x74\x73\x69\x64\x65\x20\x74"
+    "\x68\x65\x20\x63\x6C\x69\x70\x20\x76\x6F\x6C\x75\x6D\x65\x0A\x20"
+    "\x20\x20\x20\x69\x66\x20\x28\x74\x69\x6C\x65\x2E\x79\x20\x3D\x3D"
+    "\x20\x45\x4D\x50\x54\x59\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20"
+    "\x76\x65\x63\x34\x28\x32\x2E\x30\x2C\x20\x32\x2E\x30\x2C\x20\x32"
+    "\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x7D\x0A"
+    "\x20\x20\x20\x20\x76\x65\x63\x32\x20\x63\x6F\x72\x6E\x65\x72\x20"
+    "\x3D\x20\x6E\x6F\x72\x6D\x61\x6C\x5B\x67\x6C\x5F\x56\x65\x72\x74"
+    "\x65\x78\x49\x44\x5D\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x46"
+    "\x6C\x69\x70\x73\x20\x61\x72\x65\x20\x61\x70\x70\x6C\x69\x65\x64"
+    "\x20\x74\x6F\x20\x74\x68\x65\x20\x69\x6D\x61\x67\x65\x20\x69\x6E"
+    "\x20\x74\x68\x65\x20\x6F\x72\x64\x65\x72\x20\x64\x69\x61\x67\x6F"
+    "\x6E\x61\x6C\x2C\x20\x68\x6F\x72\x69\x7A\x6F\x6E\x74\x61\x6C\x2C"
+    "\x20\x76\x65\x72\x74\x69\x63\x61\x6C\x2C\x20\x73\x6F\x20\x61\x72"
+    "\x65\x20\x75\x6E\x64\x6F\x6E\x65\x20\x69\x6E\x20\x72\x65\x76\x65"
+    "\x72\x73\x65\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x20\x75\x76\x20"
+    "\x3D\x20\x63\x6F\x72\x6E\x65\x72\x3B\x0A\x20\x20\x20\x20\x69\x66"
+    "\x20\x28\x28\x74\x69\x6C\x65\x2E\x79\x20\x26\x20\x46\x4C\x49\x50"
+    "\x50\x45\x44\x5F\x48\x4F\x52\x49\x5A\x4F\x4E\x54\x41\x4C\x4C\x59"
+    "\x29\x20\x21\x3D\x20\x30\x75\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x75\x76\x2E\x78\x20\x3D\x20\x31\x2E\x30\x20\x2D\x20"
+    "\x75\x76\x2E\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"
+    "\x69\x66\x20\x28\x28\x74\x69\x6C\x65\x2E\x79\x20\x26\x20\x46\x4C"
+    "\x49\x50\x50\x45\x44\x5F\x56\x45\x52\x54\x49\x43\x41\x4C\x4C\x59"
+    "\x29\x20\x21\x3D\x20\x30\x75\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x75\x76\x2E\x79\x20\x3D\x20\x31\x2E\x30\x20\x2D\x20"
+    "\x75\x76\x2E\x79\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"
+    "\x69\x66\x20\x28\x28\x74\x69\x6C\x65\x2E\x79\x20\x26\x20\x46\x4C"
+    "\x49\x50\x50\x45\x44\x5F\x44\x49\x41\x47\x4F\x4E\x41\x4C\x4C\x59"
+    "\x29\x20\x21\x3D\x20\x30\x75\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x75\x76\x20\x3D\x20\x75\x76\x2E\x79\x78\x3B\x0A\x20"
+    "\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x6E\x74\x20\x73\x65"
+    "\x74\x20\x20\x20\x20\x20\x3D\x20\x69\x6E\x74\x28\x74\x69\x6C\x65"
+    "\x2E\x79\x20\x3E\x3E\x20\x33\x75\x29\x3B\x0A\x20\x20\x20\x20\x76"
+    "\x65\x63\x34\x20\x72\x65\x67\x69\x6F\x6E\x20\x3D\x20\x74\x69\x6C"
+    "\x65\x73\x65\x74\x73\x5B\x73\x65\x74\x5D\x3B\x0A\x20\x20\x20\x20"
+    "\x69\x76\x65\x63\x34\x20\x67\x72\x69\x64\x20\x20\x3D\x20\x6C\x61"
+    "\x79\x6F\x75\x74\x73\x5B\x73\x65\x74\x5D\x3B\x0A\x0A\x20\x20\x20"
+    "\x20\x2F\x2F\x20\x46\x69\x6E\x64\x20\x74\x68\x65\x20\x66\x72\x61"
+    "\x6D\x65\x20\x6F\x66\x20\x61\x6E\x20\x61\x6E\x69\x6D\x61\x74\x65"
+    "\x64\x20\x74\x69\x6C\x65\x2C\x20\x74\x68\x65\x20\x66\x72\x61\x6D"
+    "\x65\x73\x20\x61\x72\x65\x20\x66\x65\x77\x20\x61\x6E\x64\x20\x61"
+    "\x72\x65\x20\x73\x65\x61\x72\x63\x68\x65\x64\x20\x6C\x69\x6E\x65"
+    "\x61\x72\x6C\x79\x0A\x20\x20\x20\x20\x75\x69\x6E\x74\x20\x69\x64"
+    "\x20\x3D\x20\x74\x69\x6C\x65\x2E\x78\x3B\x0A\x20\x20\x20\x20\x69"
+    "\x66\x20\x28\x61\x6E\x69\x6D\x61\x74\x65\x64\x29\x20\x7B\x0A\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x75\x76\x65\x63\x32\x20\x73\x65\x71"
+    "\x75\x65\x6E\x63\x65\x20\x3D\x20\x74\x65\x78\x65\x6C\x46\x65\x74"
+    "\x63\x68\x28\x66\x72\x61\x6D\x65\x73\x2C\x20\x67\x72\x69\x64\x2E"
+    "\x77\x20\x2B\x20\x69\x6E\x74\x28\x69\x64\x29\x29\x2E\x78\x79\x3B"
+    "\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x71"
+    "\x75\x65\x6E\x63\x65\x2E\x79\x20\x3E\x20\x30\x75\x29\x20\x7B\x0A"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x75\x69\x6E\x74"
+    "\x20\x6C\x61\x73\x74\x20\x20\x20\x20\x3D\x20\x73\x65\x71\x75\x65"
+    "\x6E\x63\x65\x2E\x78\x20\x2B\x20\x73\x65\x71\x75\x65\x6E\x63\x65"
+    "\x2E\x79\x20\x2D\x20\x31\x75\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x75\x69\x6E\x74\x20\x65\x6C\x61\x70\x73\x65"
+    "\x64\x20\x3D\x20\x74\x69\x6D\x65\x20\x25\x20\x74\x65\x78\x65\x6C"
+    "\x46\x65\x74\x63\x68\x28\x66\x72\x61\x6D\x65\x73\x2C\x20\x69\x6E"
+    "\x74\x28\x6C\x61\x73\x74\x29\x29\x2E\x79\x3B\x0A\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x75\x69\x6E\x74\x20\x66\x72\x61"
+    "\x6D\x65\x20\x20\x20\x3D\x20\x73\x65\x71\x75\x65\x6E\x63\x65\x2E"
+    "\x78\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"
+    "\x68\x69\x6C\x65\x20\x28\x66\x72\x61\x6D\x65\x20\x3C\x20\x6C\x61"
+    "\x73\x74\x20\x26\x26\x20\x65\x6C\x61\x70\x73\x65\x64\x20\x3E\x3D"
+    "\x20\x74\x65\x78\x65\x6C\x46\x65\x74\x63\x68\x28\x66\x72\x61\x6D"
+    "\x65\x73\x2C\x20\x69\x6E\x74\x28\x66\x72\x61\x6D\x65\x29\x29\x2E"
+    "\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x66\x72\x61\x6D\x65\x2B\x2B\x3B\x0A\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x20\x3D\x20\x74\x65\x78"
+    "\x65\x6C\x46\x65\x74\x63\x68\x28\x66\x72\x61\x6D\x65\x73\x2C\x20"
+    "\x69\x6E\x74\x28\x66\x72\x61\x6D\x65\x29\x29\x2E\x78\x3B\x0A\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A"
+    "\x20\x20\x20\x20\x2F\x2F\x20\x53\x61\x6D\x70\x6C\x65\x20\x66\x72"
+    "\x6F\x6D\x20\x74\x65\x78\x65\x6C\x20\x63\x65\x6E\x74\x65\x72\x73"
+    "\x20\x74\x6F\x20\x70\x72\x65\x76\x65\x6E\x74\x20\x62\x6C\x65\x65"
+    "\x64\x69\x6E\x67\x20\x66\x72\x6F\x6D\x20\x6E\x65\x69\x67\x68\x62"
+    "\x6F\x72\x69\x6E\x67\x20\x74\x69\x6C\x65\x73\x0A\x20\x20\x20\x20"
+    "\x69\x6E\x74\x20\x69\x6E\x64\x65\x78\x20\x20\x20\x20\x20\x3D\x20"
+    "\x69\x6E\x74\x28\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x76\x65\x63"
+    "\x32\x20\x73\x6F\x75\x72\x63\x65\x20\x20\x20\x3D\x20\x72\x65\x67"
+    "\x69\x6F\x6E\x2E\x78\x79\x20\x2B\x20\x76\x65\x63\x32\x28\x67\x72"
+    "\x69\x64\x2E\x79\x29\x20\x2B\x20\x76\x65\x63\x32\x28\x69\x6E\x64"
+    "\x65\x78\x20\x25\x20\x67\x72\x69\x64\x2E\x78\x2C\x20\x69\x6E\x64"
+    "\x65\x78\x20\x2F\x20\x67\x72\x69\x64\x2E\x78\x29\x20\x2A\x20\x28"
+    "\x72\x65\x67\x69\x6F\x6E\x2E\x7A\x77\x20\x2B\x20\x66\x6C\x6F\x61"
+    "\x74\x28\x67\x72\x69\x64\x2E\x7A\x29\x29\x3B\x0A\x20\x20\x20\x20"
+    "\x63\x6F\x6F\x72\x64\x73\x20\x20\x20\x20\x20\x20\x20\x20\x3D\x20"
+    "\x28\x73\x6F\x75\x72\x63\x65\x20\x2B\x20\x30\x2E\x35\x20\x2B\x20"
+    "\x75\x76\x20\x2A\x20\x28\x72\x65\x67\x69\x6F\x6E\x2E\x7A\x77\x20"
+    "\x2D\x20\x31\x2E\x30\x29\x29\x20\x2F\x20\x69\x6D\x61\x67\x65\x53"
+    "\x69\x7A\x65\x3B\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x20\x6C\x6F"
+    "\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x28\x76\x65\x63\x32\x28\x70"
+    "\x6F\x73\x69\x74\x69\x6F\x6E\x29\x20\x2B\x20\x63\x6F\x72\x6E\x65"
+    "\x72\x29\x20\x2A\x20\x63\x65\x6C\x6C\x53\x69\x7A\x65\x20\x2B\x20"
+    "\x6F\x66\x66\x73\x65\x74\x20\x2D\x20\x6F\x72\x69\x67\x69\x6E\x3B"
+    "\x0A\x20\x20\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E"
+    "\x20\x20\x20\x3D\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20"
+    "\x2A\x20\x76\x65\x63\x34\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x2C"
+    "\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_TILEMAP_INDEXED_VERTEX =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74\x34\x20"
+    "\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E\x69\x66"
+    "\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x6F\x72\x69\x67\x69\x6E\x3B"
+    "\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x6F\x66"
+    "\x66\x73\x65\x74\x3B\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x6F"
+    "\x66\x66\x73\x65\x74\x20\x6F\x66\x20\x74\x68\x65\x20\x6C\x61\x79"
+    "\x65\x72\x2C\x20\x69\x6E\x20\x70\x69\x78\x65\x6C\x73\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x76\x69\x65\x77\x53"
+    "\x69\x7A\x65\x3B\x20\x2F\x2F\x20\x54\x68\x65\x20\x73\x69\x7A\x65"
+    "\x20\x6F\x66\x20\x74\x68\x65\x20\x76\x69\x65\x77\x2C\x20\x69\x6E"
+    "\x20\x70\x69\x78\x65\x6C\x73\x0A\x0A\x63\x6F\x6E\x73\x74\x20\x76"
+    "\x65\x63\x32\x20\x6E\x6F\x72\x6D\x61\x6C\x5B\x36\x5D\x20\x3D\x20"
+    "\x76\x65\x63\x32\x5B\x5D\x28\x0A\x20\x20\x20\x20\x76\x65\x63\x32"
+    "\x28\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20"
+    "\x76\x65\x63\x32\x28\x31\x2E\x30\x2C\x20\x30\x2E\x30\x29\x2C\x0A"
+    "\x20\x20\x20\x20\x76\x65\x63\x32\x28\x30\x2E\x30\x2C\x20\x30\x2E"
+    "\x30\x29\x2C\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x28\x30\x2E\x30"
+    "\x2C\x20\x31\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20\x76\x65\x63\x32"
+    "\x28\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x0A\x20\x20\x20\x20"
+    "\x76\x65\x63\x32\x28\x31\x2E\x30\x2C\x20\x30\x2E\x30\x29\x0A\x29"
+    "\x3B\x0A\x0A\x6F\x75\x74\x20\x76\x65\x63\x32\x20\x77\x6F\x72\x6C"
+    "\x64\x3B\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x2F\x2F\x20\x41\x20\x73\x69\x6E\x67\x6C"
+    "\x65\x20\x71\x75\x61\x64\x20\x63\x6F\x76\x65\x72\x73\x20\x74\x68"
+    "\x65\x20\x76\x69\x65\x77\x2C\x20\x61\x6E\x64\x20\x65\x61\x63\x68"
+    "\x20\x66\x72\x61\x67\x6D\x65\x6E\x74\x20\x66\x69\x6E\x64\x73\x20"
+    "\x69\x74\x73\x20\x74\x69\x6C\x65\x20\x66\x72\x6F\x6D\x20\x69\x74"
+    "\x73\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x77\x69\x74\x68\x69"
+    "\x6E\x20\x74\x68\x65\x20\x6C\x61\x79\x65\x72\x0A\x20\x20\x20\x20"
+    "\x76\x65\x63\x32\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20"
+    "\x6E\x6F\x72\x6D\x61\x6C\x5B\x67\x6C\x5F\x56\x65\x72\x74\x65\x78"
+    "\x49\x44\x5D\x20\x2A\x20\x76\x69\x65\x77\x53\x69\x7A\x65\x3B\x0A"
+    "\x20\x20\x20\x20\x77\x6F\x72\x6C\x64\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x3D\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x2B\x20\x6F"
+    "\x72\x69\x67\x69\x6E\x20\x2D\x20\x6F\x66\x66\x73\x65\x74\x3B\x0A"
+    "\x20\x20\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20"
+    "\x20\x20\x3D\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20\x2A"
+    "\x20\x76\x65\x63\x34\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x2C\x20"
+    "\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_TILEMAP_INDEXED_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x77\x6F\x72\x6C\x64"
+    "\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75\x6C"
+    "\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D\x70"
+    "\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x20\x20\x20\x20"
+    "\x20\x2F\x2F\x20\x54\x68\x65\x20\x61\x74\x6C\x61\x73\x20\x74\x68"
+    "\x65\x20\x74\x69\x6C\x65\x73\x65\x74\x73\x20\x61\x72\x65\x20\x70"
+    "\x61\x63\x6B\x65\x64\x20\x69\x6E\x74\x6F\x0A\x75\x6E\x69\x66\x6F"
+    "\x72\x6D\x20\x75\x73\x61\x6D\x70\x6C\x65\x72\x32\x44\x20\x69\x6E"
+    "\x64\x69\x63\x65\x73\x3B\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x74"
+    "\x69\x6C\x65\x20\x69\x6E\x64\x65\x78\x2C\x20\x61\x6E\x64\x20\x66"
+    "\x6C\x69\x70\x20\x66\x6C\x61\x67\x73\x20\x61\x6E\x64\x20\x74\x69"
+    "\x6C\x65\x73\x65\x74\x20\x69\x6E\x64\x65\x78\x2C\x20\x6F\x66\x20"
+    "\x65\x61\x63\x68\x20\x63\x65\x6C\x6C\x20\x6F\x66\x20\x74\x68\x65"
+    "\x20\x6C\x61\x79\x65\x72\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76"
+    "\x65\x63\x32\x20\x63\x65\x6C\x6C\x53\x69\x7A\x65\x3B\x20\x20\x20"
+    "\x20\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x73\x69\x7A\x65\x20"
+    "\x6F\x66\x20\x61\x20\x6D\x61\x70\x20\x63\x65\x6C\x6C\x2C\x20\x69"
+    "\x6E\x20\x70\x69\x78\x65\x6C\x73\x0A\x75\x6E\x69\x66\x6F\x72\x6D"
+    "\x20\x76\x65\x63\x32\x20\x69\x6D\x61\x67\x65\x53\x69\x7A\x65\x3B"
+    "\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x73\x69\x7A"
+    "\x65\x20\x6F\x66\x20\x74\x68\x65\x20\x61\x74\x6C\x61\x73\x2C\x20"
+    "\x69\x6E\x20\x70\x69\x78\x65\x6C\x73\x0A\x75\x6E\x69\x66\x6F\x72"
+    "\x6D\x20\x76\x65\x63\x34\x20\x74\x69\x6C\x65\x73\x65\x74\x73\x5B"
+    "\x31\x36\x5D\x3B\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x6C\x6F"
+    "\x63\x61\x74\x69\x6F\x6E\x20\x6F\x66\x20\x65\x61\x63\x68\x20\x74"
+    "\x69\x6C\x65\x73\x65\x74\x20\x77\x69\x74\x68\x69\x6E\x20\x74\x68"
+    "\x65\x20\x61\x74\x6C\x61\x73\x2C\x20\x61\x6E\x64\x20\x74\x68\x65"
+    "\x20\x73\x69\x7A\x65\x20\x6F\x66\x20\x69\x74\x73\x20\x74\x69\x6C"
+    "\x65\x73\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x69\x76\x65\x63\x34"
+    "\x20\x6C\x61\x79\x6F\x75\x74\x73\x5B\x31\x36\x5D\x3B\x20\x20\x20"
+    "\x2F\x2F\x20\x54\x68\x65\x20\x63\x6F\x6C\x75\x6D\x6E\x73\x2C\x20"
+    "\x6D\x61\x72\x67\x69\x6E\x20\x61\x6E\x64\x20\x73\x70\x61\x63\x69"
+    "\x6E\x67\x20\x6F\x66\x20\x65\x61\x63\x68\x20\x74\x69\x6C\x65\x73"
+    "\x65\x74\x2C\x20\x61\x6E\x64\x20\x69\x74\x73\x20\x66\x69\x72\x73"
+    "\x74\x20\x65\x6E\x74\x72\x79\x20\x69\x6E\x20\x74\x68\x65\x20\x66"
+    "\x72\x61\x6D\x65\x20\x74\x61\x62\x6C\x65\x0A\x0A\x75\x6E\x69\x66"
+    "\x6F\x72\x6D\x20\x75\x73\x61\x6D\x70\x6C\x65\x72\x42\x75\x66\x66"
+    "\x65\x72\x20\x66\x72\x61\x6D\x65\x73\x3B\x20\x2F\x2F\x20\x54\x68"
+    "\x65\x20\x66\x69\x72\x73\x74\x20\x66\x72\x61\x6D\x65\x20\x61\x6E"
+    "\x64\x20\x66\x72\x61\x6D\x65\x20\x63\x6F\x75\x6E\x74\x20\x6F\x66"
+    "\x20\x65\x61\x63\x68\x20\x74\x69\x6C\x65\x2C\x20\x66\x6F\x6C\x6C"
+    "\x6F\x77\x65\x64\x20\x62\x79\x20\x74\x68\x65\x20\x74\x69\x6C\x65"
+    "\x20\x61\x6E\x64\x20\x65\x6E\x64\x20\x74\x69\x6D\x65\x20\x6F\x66"
+    "\x20\x65\x61\x63\x68\x20\x66\x72\x61\x6D\x65\x0A\x75\x6E\x69\x66"
+    "\x6F\x72\x6D\x20\x62\x6F\x6F\x6C\x20\x61\x6E\x69\x6D\x61\x74\x65"
+    "\x64\x3B\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x46\x6C"
+    "\x61\x67\x20\x69\x6E\x64\x69\x63\x61\x74\x69\x6E\x67\x20\x74\x68"
+    "\x65\x20\x74\x69\x6C\x65\x73\x65\x74\x73\x20\x68\x61\x76\x65\x20"
+    "\x61\x6E\x69\x6D\x61\x74\x69\x6F\x6E\x73\x2C\x20\x61\x6E\x64\x20"
+    "\x74\x68\x65\x20\x66\x72\x61\x6D\x65\x20\x74\x61\x62\x6C\x65\x20"
+    "\x69\x73\x20\x62\x6F\x75\x6E\x64\x0A\x75\x6E\x69\x66\x6F\x72\x6D"
+    "\x20\x75\x69\x6E\x74\x20\x74\x69\x6D\x65\x3B\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x54\x68\x65\x20\x67"
+    "\x61\x6D\x65\x20\x74\x69\x6D\x65\x2C\x20\x69\x6E\x20\x6D\x69\x6C"
+    "\x6C\x69\x73\x65\x63\x6F\x6E\x64\x73\x0A\x0A\x75\x6E\x69\x66\x6F"
+    "\x72\x6D\x20\x76\x65\x63\x34\x20\x63\x6F\x6C\x6F\x72\x3B\x0A\x75"
+    "\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x74\x6F\x6E\x65"
+    "\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x66"
+    "\x6C\x61\x73\x68\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x66\x6C"
+    "\x6F\x61\x74\x20\x61\x6C\x70\x68\x61\x3B\x0A\x75\x6E\x69\x66\x6F"
+    "\x72\x6D\x20\x66\x6C\x6F\x61\x74\x20\x68\x75\x65\x3B\x0A\x0A\x63"
+    "\x6F\x6E\x73\x74\x20\x75\x69\x6E\x74\x20\x45\x4D\x50\x54\x59\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3D"
+    "\x20\x30\x78\x46\x46\x46\x46\x75\x3B\x0A\x63\x6F\x6E\x73\x74\x20"
+    "\x75\x69\x6E\x74\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x44\x49\x41"
+    "\x47\x4F\x4E\x41\x4C\x4C\x59\x20\x20\x20\x3D\x20\x31\x75\x3B\x0A"
+    "\x63\x6F\x6E\x73\x74\x20\x75\x69\x6E\x74\x20\x46\x4C\x49\x50\x50"
+    "\x45\x44\x5F\x56\x45\x52\x54\x49\x43\x41\x4C\x4C\x59\x20\x20\x20"
+    "\x3D\x20\x32\x75\x3B\x0A\x63\x6F\x6E\x73\x74\x20\x75\x69\x6E\x74"
+    "\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x48\x4F\x52\x49\x5A\x4F\x4E"
+    "\x54\x41\x4C\x4C\x59\x20\x3D\x20\x34\x75\x3B\x0A\x0A\x76\x65\x63"
+    "\x33\x20\x68\x75\x65\x5F\x73\x68\x69\x66\x74\x28\x76\x65\x63\x33"
+    "\x20\x63\x6F\x6C\x6F\x72\x2C\x20\x66\x6C\x6F\x61\x74\x20\x68\x75"
+    "\x65\x41\x64\x6A\x75\x73\x74\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20"
+    "\x63\x6F\x6E\x73\x74\x20\x76\x65\x63\x33\x20\x6B\x52\x47\x42\x54"
+    "\x6F\x59\x50\x72\x69\x6D\x65\x20\x3D\x20\x76\x65\x63\x33\x28\x30"
+    "\x2E\x32\x39\x39\x2C\x20\x30\x2E\x35\x38\x37\x2C\x20\x30\x2E\x31"
+    "\x31\x34\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x74\x20\x76"
+    "\x65\x63\x33\x20\x6B\x52\x47\x42\x54\x6F\x49\x20\x20\x20\x20\x20"
+    "\x20\x3D\x20\x76\x65\x63\x33\x28\x30\x2E\x35\x39\x36\x2C\x20\x2D"
+    "\x30\x2E\x32\x37\x35\x2C\x20\x2D\x30\x2E\x33\x32\x31\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x63\x6F\x6E\x73\x74\x20\x76\x65\x63\x33\x20\x6B"
+    "\x52\x47\x42\x54\x6F\x51\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65"
+    "\x63\x33\x28\x30\x2E\x32\x31\x32\x2C\x20\x2D\x30\x2E\x35\x32\x33"
+    "\x2C\x20\x30\x2E\x33\x31\x31\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"
+    "\x6E\x73\x74\x20\x76\x65\x63\x33\x20\x6B\x59\x49\x51\x54\x6F\x52"
+    "\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65\x63\x33\x28\x31\x2E\x30"
+    "\x2C\x20\x30\x2E\x39\x35\x36\x2C\x20\x30\x2E\x36\x32\x31\x29\x3B"
+    "\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x74\x20\x76\x65\x63\x33\x20"
+    "\x6B\x59\x49\x51\x54\x6F\x47\x20\x20\x20\x20\x20\x20\x3D\x20\x76"
+    "\x65\x63\x33\x28\x31\x2E\x30\x2C\x20\x2D\x30\x2E\x32\x37\x32\x2C"
+    "\x20\x2D\x30\x2E\x36\x34\x37\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"
+    "\x6E\x73\x74\x20\x76\x65\x63\x33\x20\x6B\x59\x49\x51\x54\x6F\x42"
+    "\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65\x63\x33\x28\x31\x2E\x30"
+    "\x2C\x20\x2D\x31\x2E\x31\x30\x37\x2C\x20\x31\x2E\x37\x30\x34\x29"
+    "\x3B\x0A\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x59\x50\x72"
+    "\x69\x6D\x65\x20\x3D\x20\x64\x6F\x74\x28\x63\x6F\x6C\x6F\x72\x2C"
+    "\x20\x6B\x52\x47\x42\x54\x6F\x59\x50\x72\x69\x6D\x65\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x49\x20\x20\x20\x20\x20"
+    "\x20\x3D\x20\x64\x6F\x74\x28\x63\x6F\x6C\x6F\x72\x2C\x20\x6B\x52"
+    "\x47\x42\x54\x6F\x49\x29\x3B\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61"
+    "\x74\x20\x51\x20\x20\x20\x20\x20\x20\x3D\x20\x64\x6F\x74\x28\x63"
+    "\x6F\x6C\x6F\x72\x2C\x20\x6B\x52\x47\x42\x54\x6F\x51\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x68\x20\x20\x20\x20\x20"
+    "\x20\x3D\x20\x61\x74\x61\x6E\x28\x51\x2C\x20\x49\x29\x3B\x0A\x20"
+    "\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x63\x68\x72\x6F\x6D\x61\x20"
+    "\x3D\x20\x73\x71\x72\x74\x28\x49\x20\x2A\x20\x49\x20\x2B\x20\x51"
+    "\x20\x2A\x20\x51\x29\x3B\x0A\x0A\x20\x20\x20\x20\x68\x20\x2B\x3D"
+    "\x20\x72\x61\x64\x69\x61\x6E\x73\x28\x68\x75\x65\x29\x3B\x0A\x20"
+    "\x20\x20\x20\x51\x20\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x63\x68"
+    "\x72\x6F\x6D\x61\x20\x2A\x20\x73\x69\x6E\x28\x68\x29\x3B\x0A\x20"
+    "\x20\x20\x20\x49\x20\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x63\x68"
+    "\x72\x6F\x6D\x61\x20\x2A\x20\x63\x6F\x73\x28\x68\x29\x3B\x0A\x20"
+    "\x20\x20\x20\x76\x65\x63\x33\x20\x79\x49\x51\x20\x3D\x20\x76\x65"
+    "\x63\x33\x28\x59\x50\x72\x69\x6D\x65\x2C\x20\x49\x2C\x20\x51\x29"
+    "\x3B\x0A\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x76\x65\x63"
+    "\x33\x28\x64\x6F\x74\x28\x79\x49\x51\x2C\x20\x6B\x59\x49\x51\x54"
+    "\x6F\x52\x29\x2C\x20\x64\x6F\x74\x28\x79\x49\x51\x2C\x20\x6B\x59"
+    "\x49\x51\x54\x6F\x47\x29\x2C\x20\x64\x6F\x74\x28\x79\x49\x51\x2C"
+    "\x20\x6B\x59\x49\x51\x54\x6F\x42\x29\x29\x3B\x0A\x7D\x0A\x0A\x76"
+    "\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20"
+    "\x20\x69\x76\x65\x63\x32\x20\x63\x65\x6C\x6C\x20\x3D\x20\x69\x76"
+    "\x65\x63\x32\x28\x66\x6C\x6F\x6F\x72\x28\x77\x6F\x72\x6C\x64\x20"
+    "\x2F\x20\x63\x65\x6C\x6C\x53\x69\x7A\x65\x29\x29\x3B\x0A\x20\x20"
+    "\x20\x20\x69\x66\x20\x28\x61\x6E\x79\x28\x6C\x65\x73\x73\x54\x68"
+    "\x61\x6E\x28\x63\x65\x6C\x6C\x2C\x20\x69\x76\x65\x63\x32\x28\x30"
+    "\x29\x29\x29\x20\x7C\x7C\x20\x61\x6E\x79\x28\x67\x72\x65\x61\x74"
+    "\x65\x72\x54\x68\x61\x6E\x45\x71\x75\x61\x6C\x28\x63\x65\x6C\x6C"
+    "\x2C\x20\x74\x65\x78\x74\x75\x72\x65\x53\x69\x7A\x65\x28\x69\x6E"
+    "\x64\x69\x63\x65\x73\x2C\x20\x30\x29\x29\x29\x29\x20\x7B\x0A\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x64\x69\x73\x63\x61\x72\x64\x3B\x0A"
+    "\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x75\x76\x65\x63\x32\x20"
+    "\x74\x69\x6C\x65\x20\x3D\x20\x74\x65\x78\x65\x6C\x46\x65\x74\x63"
+    "\x68\x28\x69\x6E\x64\x69\x63\x65\x73\x2C\x20\x63\x65\x6C\x6C\x2C"
+    "\x20\x30\x29\x2E\x78\x79\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28"
+    "\x74\x69\x6C\x65\x2E\x79\x20\x3D\x3D\x20\x45\x4D\x50\x54\x59\x29"
+    "\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x64\x69\x73\x63\x61"
+    "\x72\x64\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F"
+    "\x2F\x20\x46\x6C\x69\x70\x73\x20\x61\x72\x65\x20\x61\x70\x70\x6C"
+    "\x69\x65\x64\x20\x74\x6F\x20\x74\x68\x65\x20\x69\x6D\x61\x67\x65"
+    "\x20\x69\x6E\x20\x74\x68\x65\x20\x6F\x72\x64\x65\x72\x20\x64\x69"
+    "\x61\x67\x6F\x6E\x61\x6C\x2C\x20\x68\x6F\x72\x69\x7A\x6F\x6E\x74"
+    "\x61\x6C\x2C\x20\x76\x65\x72\x74\x69\x63\x61\x6C\x2C\x20\x73\x6F"
+    "\x20\x61\x72\x65\x20\x75\x6E\x64\x6F\x6E\x65\x20\x69\x6E\x20\x72"
+    "\x65\x76\x65\x72\x73\x65\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x20"
+    "\x75\x76\x20\x3D\x20\x28\x77\x6F\x72\x6C\x64\x20\x2D\x20\x76\x65"
+    "\x63\x32\x28\x63\x65\x6C\x6C\x29\x20\x2A\x20\x63\x65\x6C\x6C\x53"
+    "\x69\x7A\x65\x29\x20\x2F\x20\x63\x65\x6C\x6C\x53\x69\x7A\x65\x3B"
+    "\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x28\x74\x69\x6C\x65\x2E\x79"
+    "\x20\x26\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x48\x4F\x52\x49\x5A"
+    "\x4F\x4E\x54\x41\x4C\x4C\x59\x29\x20\x21\x3D\x20\x30\x75\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x75\x76\x2E\x78\x20\x3D"
+    "\x20\x31\x2E\x30\x20\x2D\x20\x75\x76\x2E\x78\x3B\x0A\x20\x20\x20"
+    "\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x28\x74\x69\x6C\x65"
+    "\x2E\x79\x20\x26\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x56\x45\x52"
+    "\x54\x49\x43\x41\x4C\x4C\x59\x29\x20\x21\x3D\x20\x30\x75\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x75\x76\x2E\x79\x20\x3D"
+    "\x20\x31\x2E\x30\x20\x2D\x20\x75\x76\x2E\x79\x3B\x0A\x20\x20\x20"
+    "\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x28\x74\x69\x6C\x65"
+    "\x2E\x79\x20\x26\x20\x46\x4C\x49\x50\x50\x45\x44\x5F\x44\x49\x41"
+    "\x47\x4F\x4E\x41\x4C\x4C\x59\x29\x20\x21\x3D\x20\x30\x75\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x75\x76\x20\x3D\x20\x75"
+    "\x76\x2E\x79\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"
+    "\x20\x69\x6E\x74\x20\x73\x65\x74\x20\x20\x20\x20\x20\x3D\x20\x69"
+    "\x6E\x74\x28\x74\x69\x6C\x65\x2E\x79\x20\x3E\x3E\x20\x33\x75\x29"
+    "\x3B\x0A\x20\x20\x20\x20\x76\x65\x63\x34\x20\x72\x65\x67\x69\x6F"
+    "\x6E\x20\x3D\x20\x74\x69\x6C\x65\x73\x65\x74\x73\x5B\x73\x65\x74"
+    "\x5D\x3B\x0A\x20\x20\x20\x20\x69\x76\x65\x63\x34\x20\x67\x72\x69"
+    "\x64\x20\x20\x3D\x20\x6C\x61\x79\x6F\x75\x74\x73\x5B\x73\x65\x74"
+    "\x5D\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x46\x69\x6E\x64\x20"
+    "\x74\x68\x65\x20\x66\x72\x61\x6D\x65\x20\x6F\x66\x20\x61\x6E\x20"
+    "\x61\x6E\x69\x6D\x61\x74\x65\x64\x20\x74\x69\x6C\x65\x2C\x20\x74"
+    "\x68\x65\x20\x66\x72\x61\x6D\x65\x73\x20\x61\x72\x65\x20\x66\x65"
+    "\x77\x20\x61\x6E\x64\x20\x61\x72\x65\x20\x73\x65\x61\x72\x63\x68"
+    "\x65\x64\x20\x6C\x69\x6E\x65\x61\x72\x6C\x79\x0A\x20\x20\x20\x20"
+    "\x75\x69\x6E\x74\x20\x69\x64\x20\x3D\x20\x74\x69\x6C\x65\x2E\x78"
+    "\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6E\x69\x6D\x61\x74"
+    "\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x75\x76"
+    "\x65\x63\x32\x20\x73\x65\x71\x75\x65\x6E\x63\x65\x20\x3D\x20\x74"
+    "\x65\x78\x65\x6C\x46\x65\x74\x63\x68\x28\x66\x72\x61\x6D\x65\x73"
+    "\x2C\x20\x67\x72\x69\x64\x2E\x77\x20\x2B\x20\x69\x6E\x74\x28\x69"
+    "\x64\x29\x29\x2E\x78\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x69\x66\x20\x28\x73\x65\x71\x75\x65\x6E\x63\x65\x2E\x79\x20\x3E"
+    "\x20\x30\x75\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x75\x69\x6E\x74\x20\x6C\x61\x73\x74\x20\x20\x20\x20"
+    "\x3D\x20\x73\x65\x71\x75\x65\x6E\x63\x65\x2E\x78\x20\x2B\x20\x73"
+    "\x65\x71\x75\x65\x6E\x63\x65\x2E\x79\x20\x2D\x20\x31\x75\x3B\x0A"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x75\x69\x6E\x74"
+    "\x20\x65\x6C\x61\x70\x73\x65\x64\x20\x3D\x20\x74\x69\x6D\x65\x20"
+    "\x25\x20\x74\x65\x78\x65\x6C\x46\x65\x74\x63\x68\x28\x66\x72\x61"
+    "\x6D\x65\x73\x2C\x20\x69\x6E\x74\x28\x6C\x61\x73\x74\x29\x29\x2E"
+    "\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x75"
+    "\x69\x6E\x74\x20\x66\x72\x61\x6D\x65\x20\x20\x20\x3D\x20\x73\x65"
+    "\x71\x75\x65\x6E\x63\x65\x2E\x78\x3B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x66\x72\x61"
+    "\x6D\x65\x20\x3C\x20\x6C\x61\x73\x74\x20\x26\x26\x20\x65\x6C\x61"
+    "\x70\x73\x65\x64\x20\x3E\x3D\x20\x74\x65\x78\x65\x6C\x46\x65\x74"
+    "\x63\x68\x28\x66\x72\x61\x6D\x65\x73\x2C\x20\x69\x6E\x74\x28\x66"
+    "\x72\x61\x6D\x65\x29\x29\x2E\x79\x29\x20\x7B\x0A\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x61\x6D"
+    "\x65\x2B\x2B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"
+    "\x64\x20\x3D\x20\x74\x65\x78\x65\x6C\x46\x65\x74\x63\x68\x28\x66"
+    "\x72\x61\x6D\x65\x73\x2C\x20\x69\x6E\x74\x28\x66\x72\x61\x6D\x65"
+    "\x29\x29\x2E\x78\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"
+    "\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x43\x6C"
+    "\x61\x6D\x70\x20\x74\x6F\x20\x74\x65\x78\x65\x6C\x20\x63\x65\x6E"
+    "\x74\x65\x72\x73\x20\x77\x69\x74\x68\x69\x6E\x20\x74\x68\x65\x20"
+    "\x74\x69\x6C\x65\x20\x74\x6F\x20\x70\x72\x65\x76\x65\x6E\x74\x20"
+    "\x62\x6C\x65\x65\x64\x69\x6E\x67\x20\x66\x72\x6F\x6D\x20\x6E\x65"
+    "\x69\x67\x68\x62\x6F\x72\x69\x6E\x67\x20\x74\x69\x6C\x65\x73\x0A"
+    "\x20\x20\x20\x20\x69\x6E\x74\x20\x69\x6E\x64\x65\x78\x20\x20\x20"
+    "\x3D\x20\x69\x6E\x74\x28\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x76"
+    "\x65\x63\x32\x20\x73\x6F\x75\x72\x63\x65\x20\x3D\x20\x72\x65\x67"
+    "\x69\x6F\x6E\x2E\x78\x79\x20\x2B\x20\x76\x65\x63\x32\x28\x67\x72"
+    "\x69\x64\x2E\x79\x29\x20\x2B\x20\x76\x65\x63\x32\x28\x69\x6E\x64"
+    "\x65\x78\x20\x25\x20\x67\x72\x69\x64\x2E\x78\x2C\x20\x69\x6E\x64"
+    "\x65\x78\x20\x2F\x20\x67\x72\x69\x64\x2E\x78\x29\x20\x2A\x20\x28"
+    "\x72\x65\x67\x69\x6F\x6E\x2E\x7A\x77\x20\x2B\x20\x66\x6C\x6F\x61"
+    "\x74\x28\x67\x72\x69\x64\x2E\x7A\x29\x29\x3B\x0A\x20\x20\x20\x20"
+    "\x76\x65\x63\x32\x20\x74\x65\x78\x65\x6C\x20\x20\x3D\x20\x73\x6F"
+    "\x75\x72\x63\x65\x20\x2B\x20\x63\x6C\x61\x6D\x70\x28\x75\x76\x20"
+    "\x2A\x20\x72\x65\x67\x69\x6F\x6E\x2E\x7A\x77\x2C\x20\x76\x65\x63"
+    "\x32\x28\x30\x2E\x35\x29\x2C\x20\x72\x65\x67\x69\x6F\x6E\x2E\x7A"
+    "\x77\x20\x2D\x20\x30\x2E\x35\x29\x3B\x0A\x20\x20\x20\x20\x72\x65"
+    "\x73\x75\x6C\x74\x20\x20\x20\x20\x20\x20\x3D\x20\x74\x65\x78\x74"
+    "\x75\x72\x65\x28\x69\x6D\x61\x67\x65\x2C\x20\x74\x65\x78\x65\x6C"
+    "\x20\x2F\x20\x69\x6D\x61\x67\x65\x53\x69\x7A\x65\x29\x3B\x0A\x0A"
+    "\x20\x20\x20\x20\x69\x66\x20\x28\x68\x75\x65\x20\x3E\x20\x30\x2E"
+    "\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73"
+    "\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28\x68\x75\x65\x5F\x73"
+    "\x68\x69\x66\x74\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x2C"
+    "\x20\x68\x75\x65\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29"
+    "\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28"
+    "\x63\x6F\x6C\x6F\x72\x2E\x61\x20\x3E\x20\x30\x2E\x30\x29\x20\x7B"
+    "\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20"
+    "\x3D\x20\x76\x65\x63\x34\x28\x6D\x69\x78\x28\x72\x65\x73\x75\x6C"
+    "\x74\x2E\x72\x67\x62\x2C\x20\x63\x6F\x6C\x6F\x72\x2E\x72\x67\x62"
+    "\x2C\x20\x63\x6F\x6C\x6F\x72\x2E\x61\x29\x2C\x20\x72\x65\x73\x75"
+    "\x6C\x74\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"
+    "\x20\x69\x66\x20\x28\x74\x6F\x6E\x65\x2E\x61\x20\x3E\x20\x30\x2E"
+    "\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x6F"
+    "\x61\x74\x20\x61\x76\x67\x20\x3D\x20\x28\x72\x65\x73\x75\x6C\x74"
+    "\x2E\x72\x20\x2B\x20\x72\x65\x73\x75\x6C\x74\x2E\x67\x20\x2B\x20"
+    "\x72\x65\x73\x75\x6C\x74\x2E\x62\x29\x20\x2F\x20\x33\x2E\x30\x3B"
+    "\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x20\x20\x3D\x20\x72\x65\x73\x75\x6C\x74\x2E\x72\x20\x2D\x20"
+    "\x28\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x20\x2D\x20\x61\x76\x67"
+    "\x29\x20\x2A\x20\x74\x6F\x6E\x65\x2E\x61\x29\x3B\x0A\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x2E\x67\x20\x20\x3D"
+    "\x20\x72\x65\x73\x75\x6C\x74\x2E\x67\x20\x2D\x20\x28\x28\x72\x65"
+    "\x73\x75\x6C\x74\x2E\x67\x20\x2D\x20\x61\x76\x67\x29\x20\x2A\x20"
+    "\x74\x6F\x6E\x65\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x72\x65\x73\x75\x6C\x74\x2E\x62\x20\x20\x3D\x20\x72\x65\x73"
+    "\x75\x6C\x74\x2E\x62\x20\x2D\x20\x28\x28\x72\x65\x73\x75\x6C\x74"
+    "\x2E\x62\x20\x2D\x20\x61\x76\x67\x29\x20\x2A\x20\x74\x6F\x6E\x65"
+    "\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x72"
+    "\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28\x63\x6C\x61"
+    "\x6D\x70\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x2B\x20"
+    "\x74\x6F\x6E\x65\x2E\x72\x67\x62\x2C\x20\x30\x2E\x30\x2C\x20\x31"
+    "\x2E\x30\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A"
+    "\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x73\x68\x2E\x61"
+    "\x20\x3E\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28"
+    "\x6D\x69\x78\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x2C\x20"
+    "\x66\x6C\x61\x73\x68\x2E\x72\x67\x62\x2C\x20\x66\x6C\x61\x73\x68"
+    "\x2E\x61\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6C"
+    "\x70\x68\x61\x20\x3C\x20\x31\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x2A\x3D\x20\x61"
+    "\x6C\x70\x68\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D";
 
 const char *RPG_TILEMAP_FRAGMENT =
     "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
@@ -35,14 +533,71 @@ const char *RPG_VERTEX_SHADER =
     "\x32\x20\x63\x6F\x6F\x72\x64\x73\x3B\x0A\x0A\x75\x6E\x69\x66\x6F"
     "\x72\x6D\x20\x6D\x61\x74\x34\x20\x6D\x6F\x64\x65\x6C\x3B\x0A\x75"
     "\x6E\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74\x34\x20\x70\x72\x6F\x6A"
-    "\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61"
-    "\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x6F\x72\x64"
-    "\x73\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65\x63\x32\x28\x76\x65"
-    "\x72\x74\x65\x78\x2E\x7A\x77\x29\x3B\x0A\x20\x20\x20\x20\x67\x6C"
-    "\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x70\x72\x6F\x6A"
-    "\x65\x63\x74\x69\x6F\x6E\x20\x2A\x20\x6D\x6F\x64\x65\x6C\x20\x2A"
-    "\x20\x76\x65\x63\x34\x28\x76\x65\x72\x74\x65\x78\x2E\x78\x79\x2C"
-    "\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x7D";
+    "\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x76\x65\x63\x34\x20\x73\x6F\x75\x72\x63\x65\x3B\x0A\x75\x6E\x69"
+    "\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x64\x69\x73\x74\x6F\x72"
+    "\x74\x69\x6F\x6E\x5B\x33\x5D\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D"
+    "\x20\x66\x6C\x6F\x61\x74\x20\x74\x69\x6D\x65\x3B\x0A\x0A\x2F\x2F"
+    "\x20\x45\x61\x63\x68\x20\x65\x66\x66\x65\x63\x74\x20\x69\x73\x20"
+    "\x61\x6E\x20\x61\x6D\x70\x6C\x69\x74\x75\x64\x65\x20\x61\x6E\x64"
+    "\x20\x6C\x65\x6E\x67\x74\x68\x20\x69\x6E\x20\x70\x69\x78\x65\x6C"
+    "\x73\x2C\x20\x61\x20\x73\x70\x65\x65\x64\x20\x69\x6E\x20\x64\x65"
+    "\x67\x72\x65\x65\x73\x20\x70\x65\x72\x20\x75\x70\x64\x61\x74\x65"
+    "\x2C\x20\x61\x6E\x64\x20\x61\x20\x70\x68\x61\x73\x65\x20\x69\x6E"
+    "\x20\x64\x65\x67\x72\x65\x65\x73\x0A\x66\x6C\x6F\x61\x74\x20\x6F"
+    "\x73\x63\x69\x6C\x6C\x61\x74\x65\x28\x76\x65\x63\x34\x20\x65\x66"
+    "\x66\x65\x63\x74\x2C\x20\x66\x6C\x6F\x61\x74\x20\x70\x6F\x73\x69"
+    "\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x72\x65\x74\x75"
+    "\x72\x6E\x20\x65\x66\x66\x65\x63\x74\x2E\x78\x20\x2A\x20\x73\x69"
+    "\x6E\x28\x72\x61\x64\x69\x61\x6E\x73\x28\x65\x66\x66\x65\x63\x74"
+    "\x2E\x77\x20\x2B\x20\x74\x69\x6D\x65\x20\x2A\x20\x65\x66\x66\x65"
+    "\x63\x74\x2E\x7A\x29\x20\x2B\x20\x36\x2E\x32\x38\x33\x31\x38\x35"
+    "\x33\x20\x2A\x20\x70\x6F\x73\x69\x74\x69\x6F\x6E\x20\x2F\x20\x6D"
+    "\x61\x78\x28\x65\x66\x66\x65\x63\x74\x2E\x79\x2C\x20\x31\x2E\x30"
+    "\x29\x29\x3B\x0A\x7D\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E"
+    "\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x20\x70\x6F"
+    "\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x76\x65\x72\x74\x65\x78\x2E"
+    "\x78\x79\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x64\x69\x73\x74"
+    "\x6F\x72\x74\x69\x6F\x6E\x5B\x30\x5D\x2E\x78\x20\x21\x3D\x20\x30"
+    "\x2E\x30\x20\x7C\x7C\x20\x64\x69\x73\x74\x6F\x72\x74\x69\x6F\x6E"
+    "\x5B\x31\x5D\x2E\x78\x20\x21\x3D\x20\x30\x2E\x30\x20\x7C\x7C\x20"
+    "\x64\x69\x73\x74\x6F\x72\x74\x69\x6F\x6E\x5B\x32\x5D\x2E\x78\x20"
+    "\x21\x3D\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x2F\x2F\x20\x4F\x66\x66\x73\x65\x74\x73\x20\x61\x72\x65"
+    "\x20\x69\x6E\x20\x70\x69\x78\x65\x6C\x73\x2C\x20\x73\x6F\x20\x61"
+    "\x72\x65\x20\x64\x69\x76\x69\x64\x65\x64\x20\x62\x79\x20\x74\x68"
+    "\x65\x20\x73\x69\x7A\x65\x20\x74\x68\x65\x20\x6D\x6F\x64\x65\x6C"
+    "\x20\x6D\x61\x74\x72\x69\x78\x20\x73\x63\x61\x6C\x65\x73\x20\x74"
+    "\x68\x65\x20\x75\x6E\x69\x74\x20\x6D\x65\x73\x68\x20\x62\x79\x0A"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x76\x65\x63\x32\x20\x73\x69\x7A"
+    "\x65\x20\x3D\x20\x6D\x61\x78\x28\x76\x65\x63\x32\x28\x6C\x65\x6E"
+    "\x67\x74\x68\x28\x6D\x6F\x64\x65\x6C\x5B\x30\x5D\x2E\x78\x79\x29"
+    "\x2C\x20\x6C\x65\x6E\x67\x74\x68\x28\x6D\x6F\x64\x65\x6C\x5B\x31"
+    "\x5D\x2E\x78\x79\x29\x29\x2C\x20\x76\x65\x63\x32\x28\x31\x2E\x30"
+    "\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x6F\x61"
+    "\x74\x20\x79\x20\x20\x20\x3D\x20\x76\x65\x72\x74\x65\x78\x2E\x79"
+    "\x20\x2A\x20\x73\x69\x7A\x65\x2E\x79\x3B\x0A\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x70\x6F\x73\x69\x74\x69\x6F\x6E\x2E\x78\x20\x2B\x3D"
+    "\x20\x6F\x73\x63\x69\x6C\x6C\x61\x74\x65\x28\x64\x69\x73\x74\x6F"
+    "\x72\x74\x69\x6F\x6E\x5B\x30\x5D\x2C\x20\x79\x29\x20\x2F\x20\x73"
+    "\x69\x7A\x65\x2E\x78\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70"
+    "\x6F\x73\x69\x74\x69\x6F\x6E\x2E\x79\x20\x2B\x3D\x20\x6F\x73\x63"
+    "\x69\x6C\x6C\x61\x74\x65\x28\x64\x69\x73\x74\x6F\x72\x74\x69\x6F"
+    "\x6E\x5B\x31\x5D\x2C\x20\x79\x29\x20\x2F\x20\x73\x69\x7A\x65\x2E"
+    "\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x6F\x73\x69\x74"
+    "\x69\x6F\x6E\x2E\x78\x20\x2B\x3D\x20\x6F\x73\x63\x69\x6C\x6C\x61"
+    "\x74\x65\x28\x64\x69\x73\x74\x6F\x72\x74\x69\x6F\x6E\x5B\x32\x5D"
+    "\x2C\x20\x30\x2E\x30\x29\x20\x2A\x20\x28\x31\x2E\x30\x20\x2D\x20"
+    "\x76\x65\x72\x74\x65\x78\x2E\x79\x29\x20\x2F\x20\x73\x69\x7A\x65"
+    "\x2E\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x63\x6F"
+    "\x6F\x72\x64\x73\x20\x20\x20\x20\x20\x20\x3D\x20\x73\x6F\x75\x72"
+    "\x63\x65\x2E\x78\x79\x20\x2B\x20\x76\x65\x72\x74\x65\x78\x2E\x7A"
+    "\x77\x20\x2A\x20\x73\x6F\x75\x72\x63\x65\x2E\x7A\x77\x3B\x0A\x20"
+    "\x20\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D"
+    "\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20\x2A\x20\x6D\x6F"
+    "\x64\x65\x6C\x20\x2A\x20\x76\x65\x63\x34\x28\x70\x6F\x73\x69\x74"
+    "\x69\x6F\x6E\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A"
+    "\x7D";
 
 const char *RPG_FRAGMENT_SHADER = 
     "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
@@ -184,6 +739,443 @@ const char *RPG_FONT_FRAGMENT =
     "\x75\x72\x65\x28\x74\x65\x78\x74\x2C\x20\x63\x6F\x6F\x72\x64\x73"
     "\x29\x2E\x72\x29\x20\x2A\x20\x63\x6F\x6C\x6F\x72\x3B\x20\x7D";
 
+const char *RPG_SCREEN_VERTEX =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x30\x29\x20\x69\x6E\x20\x76\x65\x63\x34\x20"
+    "\x76\x65\x72\x74\x65\x78\x3B\x0A\x0A\x6F\x75\x74\x20\x76\x65\x63"
+    "\x32\x20\x63\x6F\x6F\x72\x64\x73\x3B\x0A\x0A\x75\x6E\x69\x66\x6F"
+    "\x72\x6D\x20\x76\x65\x63\x32\x20\x6F\x66\x66\x73\x65\x74\x3B\x0A"
+    "\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20"
+    "\x20\x20\x20\x63\x6F\x6F\x72\x64\x73\x20\x20\x20\x20\x20\x20\x3D"
+    "\x20\x76\x65\x72\x74\x65\x78\x2E\x7A\x77\x3B\x0A\x20\x20\x20\x20"
+    "\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x76\x65"
+    "\x63\x34\x28\x76\x65\x72\x74\x65\x78\x2E\x78\x79\x20\x2B\x20\x6F"
+    "\x66\x66\x73\x65\x74\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29"
+    "\x3B\x0A\x7D";
+
+const char *RPG_SCREEN_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75"
+    "\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D"
+    "\x70\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D\x70\x6C\x65\x72\x33\x44\x20"
+    "\x6C\x75\x74\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63"
+    "\x34\x20\x74\x6F\x6E\x65\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x76\x65\x63\x34\x20\x66\x6C\x61\x73\x68\x3B\x0A\x75\x6E\x69\x66"
+    "\x6F\x72\x6D\x20\x66\x6C\x6F\x61\x74\x20\x62\x72\x69\x67\x68\x74"
+    "\x6E\x65\x73\x73\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65"
+    "\x63\x33\x20\x67\x72\x61\x64\x69\x6E\x67\x3B\x0A\x0A\x76\x6F\x69"
+    "\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x72"
+    "\x65\x73\x75\x6C\x74\x20\x3D\x20\x74\x65\x78\x74\x75\x72\x65\x28"
+    "\x69\x6D\x61\x67\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6E\x65\x2E\x61\x20\x3E"
+    "\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x66\x6C\x6F\x61\x74\x20\x61\x76\x67\x20\x3D\x20\x28\x72\x65\x73"
+    "\x75\x6C\x74\x2E\x72\x20\x2B\x20\x72\x65\x73\x75\x6C\x74\x2E\x67"
+    "\x20\x2B\x20\x72\x65\x73\x75\x6C\x74\x2E\x62\x29\x20\x2F\x20\x33"
+    "\x2E\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"
+    "\x6C\x74\x2E\x72\x67\x62\x20\x3D\x20\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x67\x62\x20\x2D\x20\x28\x28\x72\x65\x73\x75\x6C\x74\x2E\x72"
+    "\x67\x62\x20\x2D\x20\x61\x76\x67\x29\x20\x2A\x20\x74\x6F\x6E\x65"
+    "\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x72"
+    "\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x3D\x20\x63\x6C\x61\x6D"
+    "\x70\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x2B\x20\x74"
+    "\x6F\x6E\x65\x2E\x72\x67\x62\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E"
+    "\x30\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x67\x72\x61\x64"
+    "\x69\x6E\x67\x2E\x78\x20\x69\x73\x20\x74\x68\x65\x20\x73\x74\x72"
+    "\x65\x6E\x67\x74\x68\x2C\x20\x67\x72\x61\x64\x69\x6E\x67\x2E\x79"
+    "\x7A\x20\x74\x68\x65\x20\x73\x63\x61\x6C\x65\x2F\x62\x69\x61\x73"
+    "\x20\x74\x6F\x20\x73\x61\x6D\x70\x6C\x65\x20\x74\x65\x78\x65\x6C"
+    "\x20\x63\x65\x6E\x74\x65\x72\x73\x20\x6F\x66\x20\x74\x68\x65\x20"
+    "\x6C\x6F\x6F\x6B\x75\x70\x20\x74\x61\x62\x6C\x65\x0A\x20\x20\x20"
+    "\x20\x69\x66\x20\x28\x67\x72\x61\x64\x69\x6E\x67\x2E\x78\x20\x3E"
+    "\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x76\x65\x63\x33\x20\x67\x72\x61\x64\x65\x64\x20\x3D\x20\x74\x65"
+    "\x78\x74\x75\x72\x65\x28\x6C\x75\x74\x2C\x20\x72\x65\x73\x75\x6C"
+    "\x74\x2E\x72\x67\x62\x20\x2A\x20\x67\x72\x61\x64\x69\x6E\x67\x2E"
+    "\x79\x20\x2B\x20\x67\x72\x61\x64\x69\x6E\x67\x2E\x7A\x29\x2E\x72"
+    "\x67\x62\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"
+    "\x6C\x74\x2E\x72\x67\x62\x20\x20\x3D\x20\x6D\x69\x78\x28\x72\x65"
+    "\x73\x75\x6C\x74\x2E\x72\x67\x62\x2C\x20\x67\x72\x61\x64\x65\x64"
+    "\x2C\x20\x67\x72\x61\x64\x69\x6E\x67\x2E\x78\x29\x3B\x0A\x20\x20"
+    "\x20\x20\x7D\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x2E\x72"
+    "\x67\x62\x20\x3D\x20\x6D\x69\x78\x28\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x67\x62\x2C\x20\x66\x6C\x61\x73\x68\x2E\x72\x67\x62\x2C\x20"
+    "\x66\x6C\x61\x73\x68\x2E\x61\x29\x20\x2A\x20\x62\x72\x69\x67\x68"
+    "\x74\x6E\x65\x73\x73\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C"
+    "\x74\x2E\x61\x20\x20\x20\x3D\x20\x31\x2E\x30\x3B\x0A\x7D";
+
+const char *RPG_POSTFX_COPY_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75"
+    "\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D"
+    "\x70\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x0A\x76"
+    "\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20"
+    "\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x74\x65\x78\x74\x75\x72"
+    "\x65\x28\x69\x6D\x61\x67\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x29"
+    "\x3B\x0A\x7D";
+
+const char *RPG_POSTFX_BLUR_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75"
+    "\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D"
+    "\x70\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x64\x69\x72\x65\x63"
+    "\x74\x69\x6F\x6E\x3B\x0A\x0A\x2F\x2F\x20\x39\x2D\x74\x61\x70\x20"
+    "\x67\x61\x75\x73\x73\x69\x61\x6E\x2C\x20\x72\x65\x64\x75\x63\x65"
+    "\x64\x20\x74\x6F\x20\x35\x20\x66\x65\x74\x63\x68\x65\x73\x20\x62"
+    "\x79\x20\x73\x61\x6D\x70\x6C\x69\x6E\x67\x20\x62\x65\x74\x77\x65"
+    "\x65\x6E\x20\x74\x65\x78\x65\x6C\x73\x20\x77\x69\x74\x68\x20\x6C"
+    "\x69\x6E\x65\x61\x72\x20\x66\x69\x6C\x74\x65\x72\x69\x6E\x67\x0A"
+    "\x63\x6F\x6E\x73\x74\x20\x66\x6C\x6F\x61\x74\x20\x6F\x66\x66\x73"
+    "\x65\x74\x73\x5B\x33\x5D\x20\x3D\x20\x66\x6C\x6F\x61\x74\x5B\x5D"
+    "\x28\x30\x2E\x30\x2C\x20\x31\x2E\x33\x38\x34\x36\x31\x35\x33\x38"
+    "\x34\x36\x2C\x20\x33\x2E\x32\x33\x30\x37\x36\x39\x32\x33\x30\x38"
+    "\x29\x3B\x0A\x63\x6F\x6E\x73\x74\x20\x66\x6C\x6F\x61\x74\x20\x77"
+    "\x65\x69\x67\x68\x74\x73\x5B\x33\x5D\x20\x3D\x20\x66\x6C\x6F\x61"
+    "\x74\x5B\x5D\x28\x30\x2E\x32\x32\x37\x30\x32\x37\x30\x32\x37\x30"
+    "\x2C\x20\x30\x2E\x33\x31\x36\x32\x31\x36\x32\x31\x36\x32\x2C\x20"
+    "\x30\x2E\x30\x37\x30\x32\x37\x30\x32\x37\x30\x33\x29\x3B\x0A\x0A"
+    "\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20"
+    "\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x74\x65\x78\x74\x75"
+    "\x72\x65\x28\x69\x6D\x61\x67\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73"
+    "\x29\x20\x2A\x20\x77\x65\x69\x67\x68\x74\x73\x5B\x30\x5D\x3B\x0A"
+    "\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x6E\x74\x20\x69\x20\x3D"
+    "\x20\x31\x3B\x20\x69\x20\x3C\x20\x33\x3B\x20\x69\x2B\x2B\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"
+    "\x20\x2B\x3D\x20\x74\x65\x78\x74\x75\x72\x65\x28\x69\x6D\x61\x67"
+    "\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x20\x2B\x20\x64\x69\x72\x65"
+    "\x63\x74\x69\x6F\x6E\x20\x2A\x20\x6F\x66\x66\x73\x65\x74\x73\x5B"
+    "\x69\x5D\x29\x20\x2A\x20\x77\x65\x69\x67\x68\x74\x73\x5B\x69\x5D"
+    "\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"
+    "\x20\x2B\x3D\x20\x74\x65\x78\x74\x75\x72\x65\x28\x69\x6D\x61\x67"
+    "\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x20\x2D\x20\x64\x69\x72\x65"
+    "\x63\x74\x69\x6F\x6E\x20\x2A\x20\x6F\x66\x66\x73\x65\x74\x73\x5B"
+    "\x69\x5D\x29\x20\x2A\x20\x77\x65\x69\x67\x68\x74\x73\x5B\x69\x5D"
+    "\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D";
+
+const char *RPG_POSTFX_THRESHOLD_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75"
+    "\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D"
+    "\x70\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x66\x6C\x6F\x61\x74\x20\x74\x68\x72\x65"
+    "\x73\x68\x6F\x6C\x64\x3B\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69"
+    "\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"
+    "\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x74\x65\x78\x74\x75\x72\x65"
+    "\x28\x69\x6D\x61\x67\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x29\x3B"
+    "\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x62\x72\x69\x67\x68"
+    "\x74\x20\x3D\x20\x6D\x61\x78\x28\x72\x65\x73\x75\x6C\x74\x2E\x72"
+    "\x2C\x20\x6D\x61\x78\x28\x72\x65\x73\x75\x6C\x74\x2E\x67\x2C\x20"
+    "\x72\x65\x73\x75\x6C\x74\x2E\x62\x29\x29\x3B\x0A\x20\x20\x20\x20"
+    "\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x20\x2A\x3D\x20\x6D"
+    "\x61\x78\x28\x62\x72\x69\x67\x68\x74\x20\x2D\x20\x74\x68\x72\x65"
+    "\x73\x68\x6F\x6C\x64\x2C\x20\x30\x2E\x30\x29\x20\x2F\x20\x6D\x61"
+    "\x78\x28\x62\x72\x69\x67\x68\x74\x2C\x20\x30\x2E\x30\x30\x30\x31"
+    "\x29\x3B\x0A\x7D";
+
+const char *RPG_POSTFX_COMBINE_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75"
+    "\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D"
+    "\x70\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D\x70\x6C\x65\x72\x32\x44\x20"
+    "\x62\x6C\x6F\x6F\x6D\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x66"
+    "\x6C\x6F\x61\x74\x20\x69\x6E\x74\x65\x6E\x73\x69\x74\x79\x3B\x0A"
+    "\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20"
+    "\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x20\x20\x20\x20\x3D\x20"
+    "\x74\x65\x78\x74\x75\x72\x65\x28\x69\x6D\x61\x67\x65\x2C\x20\x63"
+    "\x6F\x6F\x72\x64\x73\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x75"
+    "\x6C\x74\x2E\x72\x67\x62\x20\x3D\x20\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x67\x62\x20\x2B\x20\x74\x65\x78\x74\x75\x72\x65\x28\x62\x6C"
+    "\x6F\x6F\x6D\x2C\x20\x63\x6F\x6F\x72\x64\x73\x29\x2E\x72\x67\x62"
+    "\x20\x2A\x20\x69\x6E\x74\x65\x6E\x73\x69\x74\x79\x3B\x0A\x7D";
+
+const char *RPG_LIGHT_VERTEX =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x30\x29\x20\x69\x6E\x20\x76\x65\x63\x34\x20"
+    "\x73\x68\x61\x70\x65\x3B\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F"
+    "\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x31\x29\x20\x69\x6E\x20\x76"
+    "\x65\x63\x34\x20\x63\x6F\x6C\x6F\x72\x3B\x0A\x6C\x61\x79\x6F\x75"
+    "\x74\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x32\x29\x20"
+    "\x69\x6E\x20\x76\x65\x63\x34\x20\x63\x6F\x6E\x65\x3B\x0A\x0A\x6F"
+    "\x75\x74\x20\x76\x65\x63\x32\x20\x6C\x6F\x63\x61\x6C\x3B\x0A\x6F"
+    "\x75\x74\x20\x76\x65\x63\x34\x20\x74\x69\x6E\x74\x3B\x0A\x66\x6C"
+    "\x61\x74\x20\x6F\x75\x74\x20\x76\x65\x63\x33\x20\x73\x70\x72\x65"
+    "\x61\x64\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74"
+    "\x34\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x6F\x72\x69\x67\x69"
+    "\x6E\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x62\x6F\x6F\x6C\x20"
+    "\x6F\x63\x63\x6C\x75\x64\x65\x72\x3B\x0A\x0A\x63\x6F\x6E\x73\x74"
+    "\x20\x76\x65\x63\x32\x20\x63\x6F\x72\x6E\x65\x72\x73\x5B\x36\x5D"
+    "\x20\x3D\x20\x76\x65\x63\x32\x5B\x5D\x28\x76\x65\x63\x32\x28\x2D"
+    "\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32\x28"
+    "\x31\x2E\x30\x2C\x20\x2D\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32"
+    "\x28\x2D\x31\x2E\x30\x2C\x20\x2D\x31\x2E\x30\x29\x2C\x20\x76\x65"
+    "\x63\x32\x28\x2D\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76"
+    "\x65\x63\x32\x28\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76"
+    "\x65\x63\x32\x28\x31\x2E\x30\x2C\x20\x2D\x31\x2E\x30\x29\x29\x3B"
+    "\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A"
+    "\x20\x20\x20\x20\x76\x65\x63\x32\x20\x63\x6F\x72\x6E\x65\x72\x20"
+    "\x3D\x20\x63\x6F\x72\x6E\x65\x72\x73\x5B\x67\x6C\x5F\x56\x65\x72"
+    "\x74\x65\x78\x49\x44\x5D\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28"
+    "\x6F\x63\x63\x6C\x75\x64\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20"
+    "\x20\x20\x20\x20\x2F\x2F\x20\x49\x6E\x73\x74\x61\x6E\x63\x65\x20"
+    "\x69\x73\x20\x61\x20\x72\x65\x63\x74\x61\x6E\x67\x6C\x65\x20\x61"
+    "\x73\x20\x78\x2C\x20\x79\x2C\x20\x77\x69\x64\x74\x68\x2C\x20\x68"
+    "\x65\x69\x67\x68\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x6F"
+    "\x63\x61\x6C\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65\x63\x32"
+    "\x28\x30\x2E\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74"
+    "\x69\x6E\x74\x20\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65\x63"
+    "\x34\x28\x30\x2E\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x73\x70\x72\x65\x61\x64\x20\x20\x20\x20\x20\x20\x3D\x20\x76\x65"
+    "\x63\x33\x28\x30\x2E\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"
+    "\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x70"
+    "\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20\x2A\x20\x76\x65\x63\x34"
+    "\x28\x73\x68\x61\x70\x65\x2E\x78\x79\x20\x2B\x20\x28\x63\x6F\x72"
+    "\x6E\x65\x72\x20\x2A\x20\x30\x2E\x35\x20\x2B\x20\x30\x2E\x35\x29"
+    "\x20\x2A\x20\x73\x68\x61\x70\x65\x2E\x7A\x77\x20\x2D\x20\x6F\x72"
+    "\x69\x67\x69\x6E\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B"
+    "\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B"
+    "\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x6C\x6F\x63\x61\x6C"
+    "\x20\x20\x3D\x20\x63\x6F\x72\x6E\x65\x72\x3B\x0A\x20\x20\x20\x20"
+    "\x74\x69\x6E\x74\x20\x20\x20\x3D\x20\x76\x65\x63\x34\x28\x63\x6F"
+    "\x6C\x6F\x72\x2E\x72\x67\x62\x20\x2A\x20\x63\x6F\x6C\x6F\x72\x2E"
+    "\x61\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x20\x20\x20\x20\x73\x70\x72"
+    "\x65\x61\x64\x20\x3D\x20\x63\x6F\x6E\x65\x2E\x78\x79\x7A\x3B\x0A"
+    "\x0A\x20\x20\x20\x20\x2F\x2F\x20\x43\x6F\x6C\x6C\x61\x70\x73\x65"
+    "\x20\x75\x6E\x75\x73\x65\x64\x20\x73\x6C\x6F\x74\x73\x20\x74\x6F"
+    "\x20\x61\x20\x64\x65\x67\x65\x6E\x65\x72\x61\x74\x65\x20\x74\x72"
+    "\x69\x61\x6E\x67\x6C\x65\x0A\x20\x20\x20\x20\x67\x6C\x5F\x50\x6F"
+    "\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x73\x68\x61\x70\x65\x2E\x77"
+    "\x20\x3E\x20\x30\x2E\x30\x20\x3F\x20\x70\x72\x6F\x6A\x65\x63\x74"
+    "\x69\x6F\x6E\x20\x2A\x20\x76\x65\x63\x34\x28\x73\x68\x61\x70\x65"
+    "\x2E\x78\x79\x20\x2B\x20\x63\x6F\x72\x6E\x65\x72\x20\x2A\x20\x73"
+    "\x68\x61\x70\x65\x2E\x7A\x20\x2D\x20\x6F\x72\x69\x67\x69\x6E\x2C"
+    "\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x20\x3A\x20\x76\x65\x63"
+    "\x34\x28\x30\x2E\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_LIGHT_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x6C\x6F\x63\x61\x6C"
+    "\x3B\x0A\x69\x6E\x20\x76\x65\x63\x34\x20\x74\x69\x6E\x74\x3B\x0A"
+    "\x66\x6C\x61\x74\x20\x69\x6E\x20\x76\x65\x63\x33\x20\x73\x70\x72"
+    "\x65\x61\x64\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65"
+    "\x73\x75\x6C\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x62"
+    "\x6F\x6F\x6C\x20\x6F\x63\x63\x6C\x75\x64\x65\x72\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x61\x6D\x62\x69\x65"
+    "\x6E\x74\x3B\x0A\x0A\x63\x6F\x6E\x73\x74\x20\x66\x6C\x6F\x61\x74"
+    "\x20\x50\x49\x20\x3D\x20\x33\x2E\x31\x34\x31\x35\x39\x32\x36\x35"
+    "\x3B\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B"
+    "\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x63\x63\x6C\x75\x64\x65"
+    "\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73"
+    "\x75\x6C\x74\x20\x3D\x20\x61\x6D\x62\x69\x65\x6E\x74\x3B\x0A\x20"
+    "\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20"
+    "\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x61"
+    "\x74\x74\x65\x6E\x20\x3D\x20\x63\x6C\x61\x6D\x70\x28\x31\x2E\x30"
+    "\x20\x2D\x20\x6C\x65\x6E\x67\x74\x68\x28\x6C\x6F\x63\x61\x6C\x29"
+    "\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x20\x20\x20"
+    "\x20\x61\x74\x74\x65\x6E\x20\x2A\x3D\x20\x61\x74\x74\x65\x6E\x3B"
+    "\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x73\x70\x72\x65\x61\x64\x2E"
+    "\x78\x20\x69\x73\x20\x74\x68\x65\x20\x64\x69\x72\x65\x63\x74\x69"
+    "\x6F\x6E\x2C\x20\x73\x70\x72\x65\x61\x64\x2E\x79\x20\x74\x68\x65"
+    "\x20\x68\x61\x6C\x66\x2D\x61\x6E\x67\x6C\x65\x2C\x20\x61\x6E\x64"
+    "\x20\x73\x70\x72\x65\x61\x64\x2E\x7A\x20\x74\x68\x65\x20\x73\x6F"
+    "\x66\x74\x6E\x65\x73\x73\x20\x6F\x66\x20\x61\x20\x63\x6F\x6E\x65"
+    "\x27\x73\x20\x65\x64\x67\x65\x0A\x20\x20\x20\x20\x69\x66\x20\x28"
+    "\x73\x70\x72\x65\x61\x64\x2E\x79\x20\x3C\x20\x50\x49\x29\x20\x7B"
+    "\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x61"
+    "\x6E\x67\x6C\x65\x20\x3D\x20\x61\x62\x73\x28\x6D\x6F\x64\x28\x61"
+    "\x74\x61\x6E\x28\x6C\x6F\x63\x61\x6C\x2E\x79\x2C\x20\x6C\x6F\x63"
+    "\x61\x6C\x2E\x78\x29\x20\x2D\x20\x73\x70\x72\x65\x61\x64\x2E\x78"
+    "\x20\x2B\x20\x50\x49\x2C\x20\x32\x2E\x30\x20\x2A\x20\x50\x49\x29"
+    "\x20\x2D\x20\x50\x49\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x61\x74\x74\x65\x6E\x20\x2A\x3D\x20\x31\x2E\x30\x20\x2D\x20\x73"
+    "\x6D\x6F\x6F\x74\x68\x73\x74\x65\x70\x28\x73\x70\x72\x65\x61\x64"
+    "\x2E\x79\x20\x2A\x20\x28\x31\x2E\x30\x20\x2D\x20\x73\x70\x72\x65"
+    "\x61\x64\x2E\x7A\x29\x2C\x20\x73\x70\x72\x65\x61\x64\x2E\x79\x2C"
+    "\x20\x61\x6E\x67\x6C\x65\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20"
+    "\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34"
+    "\x28\x74\x69\x6E\x74\x2E\x72\x67\x62\x20\x2A\x20\x61\x74\x74\x65"
+    "\x6E\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_PARTICLE_VERTEX =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x30\x29\x20\x69\x6E\x20\x76\x65\x63\x34\x20"
+    "\x70\x61\x72\x74\x69\x63\x6C\x65\x3B\x0A\x6C\x61\x79\x6F\x75\x74"
+    "\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x31\x29\x20\x69"
+    "\x6E\x20\x76\x65\x63\x34\x20\x74\x69\x6E\x74\x3B\x0A\x6C\x61\x79"
+    "\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x32"
+    "\x29\x20\x69\x6E\x20\x66\x6C\x6F\x61\x74\x20\x66\x72\x61\x6D\x65"
+    "\x3B\x0A\x0A\x6F\x75\x74\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72"
+    "\x64\x73\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x73\x68\x61"
+    "\x64\x65\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74"
+    "\x34\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E"
+    "\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74\x34\x20\x6D\x6F\x64\x65\x6C"
+    "\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x32\x20\x66"
+    "\x72\x61\x6D\x65\x73\x3B\x0A\x0A\x63\x6F\x6E\x73\x74\x20\x76\x65"
+    "\x63\x32\x20\x63\x6F\x72\x6E\x65\x72\x73\x5B\x36\x5D\x20\x3D\x20"
+    "\x76\x65\x63\x32\x5B\x5D\x28\x76\x65\x63\x32\x28\x2D\x31\x2E\x30"
+    "\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32\x28\x31\x2E\x30"
+    "\x2C\x20\x2D\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32\x28\x2D\x31"
+    "\x2E\x30\x2C\x20\x2D\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32\x28"
+    "\x2D\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32"
+    "\x28\x31\x2E\x30\x2C\x20\x31\x2E\x30\x29\x2C\x20\x76\x65\x63\x32"
+    "\x28\x31\x2E\x30\x2C\x20\x2D\x31\x2E\x30\x29\x29\x3B\x0A\x0A\x76"
+    "\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20"
+    "\x20\x2F\x2F\x20\x70\x61\x72\x74\x69\x63\x6C\x65\x2E\x78\x79\x20"
+    "\x69\x73\x20\x74\x68\x65\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x2C"
+    "\x20\x70\x61\x72\x74\x69\x63\x6C\x65\x2E\x7A\x20\x74\x68\x65\x20"
+    "\x73\x69\x7A\x65\x2C\x20\x61\x6E\x64\x20\x70\x61\x72\x74\x69\x63"
+    "\x6C\x65\x2E\x77\x20\x74\x68\x65\x20\x72\x6F\x74\x61\x74\x69\x6F"
+    "\x6E\x20\x69\x6E\x20\x72\x61\x64\x69\x61\x6E\x73\x0A\x20\x20\x20"
+    "\x20\x76\x65\x63\x32\x20\x63\x6F\x72\x6E\x65\x72\x20\x3D\x20\x63"
+    "\x6F\x72\x6E\x65\x72\x73\x5B\x67\x6C\x5F\x56\x65\x72\x74\x65\x78"
+    "\x49\x44\x5D\x3B\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61\x74\x20\x73"
+    "\x20\x20\x20\x20\x20\x3D\x20\x73\x69\x6E\x28\x70\x61\x72\x74\x69"
+    "\x63\x6C\x65\x2E\x77\x29\x3B\x0A\x20\x20\x20\x20\x66\x6C\x6F\x61"
+    "\x74\x20\x63\x20\x20\x20\x20\x20\x3D\x20\x63\x6F\x73\x28\x70\x61"
+    "\x72\x74\x69\x63\x6C\x65\x2E\x77\x29\x3B\x0A\x20\x20\x20\x20\x76"
+    "\x65\x63\x32\x20\x6F\x66\x66\x73\x65\x74\x20\x3D\x20\x6D\x61\x74"
+    "\x32\x28\x63\x2C\x20\x73\x2C\x20\x2D\x73\x2C\x20\x63\x29\x20\x2A"
+    "\x20\x28\x63\x6F\x72\x6E\x65\x72\x20\x2A\x20\x30\x2E\x35\x20\x2A"
+    "\x20\x70\x61\x72\x74\x69\x63\x6C\x65\x2E\x7A\x29\x3B\x0A\x0A\x20"
+    "\x20\x20\x20\x2F\x2F\x20\x53\x65\x6C\x65\x63\x74\x20\x74\x68\x65"
+    "\x20\x63\x65\x6C\x6C\x20\x6F\x66\x20\x74\x68\x65\x20\x61\x74\x6C"
+    "\x61\x73\x2C\x20\x66\x72\x61\x6D\x65\x73\x20\x61\x72\x65\x20\x6E"
+    "\x75\x6D\x62\x65\x72\x65\x64\x20\x6C\x65\x66\x74\x2D\x74\x6F\x2D"
+    "\x72\x69\x67\x68\x74\x2C\x20\x74\x6F\x70\x2D\x74\x6F\x2D\x62\x6F"
+    "\x74\x74\x6F\x6D\x0A\x20\x20\x20\x20\x76\x65\x63\x32\x20\x63\x65"
+    "\x6C\x6C\x20\x20\x20\x3D\x20\x76\x65\x63\x32\x28\x6D\x6F\x64\x28"
+    "\x66\x72\x61\x6D\x65\x2C\x20\x66\x72\x61\x6D\x65\x73\x2E\x78\x29"
+    "\x2C\x20\x66\x6C\x6F\x6F\x72\x28\x66\x72\x61\x6D\x65\x20\x2F\x20"
+    "\x66\x72\x61\x6D\x65\x73\x2E\x78\x29\x29\x3B\x0A\x20\x20\x20\x20"
+    "\x63\x6F\x6F\x72\x64\x73\x20\x20\x20\x20\x20\x20\x3D\x20\x28\x63"
+    "\x65\x6C\x6C\x20\x2B\x20\x63\x6F\x72\x6E\x65\x72\x20\x2A\x20\x30"
+    "\x2E\x35\x20\x2B\x20\x30\x2E\x35\x29\x20\x2F\x20\x66\x72\x61\x6D"
+    "\x65\x73\x3B\x0A\x20\x20\x20\x20\x73\x68\x61\x64\x65\x20\x20\x20"
+    "\x20\x20\x20\x20\x3D\x20\x74\x69\x6E\x74\x3B\x0A\x20\x20\x20\x20"
+    "\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69\x6F\x6E\x20\x3D\x20\x70\x72"
+    "\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20\x2A\x20\x6D\x6F\x64\x65\x6C"
+    "\x20\x2A\x20\x76\x65\x63\x34\x28\x70\x61\x72\x74\x69\x63\x6C\x65"
+    "\x2E\x78\x79\x20\x2B\x20\x6F\x66\x66\x73\x65\x74\x2C\x20\x30\x2E"
+    "\x30\x2C\x20\x31\x2E\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_PARTICLE_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x32\x20\x63\x6F\x6F\x72\x64"
+    "\x73\x3B\x0A\x69\x6E\x20\x76\x65\x63\x34\x20\x73\x68\x61\x64\x65"
+    "\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75\x6C"
+    "\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x73\x61\x6D\x70"
+    "\x6C\x65\x72\x32\x44\x20\x69\x6D\x61\x67\x65\x3B\x0A\x75\x6E\x69"
+    "\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x63\x6F\x6C\x6F\x72\x3B"
+    "\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34\x20\x74\x6F"
+    "\x6E\x65\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34"
+    "\x20\x66\x6C\x61\x73\x68\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x66\x6C\x6F\x61\x74\x20\x61\x6C\x70\x68\x61\x3B\x0A\x0A\x76\x6F"
+    "\x69\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"
+    "\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x74\x65\x78\x74\x75\x72\x65"
+    "\x28\x69\x6D\x61\x67\x65\x2C\x20\x63\x6F\x6F\x72\x64\x73\x29\x20"
+    "\x2A\x20\x73\x68\x61\x64\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20"
+    "\x28\x63\x6F\x6C\x6F\x72\x2E\x61\x20\x3E\x20\x30\x2E\x30\x29\x20"
+    "\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"
+    "\x20\x3D\x20\x76\x65\x63\x34\x28\x6D\x69\x78\x28\x72\x65\x73\x75"
+    "\x6C\x74\x2E\x72\x67\x62\x2C\x20\x63\x6F\x6C\x6F\x72\x2E\x72\x67"
+    "\x62\x2C\x20\x63\x6F\x6C\x6F\x72\x2E\x61\x29\x2C\x20\x72\x65\x73"
+    "\x75\x6C\x74\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20"
+    "\x20\x20\x69\x66\x20\x28\x74\x6F\x6E\x65\x2E\x61\x20\x3E\x20\x30"
+    "\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"
+    "\x6F\x61\x74\x20\x61\x76\x67\x20\x3D\x20\x28\x72\x65\x73\x75\x6C"
+    "\x74\x2E\x72\x20\x2B\x20\x72\x65\x73\x75\x6C\x74\x2E\x67\x20\x2B"
+    "\x20\x72\x65\x73\x75\x6C\x74\x2E\x62\x29\x20\x2F\x20\x33\x2E\x30"
+    "\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"
+    "\x2E\x72\x67\x62\x20\x2D\x3D\x20\x28\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x67\x62\x20\x2D\x20\x61\x76\x67\x29\x20\x2A\x20\x74\x6F\x6E"
+    "\x65\x2E\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x72"
+    "\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28\x63\x6C\x61"
+    "\x6D\x70\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x2B\x20"
+    "\x74\x6F\x6E\x65\x2E\x72\x67\x62\x2C\x20\x30\x2E\x30\x2C\x20\x31"
+    "\x2E\x30\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A"
+    "\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x73\x68\x2E\x61"
+    "\x20\x3E\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"
+    "\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28"
+    "\x6D\x69\x78\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x2C\x20"
+    "\x66\x6C\x61\x73\x68\x2E\x72\x67\x62\x2C\x20\x66\x6C\x61\x73\x68"
+    "\x2E\x61\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A"
+    "\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6C"
+    "\x70\x68\x61\x20\x3C\x20\x31\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20"
+    "\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x2A\x3D\x20\x61"
+    "\x6C\x70\x68\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D";
+
+const char *RPG_PRIMITIVE_VERTEX =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x6C\x61\x79\x6F\x75\x74\x28\x6C\x6F\x63\x61\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x30\x29\x20\x69\x6E\x20\x76\x65\x63\x32\x20"
+    "\x70\x6F\x73\x69\x74\x69\x6F\x6E\x3B\x0A\x6C\x61\x79\x6F\x75\x74"
+    "\x28\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x20\x3D\x20\x31\x29\x20\x69"
+    "\x6E\x20\x76\x65\x63\x34\x20\x74\x69\x6E\x74\x3B\x0A\x0A\x6F\x75"
+    "\x74\x20\x76\x65\x63\x34\x20\x73\x68\x61\x64\x65\x3B\x0A\x0A\x75"
+    "\x6E\x69\x66\x6F\x72\x6D\x20\x6D\x61\x74\x34\x20\x70\x72\x6F\x6A"
+    "\x65\x63\x74\x69\x6F\x6E\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x6D\x61\x74\x34\x20\x6D\x6F\x64\x65\x6C\x3B\x0A\x0A\x76\x6F\x69"
+    "\x64\x20\x6D\x61\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x73"
+    "\x68\x61\x64\x65\x20\x20\x20\x20\x20\x20\x20\x3D\x20\x74\x69\x6E"
+    "\x74\x3B\x0A\x20\x20\x20\x20\x67\x6C\x5F\x50\x6F\x73\x69\x74\x69"
+    "\x6F\x6E\x20\x3D\x20\x70\x72\x6F\x6A\x65\x63\x74\x69\x6F\x6E\x20"
+    "\x2A\x20\x6D\x6F\x64\x65\x6C\x20\x2A\x20\x76\x65\x63\x34\x28\x70"
+    "\x6F\x73\x69\x74\x69\x6F\x6E\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E"
+    "\x30\x29\x3B\x0A\x7D";
+
+const char *RPG_PRIMITIVE_FRAGMENT =
+    "\x23\x76\x65\x72\x73\x69\x6F\x6E\x20\x33\x33\x30\x20\x63\x6F\x72"
+    "\x65\x0A\x0A\x69\x6E\x20\x76\x65\x63\x34\x20\x73\x68\x61\x64\x65"
+    "\x3B\x0A\x6F\x75\x74\x20\x76\x65\x63\x34\x20\x72\x65\x73\x75\x6C"
+    "\x74\x3B\x0A\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20\x76\x65\x63\x34"
+    "\x20\x63\x6F\x6C\x6F\x72\x3B\x0A\x75\x6E\x69\x66\x6F\x72\x6D\x20"
+    "\x76\x65\x63\x34\x20\x74\x6F\x6E\x65\x3B\x0A\x75\x6E\x69\x66\x6F"
+    "\x72\x6D\x20\x76\x65\x63\x34\x20\x66\x6C\x61\x73\x68\x3B\x0A\x75"
+    "\x6E\x69\x66\x6F\x72\x6D\x20\x66\x6C\x6F\x61\x74\x20\x61\x6C\x70"
+    "\x68\x61\x3B\x0A\x0A\x76\x6F\x69\x64\x20\x6D\x61\x69\x6E\x28\x29"
+    "\x20\x7B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20"
+    "\x73\x68\x61\x64\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x63"
+    "\x6F\x6C\x6F\x72\x2E\x61\x20\x3E\x20\x30\x2E\x30\x29\x20\x7B\x0A"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D"
+    "\x20\x76\x65\x63\x34\x28\x6D\x69\x78\x28\x72\x65\x73\x75\x6C\x74"
+    "\x2E\x72\x67\x62\x2C\x20\x63\x6F\x6C\x6F\x72\x2E\x72\x67\x62\x2C"
+    "\x20\x63\x6F\x6C\x6F\x72\x2E\x61\x29\x2C\x20\x72\x65\x73\x75\x6C"
+    "\x74\x2E\x61\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"
+    "\x69\x66\x20\x28\x74\x6F\x6E\x65\x2E\x61\x20\x3E\x20\x30\x2E\x30"
+    "\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x6F\x61"
+    "\x74\x20\x61\x76\x67\x20\x3D\x20\x28\x72\x65\x73\x75\x6C\x74\x2E"
+    "\x72\x20\x2B\x20\x72\x65\x73\x75\x6C\x74\x2E\x67\x20\x2B\x20\x72"
+    "\x65\x73\x75\x6C\x74\x2E\x62\x29\x20\x2F\x20\x33\x2E\x30\x3B\x0A"
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x2E\x72"
+    "\x67\x62\x20\x2D\x3D\x20\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67"
+    "\x62\x20\x2D\x20\x61\x76\x67\x29\x20\x2A\x20\x74\x6F\x6E\x65\x2E"
+    "\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x72\x65\x73"
+    "\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28\x63\x6C\x61\x6D\x70"
+    "\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x20\x2B\x20\x74\x6F"
+    "\x6E\x65\x2E\x72\x67\x62\x2C\x20\x30\x2E\x30\x2C\x20\x31\x2E\x30"
+    "\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A\x0A\x20"
+    "\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x73\x68\x2E\x61\x20\x3E"
+    "\x20\x30\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"
+    "\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x76\x65\x63\x34\x28\x6D\x69"
+    "\x78\x28\x72\x65\x73\x75\x6C\x74\x2E\x72\x67\x62\x2C\x20\x66\x6C"
+    "\x61\x73\x68\x2E\x72\x67\x62\x2C\x20\x66\x6C\x61\x73\x68\x2E\x61"
+    "\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x2E\x61\x29\x3B\x0A\x20\x20"
+    "\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6C\x70\x68"
+    "\x61\x20\x3C\x20\x31\x2E\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"
+    "\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x2A\x3D\x20\x61\x6C\x70"
+    "\x68\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D";
+
 const char *RPG_TRANSITION_BASE_VERTEX = 
     "\x61\x74\x74\x72\x69\x62\x75\x74\x65\x20\x76\x65\x63\x32\x20\x5F"
     "\x70\x3B\x0A\x76\x61\x72\x79\x69\x6E\x67\x20\x76\x65\x63\x32\x20"
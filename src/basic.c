@@ -8,10 +8,232 @@ void RPG_BasicSprite_Init(RPGbasic *basic, RPGrenderfunc renderfunc, RPGbatch *b
     basic->blend.src = RPG_BLEND_SRC_ALPHA;
     basic->blend.dst = RPG_BLEND_ONE_MINUS_SRC_ALPHA;
     basic->alpha     = 1.0f;
+    basic->source    = (RPGvec4){0.0f, 0.0f, 1.0f, 1.0f};
     basic->updated   = RPG_TRUE;
     RPG_Renderable_Init(&basic->renderable, renderfunc, batch);
 }
 
+/**
+ * @brief Computes the transform of an object relative to its parent node.
+ *
+ * @param basic The object to compute the transform of.
+ * @param x The location on the x-axis, relative to the parent.
+ * @param y The location on the y-axis, relative to the parent.
+ * @param w The width of the object, or 1.0 to exclude its dimensions.
+ * @param h The height of the object, or 1.0 to exclude its dimensions.
+ * @param mat The matrix to receive the transform.
+ */
+static void RPG_BasicSprite_LocalTransform(RPGbasic *basic, RPGfloat x, RPGfloat y, RPGfloat w, RPGfloat h, RPGmat4 *mat)
+{
+    GLfloat sx  = basic->scale.x * w;
+    GLfloat sy  = basic->scale.y * h;
+    GLfloat cos = cosf(basic->rotation.radians);
+    GLfloat sin = sinf(basic->rotation.radians);
+    RPG_MAT4_SET((*mat), sx * cos, sx * sin, 0.0f, 0.0f, sy * -sin, sy * cos, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+                 (basic->rotation.ox * (1.0f - cos) + basic->rotation.oy * sin) + x,
+                 (basic->rotation.oy * (1.0f - cos) - basic->rotation.ox * sin) + y, 0.0f, 1.0f);
+}
+
+void RPG_BasicSprite_UpdateModel(RPGbasic *basic, RPGfloat x, RPGfloat y, RPGfloat w, RPGfloat h, RPGint offsetX, RPGint offsetY)
+{
+    RPG_BasicSprite_LocalTransform(basic, x, y, w, h, &basic->model);
+    if (basic->node.parent != NULL)
+    {
+        RPG_Mat4_Multiply(&basic->model, &basic->node.parent->node.world, &basic->model);
+    }
+    // The viewport offset is applied last so that it is never rotated or scaled by a parent
+    basic->model.m41 += offsetX;
+    basic->model.m42 += offsetY;
+}
+
+void RPG_BasicSprite_BindUniforms(RPGbasic *basic)
+{
+    RPGmaterial *material = basic->renderable.material;
+    if (material == NULL)
+    {
+        RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+        RPG_BASE_UNIFORMS((*basic));
+        glUniform4fv(RPG_GAME->shader.distortion, 3, (GLfloat *) basic->distortion);
+    }
+    else
+    {
+        RPG_Material_Bind(material);
+        RPG_BASE_UNIFORMS_EX(material->builtin, (*basic));
+        glUniform4fv(material->builtin.distortion, 3, (GLfloat *) basic->distortion);
+    }
+}
+
+void RPG_BasicSprite_RenderTexture(RPGbasic *basic, GLuint texture)
+{
+    if (!basic->distorted)
+    {
+        RPG_RENDER_TEXTURE(texture, RPG_GAME->unit.vao);
+        return;
+    }
+    // The subdivided strip gives the vertex shader rows to displace, it is otherwise identical to the unit quad
+    RPG_Drawing_BindTexture(texture, GL_TEXTURE0);
+    glBindVertexArray(RPG_GAME->strip.vao);
+    glDrawArrays(GL_TRIANGLES, 0, RPG_STRIP_ROWS * 6);
+}
+
+/**
+ * @brief Recomputes the world transform of a node and its descendants where required.
+ *
+ * @param basic The node to resolve.
+ * @param dirty Flag indicating if an ancestor's world transform has changed.
+ */
+static void RPG_BasicSprite_ResolveNode(RPGbasic *basic, RPGbool dirty)
+{
+    if (dirty || basic->updated)
+    {
+        RPG_BasicSprite_LocalTransform(basic, basic->x, basic->y, 1.0f, 1.0f, &basic->node.world);
+        if (basic->node.parent != NULL)
+        {
+            RPG_Mat4_Multiply(&basic->node.world, &basic->node.parent->node.world, &basic->node.world);
+        }
+        // Flag the model matrix to be rebuilt against the new world transform when rendered
+        basic->updated = RPG_TRUE;
+        dirty          = RPG_TRUE;
+    }
+    for (RPGbasic *child = basic->node.child; child != NULL; child = child->node.next)
+    {
+        RPG_BasicSprite_ResolveNode(child, dirty);
+    }
+}
+
+void RPG_BasicSprite_ToWorld(RPGbasic *basic, RPGfloat x, RPGfloat y, RPGfloat *wx, RPGfloat *wy)
+{
+    // Ancestors are transformed directly, as their cached world transforms are only resolved before rendering
+    RPGmat4 local;
+    RPGfloat tx;
+    for (RPGbasic *node = basic->node.parent; node != NULL; node = node->node.parent)
+    {
+        RPG_BasicSprite_LocalTransform(node, node->x, node->y, 1.0f, 1.0f, &local);
+        tx = local.m11 * x + local.m21 * y + local.m41;
+        y  = local.m12 * x + local.m22 * y + local.m42;
+        x  = tx;
+    }
+    *wx = x;
+    *wy = y;
+}
+
+void RPG_BasicSprite_ResolveNodes(RPGbatch *roots)
+{
+    for (int i = 0; i < roots->total; i++)
+    {
+        RPG_BasicSprite_ResolveNode((RPGbasic *) roots->items[i], RPG_FALSE);
+    }
+}
+
+/**
+ * @brief Removes a node from the child list of its parent, without altering the list of root nodes.
+ *
+ * @param basic The node to unlink.
+ */
+static void RPG_BasicSprite_Unlink(RPGbasic *basic)
+{
+    RPGbasic *parent = basic->node.parent;
+    if (parent == NULL)
+    {
+        return;
+    }
+    RPGbasic **link = &parent->node.child;
+    while (*link != NULL && *link != basic)
+    {
+        link = &(*link)->node.next;
+    }
+    if (*link != NULL)
+    {
+        *link = basic->node.next;
+    }
+    basic->node.parent = NULL;
+    basic->node.next   = NULL;
+    basic->updated     = RPG_TRUE;
+
+    // A parentless node with no remaining children is no longer the root of a hierarchy
+    if (parent->node.parent == NULL && parent->node.child == NULL)
+    {
+        RPG_Batch_DeleteItem(&RPG_GAME->nodes, &parent->renderable);
+    }
+}
+
+void RPG_BasicSprite_Detach(RPGbasic *basic)
+{
+    RPG_ASSERT(basic);
+    RPG_BasicSprite_Unlink(basic);
+
+    // Orphaned children retain their local transform, and become roots of their own hierarchy if they have children
+    RPGbasic *child = basic->node.child, *next;
+    while (child != NULL)
+    {
+        next               = child->node.next;
+        child->node.parent = NULL;
+        child->node.next   = NULL;
+        child->updated     = RPG_TRUE;
+        if (child->node.child != NULL)
+        {
+            RPG_Batch_Add(&RPG_GAME->nodes, &child->renderable);
+        }
+        child = next;
+    }
+    basic->node.child = NULL;
+    RPG_Batch_DeleteItem(&RPG_GAME->nodes, &basic->renderable);
+    RPG_Tween_Detach(basic);
+    RPG_World_Detach(basic);
+}
+
+RPG_RESULT RPG_BasicSprite_GetParent(RPGbasic *basic, RPGbasic **parent)
+{
+    RPG_RETURN_IF_NULL(basic);
+    if (parent != NULL)
+    {
+        *parent = basic->node.parent;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_BasicSprite_SetParent(RPGbasic *basic, RPGbasic *parent)
+{
+    RPG_RETURN_IF_NULL(basic);
+    if (basic->node.parent == parent)
+    {
+        return RPG_NO_ERROR;
+    }
+    // Prevent cycles, an object cannot be parented to itself or any of its descendants
+    for (RPGbasic *node = parent; node != NULL; node = node->node.parent)
+    {
+        if (node == basic)
+        {
+            return RPG_ERR_INVALID_VALUE;
+        }
+    }
+
+    RPG_BasicSprite_Unlink(basic);
+    if (parent == NULL)
+    {
+        if (basic->node.child != NULL)
+        {
+            RPG_Batch_Add(&RPG_GAME->nodes, &basic->renderable);
+        }
+        return RPG_NO_ERROR;
+    }
+
+    // An object with children that gains a parent is no longer a root
+    if (basic->node.child != NULL)
+    {
+        RPG_Batch_DeleteItem(&RPG_GAME->nodes, &basic->renderable);
+    }
+    if (parent->node.parent == NULL && parent->node.child == NULL)
+    {
+        RPG_Batch_Add(&RPG_GAME->nodes, &parent->renderable);
+    }
+    basic->node.next   = parent->node.child;
+    basic->node.parent = parent;
+    parent->node.child = basic;
+    basic->updated     = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
 RPG_RESULT RPG_BasicSprite_Update(RPGbasic *basic)
 {
     RPG_RETURN_IF_NULL(basic);
@@ -236,3 +458,54 @@ RPG_RESULT RPG_BasicSprite_SetLocation(RPGbasic *basic, RPGint x, RPGint y)
     }
     return RPG_NO_ERROR;
 }
+
+RPG_RESULT RPG_BasicSprite_GetDistortion(RPGbasic *basic, RPG_DISTORTION type, RPGfloat *amplitude, RPGfloat *length, RPGfloat *speed,
+                                         RPGfloat *phase)
+{
+    RPG_RETURN_IF_NULL(basic);
+    if (type < RPG_DISTORTION_WAVE || type > RPG_DISTORTION_SWAY)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGvec4 *effect = &basic->distortion[type];
+    if (amplitude != NULL)
+    {
+        *amplitude = effect->x;
+    }
+    if (length != NULL)
+    {
+        *length = effect->y;
+    }
+    if (speed != NULL)
+    {
+        *speed = effect->z;
+    }
+    if (phase != NULL)
+    {
+        *phase = effect->w;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_BasicSprite_SetDistortion(RPGbasic *basic, RPG_DISTORTION type, RPGfloat amplitude, RPGfloat length, RPGfloat speed,
+                                         RPGfloat phase)
+{
+    RPG_RETURN_IF_NULL(basic);
+    if (type < RPG_DISTORTION_WAVE || type > RPG_DISTORTION_SWAY)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    basic->distortion[type] = (RPGvec4){amplitude, length, speed, phase};
+
+    // Only distorted objects pay for drawing the subdivided strip
+    basic->distorted = RPG_FALSE;
+    for (int i = RPG_DISTORTION_WAVE; i <= RPG_DISTORTION_SWAY; i++)
+    {
+        if (basic->distortion[i].x != 0.0f)
+        {
+            basic->distorted = RPG_TRUE;
+            break;
+        }
+    }
+    return RPG_NO_ERROR;
+}
@@ -83,9 +83,20 @@ void RPG_Batch_Delete(RPGbatch *v, int index)
 
 static inline int RPG_Batch_MedianOfThree(int a, int b, int c) { return imax(imin(a, b), imin(imax(a, b), c)); }
 
+static inline int RPG_Batch_Compare(RPGrenderable *a, RPGrenderable *b)
+{
+    if (a->z != b->z)
+    {
+        return a->z < b->z ? -1 : 1;
+    }
+    // Within the same z-level, group objects sharing a material to minimize program and uniform changes
+    uintptr_t ma = (uintptr_t) a->material, mb = (uintptr_t) b->material;
+    return (ma > mb) - (ma < mb);
+}
+
 void RPG_Batch_Sort(RPGbatch *v, int first, int last)
 {
-    // Basic qsort algorithm using z-axis
+    // Basic qsort algorithm using z-axis, then material
     int i, j, pivot;
     RPGrenderable *temp;
     if (first < last)
@@ -95,11 +106,11 @@ void RPG_Batch_Sort(RPGbatch *v, int first, int last)
         j     = last;
         while (i < j)
         {
-            while (v->items[i]->z <= v->items[pivot]->z && i < last)
+            while (RPG_Batch_Compare(v->items[i], v->items[pivot]) <= 0 && i < last)
             {
                 i++;
             }
-            while (v->items[j]->z > v->items[pivot]->z)
+            while (RPG_Batch_Compare(v->items[j], v->items[pivot]) > 0)
             {
                 j--;
             }
@@ -0,0 +1,117 @@
+#include "internal.h"
+
+// Returns a pointer to the element at the specified index of a strided array
+#define RPG_BULK_AT(type, data, stride, index) ((const type *) ((const RPGubyte *) (data) + (RPGsize)(index) * (stride)))
+
+// Validates the arguments common to every bulk function, and defaults the stride to a tightly packed array
+#define RPG_BULK_VALIDATE(objects, count, data, stride, type)                                                                              \
+    RPG_RETURN_IF_NULL(objects);                                                                                                           \
+    RPG_RETURN_IF_NULL(data);                                                                                                              \
+    if (count < 0)                                                                                                                         \
+    {                                                                                                                                      \
+        return RPG_ERR_OUT_OF_RANGE;                                                                                                       \
+    }                                                                                                                                      \
+    if (stride == 0)                                                                                                                       \
+    {                                                                                                                                      \
+        stride = sizeof(type);                                                                                                             \
+    }
+
+RPG_RESULT RPG_Bulk_SetLocation(RPGbasic **objects, RPGint count, const RPGint *locations, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(objects, count, locations, stride, RPGint[2]);
+    RPGbasic *basic;
+    const RPGint *xy;
+    for (RPGint i = 0; i < count; i++)
+    {
+        basic = objects[i];
+        if (basic == NULL)
+        {
+            continue;
+        }
+        xy = RPG_BULK_AT(RPGint, locations, stride, i);
+        if (xy[0] != basic->x || xy[1] != basic->y)
+        {
+            basic->x       = xy[0];
+            basic->y       = xy[1];
+            basic->updated = RPG_TRUE;
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Bulk_SetZ(RPGbasic **objects, RPGint count, const RPGint *z, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(objects, count, z, stride, RPGint);
+    RPGrenderable *r;
+    RPGint value;
+    for (RPGint i = 0; i < count; i++)
+    {
+        if (objects[i] == NULL)
+        {
+            continue;
+        }
+        r     = &objects[i]->renderable;
+        value = *RPG_BULK_AT(RPGint, z, stride, i);
+        if (value != r->z)
+        {
+            // Each batch is only flagged, sorting is deferred until it is next rendered
+            r->z               = value;
+            r->parent->updated = RPG_TRUE;
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Bulk_SetAlpha(RPGbasic **objects, RPGint count, const RPGfloat *alpha, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(objects, count, alpha, stride, RPGfloat);
+    for (RPGint i = 0; i < count; i++)
+    {
+        if (objects[i] != NULL)
+        {
+            objects[i]->alpha = RPG_CLAMPF(*RPG_BULK_AT(RPGfloat, alpha, stride, i), 0.0f, 1.0f);
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Bulk_SetColor(RPGbasic **objects, RPGint count, const RPGcolor *colors, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(objects, count, colors, stride, RPGcolor);
+    for (RPGint i = 0; i < count; i++)
+    {
+        if (objects[i] != NULL)
+        {
+            objects[i]->color = *RPG_BULK_AT(RPGcolor, colors, stride, i);
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Bulk_SetVisible(RPGbasic **objects, RPGint count, const RPGbool *visible, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(objects, count, visible, stride, RPGbool);
+    for (RPGint i = 0; i < count; i++)
+    {
+        if (objects[i] != NULL)
+        {
+            objects[i]->renderable.visible = *RPG_BULK_AT(RPGbool, visible, stride, i);
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Bulk_SetSourceRect(RPGsprite **sprites, RPGint count, const RPGrect *rects, RPGsize stride)
+{
+    RPG_BULK_VALIDATE(sprites, count, rects, stride, RPGrect);
+    RPGsprite *sprite;
+    for (RPGint i = 0; i < count; i++)
+    {
+        sprite = sprites[i];
+        if (sprite != NULL && sprite->image != NULL)
+        {
+            RPG_Sprite_SetSource(sprite, (RPGrect *) RPG_BULK_AT(RPGrect, rects, stride, i));
+        }
+    }
+    return RPG_NO_ERROR;
+}
@@ -0,0 +1,266 @@
+#include "internal.h"
+
+/****************************************************************************************
+ * Extension Loading
+ ****************************************************************************************/
+
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+
+// OpenGL 4.5 / ARB_direct_state_access
+static void(APIENTRYP _glCreateTextures)(GLenum target, GLsizei n, GLuint *textures);
+static void(APIENTRYP _glTextureStorage2D)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+static void(APIENTRYP _glTextureSubImage2D)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height,
+                                            GLenum format, GLenum type, const void *pixels);
+static void(APIENTRYP _glTextureParameteri)(GLuint texture, GLenum pname, GLint param);
+static void(APIENTRYP _glCreateFramebuffers)(GLsizei n, GLuint *framebuffers);
+static void(APIENTRYP _glNamedFramebufferTexture)(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level);
+static void(APIENTRYP _glCreateBuffers)(GLsizei n, GLuint *buffers);
+static void(APIENTRYP _glNamedBufferSubData)(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data);
+static void *(APIENTRYP _glMapNamedBufferRange)(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+static GLboolean(APIENTRYP _glUnmapNamedBuffer)(GLuint buffer);
+static void(APIENTRYP _glCreateVertexArrays)(GLsizei n, GLuint *arrays);
+static void(APIENTRYP _glVertexArrayVertexBuffer)(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+static void(APIENTRYP _glEnableVertexArrayAttrib)(GLuint vaobj, GLuint index);
+static void(APIENTRYP _glVertexArrayAttribFormat)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized,
+                                                  GLuint relativeoffset);
+static void(APIENTRYP _glVertexArrayAttribBinding)(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+
+// OpenGL 4.4 / ARB_buffer_storage
+static void(APIENTRYP _glNamedBufferStorage)(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags);
+
+/**
+ * @brief Queries whether the current context advertises the specified extension.
+ *
+ * @param name The name of the extension.
+ * @return RPGbool RPG_TRUE if the extension is supported, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_Drawing_HasExtension(const char *name)
+{
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        const char *ext = (const char *) glGetStringi(GL_EXTENSIONS, i);
+        if (ext != NULL && strcmp(ext, name) == 0)
+        {
+            return RPG_TRUE;
+        }
+    }
+    return RPG_FALSE;
+}
+
+#define RPG_LOAD_PROC(proc, name)                                                                                                          \
+    *(void **) (&proc) = (void *) glfwGetProcAddress(name);                                                                                \
+    loaded             = loaded && proc != NULL
+
+void RPG_Drawing_Initialize(RPGgame *game)
+{
+    RPG_ASSERT(game);
+    glGetIntegerv(GL_MAJOR_VERSION, &game->gl.major);
+    glGetIntegerv(GL_MINOR_VERSION, &game->gl.minor);
+    game->gl.dsa = RPG_FALSE;
+    memset(_texture, 0, sizeof(_texture));
+    _unit    = GL_TEXTURE0;
+    _program = 0;
+
+#ifndef RPG_WITHOUT_DSA
+    RPGbool core45 = game->gl.major > 4 || (game->gl.major == 4 && game->gl.minor >= 5);
+    if (!core45 && (!RPG_Drawing_HasExtension("GL_ARB_direct_state_access") || !RPG_Drawing_HasExtension("GL_ARB_buffer_storage")))
+    {
+        return;
+    }
+
+    // Both are core in 4.5, and the ARB extensions use the same un-suffixed entry points
+    RPGbool loaded = RPG_TRUE;
+    RPG_LOAD_PROC(_glCreateTextures, "glCreateTextures");
+    RPG_LOAD_PROC(_glTextureStorage2D, "glTextureStorage2D");
+    RPG_LOAD_PROC(_glTextureSubImage2D, "glTextureSubImage2D");
+    RPG_LOAD_PROC(_glTextureParameteri, "glTextureParameteri");
+    RPG_LOAD_PROC(_glCreateFramebuffers, "glCreateFramebuffers");
+    RPG_LOAD_PROC(_glNamedFramebufferTexture, "glNamedFramebufferTexture");
+    RPG_LOAD_PROC(_glCreateBuffers, "glCreateBuffers");
+    RPG_LOAD_PROC(_glNamedBufferStorage, "glNamedBufferStorage");
+    RPG_LOAD_PROC(_glNamedBufferSubData, "glNamedBufferSubData");
+    RPG_LOAD_PROC(_glMapNamedBufferRange, "glMapNamedBufferRange");
+    RPG_LOAD_PROC(_glUnmapNamedBuffer, "glUnmapNamedBuffer");
+    RPG_LOAD_PROC(_glCreateVertexArrays, "glCreateVertexArrays");
+    RPG_LOAD_PROC(_glVertexArrayVertexBuffer, "glVertexArrayVertexBuffer");
+    RPG_LOAD_PROC(_glEnableVertexArrayAttrib, "glEnableVertexArrayAttrib");
+    RPG_LOAD_PROC(_glVertexArrayAttribFormat, "glVertexArrayAttribFormat");
+    RPG_LOAD_PROC(_glVertexArrayAttribBinding, "glVertexArrayAttribBinding");
+    game->gl.dsa = loaded;
+#endif
+}
+
+/****************************************************************************************
+ * Textures
+ ****************************************************************************************/
+
+GLuint RPG_Drawing_CreateTexture(GLsizei width, GLsizei height, GLenum internalFormat, GLenum format, const void *pixels, GLenum wrap,
+                                 GLenum filter)
+{
+    GLuint texture;
+    if (RPG_GAME->gl.dsa)
+    {
+        // Immutable storage, never bound to a texture unit, leaving the unit cache untouched
+        _glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        if (width > 0 && height > 0)
+        {
+            _glTextureStorage2D(texture, 1, internalFormat, width, height);
+            if (pixels != NULL)
+            {
+                _glTextureSubImage2D(texture, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, pixels);
+            }
+        }
+        _glTextureParameteri(texture, GL_TEXTURE_WRAP_S, wrap);
+        _glTextureParameteri(texture, GL_TEXTURE_WRAP_T, wrap);
+        _glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, filter);
+        _glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, filter);
+    }
+    else
+    {
+        glGenTextures(1, &texture);
+        RPG_Drawing_BindTexture(texture, GL_TEXTURE0);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    }
+    return texture;
+}
+
+void RPG_Drawing_DeleteTexture(GLuint texture)
+{
+    if (texture == 0)
+    {
+        return;
+    }
+    // Names are recycled by the driver, so the cache must forget the texture or a new one may never get bound
+    for (int i = 0; i < 32; i++)
+    {
+        if (_texture[i] == texture)
+        {
+            _texture[i] = 0;
+        }
+    }
+    glDeleteTextures(1, &texture);
+}
+
+GLuint RPG_Drawing_CreateFramebuffer(GLuint texture)
+{
+    GLuint fbo;
+    if (RPG_GAME->gl.dsa)
+    {
+        _glCreateFramebuffers(1, &fbo);
+        _glNamedFramebufferTexture(fbo, GL_COLOR_ATTACHMENT0, texture, 0);
+    }
+    else
+    {
+        GLint current;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &current);
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint) current);
+    }
+    return fbo;
+}
+
+/****************************************************************************************
+ * Buffers
+ ****************************************************************************************/
+
+/**
+ * @brief Creates a vertex buffer, with immutable storage when direct state access is available.
+ *
+ * Every buffer can be updated with RPG_Drawing_BufferSubData, and dynamic buffers can also be mapped.
+ *
+ * @param size The size of the buffer, in bytes.
+ * @param data The initial contents of the buffer, or NULL to leave it undefined.
+ * @param dynamic RPG_TRUE if the buffer is updated frequently, otherwise RPG_FALSE.
+ * @return GLuint The name of the created buffer.
+ */
+GLuint RPG_Drawing_CreateBuffer(GLsizeiptr size, const void *data, RPGbool dynamic)
+{
+    GLuint buffer;
+    if (RPG_GAME->gl.dsa && size > 0)
+    {
+        // Storage allows updates regardless, the same as glBufferData, where the usage is only a hint
+        GLbitfield flags = dynamic ? (GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT) : GL_DYNAMIC_STORAGE_BIT;
+        _glCreateBuffers(1, &buffer);
+        _glNamedBufferStorage(buffer, size, data, flags);
+    }
+    else
+    {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, size, data, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    return buffer;
+}
+
+void RPG_Drawing_BufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    if (RPG_GAME->gl.dsa)
+    {
+        _glNamedBufferSubData(buffer, offset, size, data);
+    }
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+}
+
+void *RPG_Drawing_MapBuffer(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    if (RPG_GAME->gl.dsa)
+    {
+        return _glMapNamedBufferRange(buffer, offset, length, GL_MAP_WRITE_BIT);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    return glMapBufferRange(GL_ARRAY_BUFFER, offset, length, GL_MAP_WRITE_BIT);
+}
+
+void RPG_Drawing_UnmapBuffer(GLuint buffer)
+{
+    if (RPG_GAME->gl.dsa)
+    {
+        _glUnmapNamedBuffer(buffer);
+    }
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+}
+
+GLuint RPG_Drawing_CreateVertexArray(GLuint vbo)
+{
+    GLuint vao;
+    if (RPG_GAME->gl.dsa)
+    {
+        _glCreateVertexArrays(1, &vao);
+        _glVertexArrayVertexBuffer(vao, 0, vbo, 0, VERTICES_STRIDE);
+        _glEnableVertexArrayAttrib(vao, 0);
+        _glVertexArrayAttribFormat(vao, 0, 4, GL_FLOAT, GL_FALSE, 0);
+        _glVertexArrayAttribBinding(vao, 0, 0);
+    }
+    else
+    {
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, VERTICES_STRIDE, NULL);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+    return vao;
+}
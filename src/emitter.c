@@ -0,0 +1,591 @@
+#include "internal.h"
+
+// The number of arrays in the particle structure of arrays
+#define RPG_EMITTER_ARRAYS 9
+
+/****************************************************************************************
+ * Helper Functions
+ ****************************************************************************************/
+
+/**
+ * @brief Returns a pseudo-random value in the range of 0.0 to 1.0, advancing the state of the emitter's generator.
+ *
+ * @param e The emitter.
+ * @return RPGfloat The random value.
+ */
+static inline RPGfloat RPG_Emitter_Random(RPGemitter *e)
+{
+    // xorshift32, fast and more than adequate for visual effects
+    RPGuint x = e->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    e->seed = x;
+    return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+static inline RPGfloat RPG_Emitter_Range(RPGemitter *e, RPGfloat min, RPGfloat max)
+{
+    return min + (max - min) * RPG_Emitter_Random(e);
+}
+
+/**
+ * @brief Samples a ramp of evenly spaced keys.
+ *
+ * @param keys The components of the first key.
+ * @param stride The number of components in each key.
+ * @param count The number of keys.
+ * @param t The position to sample at, in the range of 0.0 to 1.0.
+ * @param result Receives the interpolated components.
+ */
+static inline void RPG_Emitter_SampleRamp(const RPGfloat *keys, RPGint stride, RPGint count, RPGfloat t, RPGfloat *result)
+{
+    RPGfloat pos      = t * (count - 1);
+    RPGint index      = imin((RPGint) pos, count - 2);
+    RPGfloat frac     = pos - index;
+    const RPGfloat *a = &keys[index * stride];
+    const RPGfloat *b = &keys[(index + 1) * stride];
+    for (RPGint i = 0; i < stride; i++)
+    {
+        result[i] = a[i] + (b[i] - a[i]) * frac;
+    }
+}
+
+/**
+ * @brief Compiles the particle program shared by all emitters on first use.
+ *
+ * @param game The game instance.
+ * @return RPG_RESULT The result of the operation.
+ */
+static RPG_RESULT RPG_Emitter_EnsureProgram(RPGgame *game)
+{
+    if (game->particles.program != 0)
+    {
+        return RPG_NO_ERROR;
+    }
+    RPGshader *shader;
+    RPG_RESULT result = RPG_Shader_Create(RPG_PARTICLE_VERTEX, RPG_PARTICLE_FRAGMENT, NULL, &shader);
+    if (result)
+    {
+        return result;
+    }
+
+    // Only need the shader name for storing within the game structure
+    game->particles.program = shader->program;
+    RPG_FREE(shader);
+
+    GLuint program                    = game->particles.program;
+    game->particles.projection        = glGetUniformLocation(program, UNIFORM_PROJECTION);
+    game->particles.model             = glGetUniformLocation(program, UNIFORM_MODEL);
+    game->particles.color             = glGetUniformLocation(program, UNIFORM_COLOR);
+    game->particles.tone              = glGetUniformLocation(program, UNIFORM_TONE);
+    game->particles.alpha             = glGetUniformLocation(program, UNIFORM_ALPHA);
+    game->particles.hue               = glGetUniformLocation(program, UNIFORM_HUE);
+    game->particles.flash             = glGetUniformLocation(program, UNIFORM_FLASH);
+    game->particles.source            = glGetUniformLocation(program, UNIFORM_SOURCE);
+    game->particles.frames            = glGetUniformLocation(program, "frames");
+    game->particles.projectionVersion = _projectionVersion - 1;
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Removes the particle at the specified index by moving the last live particle into its place.
+ *
+ * @param e The emitter.
+ * @param i The index of the particle to remove.
+ */
+static inline void RPG_Emitter_Kill(RPGemitter *e, RPGint i)
+{
+    RPGint last           = --e->count;
+    e->particles.x[i]     = e->particles.x[last];
+    e->particles.y[i]     = e->particles.y[last];
+    e->particles.vx[i]    = e->particles.vx[last];
+    e->particles.vy[i]    = e->particles.vy[last];
+    e->particles.angle[i] = e->particles.angle[last];
+    e->particles.spin[i]  = e->particles.spin[last];
+    e->particles.age[i]   = e->particles.age[last];
+    e->particles.life[i]  = e->particles.life[last];
+    e->particles.frame[i] = e->particles.frame[last];
+}
+
+/**
+ * @brief Spawns new particles, limited by the capacity of the emitter.
+ *
+ * @param e The emitter.
+ * @param count The number of particles to spawn.
+ */
+static void RPG_Emitter_Spawn(RPGemitter *e, RPGint count)
+{
+    count          = imin(count, e->capacity - e->count);
+    RPGfloat cells = (RPGfloat)(e->frames.columns * e->frames.rows);
+    RPGfloat speed, dir;
+    for (RPGint i = e->count; i < e->count + count; i++)
+    {
+        e->particles.x[i]     = (RPG_Emitter_Random(e) - 0.5f) * e->area.width;
+        e->particles.y[i]     = (RPG_Emitter_Random(e) - 0.5f) * e->area.height;
+        speed                 = RPG_Emitter_Range(e, e->speed.min, e->speed.max);
+        dir                   = e->direction + RPG_Emitter_Range(e, -e->spread, e->spread);
+        e->particles.vx[i]    = cosf(dir) * speed;
+        e->particles.vy[i]    = sinf(dir) * speed;
+        e->particles.angle[i] = 0.0f;
+        e->particles.spin[i]  = RPG_Emitter_Range(e, e->spin.min, e->spin.max);
+        e->particles.age[i]   = 0.0f;
+        e->particles.life[i]  = fmaxf(RPG_Emitter_Range(e, e->life.min, e->life.max), __FLT_EPSILON__);
+        e->particles.frame[i] = fminf(floorf(RPG_Emitter_Random(e) * cells), cells - 1.0f);
+    }
+    e->count += count;
+}
+
+/**
+ * @brief Advances the simulation of an emitter by a single update.
+ *
+ * @param e The emitter.
+ * @param delta The number of seconds that have elapsed.
+ */
+static void RPG_Emitter_Step(RPGemitter *e, RPGfloat delta)
+{
+    if (e->count == 0 && !e->emitting)
+    {
+        return;
+    }
+    RPGint count = e->count;
+
+    // Each attribute is integrated in its own loop over contiguous memory, which compilers readily vectorize
+    RPGfloat gx = e->gravity.x * delta, gy = e->gravity.y * delta;
+    RPGfloat *restrict vx = e->particles.vx, *restrict vy = e->particles.vy;
+    for (RPGint i = 0; i < count; i++)
+    {
+        vx[i] += gx;
+        vy[i] += gy;
+    }
+    RPGfloat *restrict x = e->particles.x, *restrict y = e->particles.y;
+    for (RPGint i = 0; i < count; i++)
+    {
+        x[i] += vx[i] * delta;
+        y[i] += vy[i] * delta;
+    }
+    RPGfloat *restrict angle = e->particles.angle, *restrict spin = e->particles.spin;
+    for (RPGint i = 0; i < count; i++)
+    {
+        angle[i] += spin[i] * delta;
+    }
+    RPGfloat *restrict age = e->particles.age;
+    for (RPGint i = 0; i < count; i++)
+    {
+        age[i] += delta;
+    }
+
+    // Remove expired particles, iterating backwards so that moved particles have already been tested
+    for (RPGint i = count - 1; i >= 0; i--)
+    {
+        if (e->particles.age[i] >= e->particles.life[i])
+        {
+            RPG_Emitter_Kill(e, i);
+        }
+    }
+
+    if (e->emitting && e->rate > 0.0f)
+    {
+        e->budget += e->rate * delta;
+        RPGint spawn = (RPGint) e->budget;
+        e->budget -= spawn;
+        RPG_Emitter_Spawn(e, spawn);
+    }
+    e->dirty = RPG_TRUE;
+}
+
+void RPG_Emitter_UpdateAll(RPGgame *game)
+{
+    RPGfloat delta = (RPGfloat) game->update.tick;
+    for (int i = 0; i < game->particles.emitters.total; i++)
+    {
+        RPG_Emitter_Step((RPGemitter *) game->particles.emitters.items[i], delta);
+    }
+}
+
+/**
+ * @brief Builds the instance data of the live particles, and uploads it to the instance buffer.
+ *
+ * @param e The emitter.
+ */
+static void RPG_Emitter_Upload(RPGemitter *e)
+{
+    RPGfloat cells = (RPGfloat)(e->frames.columns * e->frames.rows);
+    RPGfloat rgba[4], opacity, t;
+    RPGparticlevertex *v;
+    for (RPGint i = 0; i < e->count; i++)
+    {
+        t           = e->particles.age[i] / e->particles.life[i];
+        v           = &e->vertices[i];
+        v->x        = e->particles.x[i];
+        v->y        = e->particles.y[i];
+        v->size     = e->size.start + (e->size.end - e->size.start) * t;
+        v->rotation = e->particles.angle[i];
+        v->frame    = e->frames.animate ? fminf(floorf(t * cells), cells - 1.0f) : e->particles.frame[i];
+
+        if (e->color.count > 1)
+        {
+            RPG_Emitter_SampleRamp((const RPGfloat *) e->color.keys, 4, e->color.count, t, rgba);
+        }
+        else
+        {
+            memcpy(rgba, &e->color.keys[0], sizeof(RPGcolor));
+        }
+        if (e->alpha.count > 1)
+        {
+            RPG_Emitter_SampleRamp(e->alpha.keys, 1, e->alpha.count, t, &opacity);
+            rgba[3] *= opacity;
+        }
+        else
+        {
+            rgba[3] *= e->alpha.keys[0];
+        }
+        v->color[0] = (RPGubyte)(RPG_CLAMPF(rgba[0], 0.0f, 1.0f) * 255.0f);
+        v->color[1] = (RPGubyte)(RPG_CLAMPF(rgba[1], 0.0f, 1.0f) * 255.0f);
+        v->color[2] = (RPGubyte)(RPG_CLAMPF(rgba[2], 0.0f, 1.0f) * 255.0f);
+        v->color[3] = (RPGubyte)(RPG_CLAMPF(rgba[3], 0.0f, 1.0f) * 255.0f);
+    }
+    RPG_Drawing_BufferSubData(e->vbo, 0, sizeof(RPGparticlevertex) * e->count, e->vertices);
+    e->dirty = RPG_FALSE;
+}
+
+static void RPG_Emitter_Render(void *emitter)
+{
+    RPGemitter *e = emitter;
+    if (!e->base.renderable.visible || e->base.alpha < __FLT_EPSILON__ || e->image == NULL || e->count == 0)
+    {
+        // No-op if emitter won't be visible
+        return;
+    }
+    if (e->base.updated)
+    {
+        RPGint ox = 0, oy = 0;
+        if (e->viewport != NULL)
+        {
+            ox = e->viewport->base.ox;
+            oy = e->viewport->base.oy;
+        }
+        RPG_BasicSprite_UpdateModel(&e->base, e->base.x, e->base.y, 1.0f, 1.0f, ox, oy);
+        e->base.updated = RPG_FALSE;
+    }
+    if (e->dirty)
+    {
+        RPG_Emitter_Upload(e);
+    }
+
+    RPGgame *game = RPG_GAME;
+    RPG_Drawing_UseProgram(game->particles.program);
+    if (game->particles.projectionVersion != _projectionVersion)
+    {
+        glUniformMatrix4fv(game->particles.projection, 1, GL_FALSE, (GLfloat *) &_projection);
+        game->particles.projectionVersion = _projectionVersion;
+    }
+    glUniform2f(game->particles.frames, (GLfloat) e->frames.columns, (GLfloat) e->frames.rows);
+    RPG_BASE_UNIFORMS_EX(game->particles, e->base);
+
+    RPG_Drawing_BindTexture(e->image->texture, GL_TEXTURE0);
+    glBindVertexArray(e->vao);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, e->count);
+}
+
+/****************************************************************************************
+ * Emitter
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Emitter_Create(RPGviewport *viewport, RPGint capacity, RPGemitter **emitter)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (capacity < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_RESULT result = RPG_Emitter_EnsureProgram(RPG_GAME);
+    if (result)
+    {
+        return result;
+    }
+
+    RPG_ALLOC_ZERO(e, RPGemitter);
+    RPGbatch *batch = viewport ? &viewport->batch : &RPG_GAME->batch;
+    RPG_BasicSprite_Init(&e->base, RPG_Emitter_Render, batch);
+    e->viewport = viewport;
+    e->capacity = capacity;
+    e->emitting = RPG_TRUE;
+    e->seed     = 0x9E3779B9u ^ (RPGuint)(uintptr_t) e;
+
+    // Allocate the arrays as a single block so the particles occupy as few cache lines as possible
+    RPGfloat *block    = RPG_MALLOC(sizeof(RPGfloat) * capacity * RPG_EMITTER_ARRAYS);
+    e->particles.x     = block;
+    e->particles.y     = block + capacity;
+    e->particles.vx    = block + capacity * 2;
+    e->particles.vy    = block + capacity * 3;
+    e->particles.angle = block + capacity * 4;
+    e->particles.spin  = block + capacity * 5;
+    e->particles.age   = block + capacity * 6;
+    e->particles.life  = block + capacity * 7;
+    e->particles.frame = block + capacity * 8;
+    e->vertices        = RPG_ALLOC_N(RPGparticlevertex, capacity);
+
+    // Sensible defaults, a gentle upward stream of white particles
+    e->rate           = 10.0f;
+    e->life.min       = 1.0f;
+    e->life.max       = 1.0f;
+    e->speed.min      = 32.0f;
+    e->speed.max      = 32.0f;
+    e->direction      = -RPG_PI / 2.0f;
+    e->size.start     = 8.0f;
+    e->size.end       = 8.0f;
+    e->frames.columns = 1;
+    e->frames.rows    = 1;
+    e->color.keys[0]  = (RPGcolor){1.0f, 1.0f, 1.0f, 1.0f};
+    e->color.count    = 1;
+    e->alpha.keys[0]  = 1.0f;
+    e->alpha.count    = 1;
+
+    // Instance buffer, with every attribute advanced once per particle
+    e->vbo = RPG_Drawing_CreateBuffer(sizeof(RPGparticlevertex) * capacity, NULL, RPG_TRUE);
+    glGenVertexArrays(1, &e->vao);
+    glBindVertexArray(e->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, e->vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(RPGparticlevertex), (void *) offsetof(RPGparticlevertex, x));
+    glVertexAttribDivisor(0, 1);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(RPGparticlevertex), (void *) offsetof(RPGparticlevertex, color));
+    glVertexAttribDivisor(1, 1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(RPGparticlevertex), (void *) offsetof(RPGparticlevertex, frame));
+    glVertexAttribDivisor(2, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    RPG_Batch_Add(&RPG_GAME->particles.emitters, &e->base.renderable);
+    *emitter = e;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_Free(RPGemitter *emitter)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    RPG_Batch_DeleteItem(&RPG_GAME->particles.emitters, &emitter->base.renderable);
+    RPG_BasicSprite_Detach(&emitter->base);
+    RPG_Renderable_Free(&emitter->base.renderable);
+    glDeleteVertexArrays(1, &emitter->vao);
+    glDeleteBuffers(1, &emitter->vbo);
+    RPG_FREE(emitter->particles.x);
+    RPG_FREE(emitter->vertices);
+    RPG_FREE(emitter);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetViewport(RPGemitter *emitter, RPGviewport **viewport)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (viewport != NULL)
+    {
+        *viewport = emitter->viewport;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetImage(RPGemitter *emitter, RPGimage **image)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (image != NULL)
+    {
+        *image = emitter->image;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetImage(RPGemitter *emitter, RPGimage *image)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->image = image;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetFrames(RPGemitter *emitter, RPGint columns, RPGint rows, RPGbool animate)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (columns < 1 || rows < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    emitter->frames.columns = columns;
+    emitter->frames.rows    = rows;
+    emitter->frames.animate = animate;
+
+    // Keep the frames of live particles within the new bounds
+    RPGfloat cells = (RPGfloat)(columns * rows);
+    for (RPGint i = 0; i < emitter->count; i++)
+    {
+        emitter->particles.frame[i] = fmodf(emitter->particles.frame[i], cells);
+    }
+    emitter->dirty = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetCapacity(RPGemitter *emitter, RPGint *capacity)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (capacity != NULL)
+    {
+        *capacity = emitter->capacity;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetCount(RPGemitter *emitter, RPGint *count)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (count != NULL)
+    {
+        *count = emitter->count;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetEmitting(RPGemitter *emitter, RPGbool *emitting)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (emitting != NULL)
+    {
+        *emitting = emitter->emitting;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetEmitting(RPGemitter *emitter, RPGbool emitting)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->emitting = emitting;
+    emitter->budget   = 0.0f;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_GetRate(RPGemitter *emitter, RPGfloat *rate)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (rate != NULL)
+    {
+        *rate = emitter->rate;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetRate(RPGemitter *emitter, RPGfloat rate)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->rate = fmaxf(rate, 0.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_Burst(RPGemitter *emitter, RPGint count)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (count > 0)
+    {
+        RPG_Emitter_Spawn(emitter, count);
+        emitter->dirty = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_Clear(RPGemitter *emitter)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->count  = 0;
+    emitter->budget = 0.0f;
+    emitter->dirty  = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetArea(RPGemitter *emitter, RPGfloat width, RPGfloat height)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->area.width  = fmaxf(width, 0.0f);
+    emitter->area.height = fmaxf(height, 0.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetLife(RPGemitter *emitter, RPGfloat min, RPGfloat max)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    if (min <= 0.0f || max < min)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    emitter->life.min = min;
+    emitter->life.max = max;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetSpeed(RPGemitter *emitter, RPGfloat min, RPGfloat max)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->speed.min = min;
+    emitter->speed.max = max;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetDirection(RPGemitter *emitter, RPGfloat direction, RPGfloat spread)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->direction = direction;
+    emitter->spread    = fabsf(spread);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetGravity(RPGemitter *emitter, RPGfloat x, RPGfloat y)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->gravity.x = x;
+    emitter->gravity.y = y;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetSize(RPGemitter *emitter, RPGfloat start, RPGfloat end)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->size.start = fmaxf(start, 0.0f);
+    emitter->size.end   = fmaxf(end, 0.0f);
+    emitter->dirty      = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetSpin(RPGemitter *emitter, RPGfloat min, RPGfloat max)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    emitter->spin.min = min;
+    emitter->spin.max = max;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetColorRamp(RPGemitter *emitter, RPGcolor *colors, RPGint count)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    RPG_RETURN_IF_NULL(colors);
+    if (count < 1 || count > RPG_EMITTER_MAX_KEYS)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    memcpy(emitter->color.keys, colors, sizeof(RPGcolor) * count);
+    emitter->color.count = count;
+    emitter->dirty       = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Emitter_SetAlphaRamp(RPGemitter *emitter, RPGfloat *values, RPGint count)
+{
+    RPG_RETURN_IF_NULL(emitter);
+    RPG_RETURN_IF_NULL(values);
+    if (count < 1 || count > RPG_EMITTER_MAX_KEYS)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    memcpy(emitter->alpha.keys, values, sizeof(RPGfloat) * count);
+    emitter->alpha.count = count;
+    emitter->dirty       = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
@@ -94,13 +94,7 @@ static void RPG_Font_GetGlyph(RPGfont *font, int codepoint, RPGglyph **glyph)
         stbtt_GetCodepointHMetrics(&font->font, codepoint, &advance, NULL);
         g->advance = fs->scale * advance;
 
-        glGenTextures(1, &g->tex);
-        RPG_Drawing_BindTexture(g->tex, GL_TEXTURE0);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, g->w, g->h, 0, GL_RED, GL_UNSIGNED_BYTE, bmp);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        g->tex = RPG_Drawing_CreateTexture(g->w, g->h, GL_R8, GL_RED, bmp, GL_CLAMP_TO_EDGE, GL_NEAREST);
         stbtt_FreeBitmap(bmp, NULL);
         HASH_ADD(hh, fs->glyphs, codepoint, sizeof(RPGint), g);
     }
@@ -117,15 +111,8 @@ static void RPG_Font_Initialize(RPGgame *game)
     game->font.projection = glGetUniformLocation(game->font.program, "projection");
     game->font.color      = glGetUniformLocation(game->font.program, "color");
 
-    glGenVertexArrays(1, &game->font.vao);
-    glGenBuffers(1, &game->font.vbo);
-    glBindVertexArray(game->font.vao);
-    glBindBuffer(GL_ARRAY_BUFFER, game->font.vbo);
-    glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), NULL);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    game->font.vbo = RPG_Drawing_CreateBuffer(VERTICES_SIZE, NULL, RPG_TRUE);
+    game->font.vao = RPG_Drawing_CreateVertexArray(game->font.vbo);
 
     RPG_FREE(shader);
 }
@@ -175,7 +162,7 @@ RPG_RESULT RPG_Font_Free(RPGfont *font)
         RPGglyph *glyph, *tmpGlyph;
         HASH_ITER(hh, size->glyphs, glyph, tmpGlyph)
         {
-            glDeleteTextures(1, &glyph->tex);
+            RPG_Drawing_DeleteTexture(glyph->tex);
             RPG_FREE(glyph);
         }
         if (size->glyphs)
@@ -339,7 +326,7 @@ RPG_RESULT RPG_Font_DrawText(RPGfont *font, RPGimage *image, const char *text, R
     RPG_Font_AlignAdjust(&d, align, dimX, dimY, (RPGint)(fs->scale * fs->descent));
 
     // Enable the font shader, bind the FBO, and set the projection matrix
-    glUseProgram(RPG_GAME->font.program);
+    RPG_Drawing_UseProgram(RPG_GAME->font.program);
     RPG_ENSURE_FBO(image);
     RPGmat4 ortho;
     RPG_MAT4_ORTHO(ortho, 0.0f, image->width, image->height, 0.0f, -1.0f, 1.0f);
@@ -351,7 +338,6 @@ RPG_RESULT RPG_Font_DrawText(RPGfont *font, RPGimage *image, const char *text, R
 
     glActiveTexture(GL_TEXTURE0);
     glBindVertexArray(RPG_GAME->font.vao);
-    glBindBuffer(GL_ARRAY_BUFFER, RPG_GAME->font.vbo);
     RPG_Drawing_SetBlending(GL_FUNC_ADD, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -376,7 +362,7 @@ RPG_RESULT RPG_Font_DrawText(RPGfont *font, RPGimage *image, const char *text, R
         RPG_Drawing_BindTexture(glyph->tex, GL_TEXTURE0);
         GLfloat vertices[VERTICES_COUNT] = {x, y + h, 0.0f, 1.0f, x + w, y,     1.0f, 0.0f, x,     y, 0.0f, 0.0f,
                                             x, y + h, 0.0f, 1.0f, x + w, y + h, 1.0f, 1.0f, x + w, y, 1.0f, 0.0f};
-        glBufferSubData(GL_ARRAY_BUFFER, 0, VERTICES_SIZE, vertices);
+        RPG_Drawing_BufferSubData(RPG_GAME->font.vbo, 0, VERTICES_SIZE, vertices);
         glDrawArrays(GL_TRIANGLES, 0, 6);
 
         // Check if there is another codepoint to render after this one, if so, apply kerning
@@ -394,8 +380,8 @@ RPG_RESULT RPG_Font_DrawText(RPGfont *font, RPGimage *image, const char *text, R
     // glBindVertexArray(0);
 
     // Restore projection to the primary framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glUseProgram(RPG_GAME->shader.program);
+    RPG_BIND_TARGET();
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
     RPG_RESET_PROJECTION();
     RPG_RESET_VIEWPORT();
 
@@ -42,6 +42,12 @@ static void RPG_Game_FramebufferResize(GLFWwindow *window, int width, int height
         glViewport(0, 0, width, height);
         glScissor(0, 0, width, height);
     }
+    // Resizing never occurs mid-frame, so the window is the render target
+    g->target.fbo = 0;
+    g->target.x   = g->bounds.x;
+    g->target.y   = g->bounds.y;
+    g->target.w   = g->bounds.w;
+    g->target.h   = g->bounds.h;
     if (g->cb.resized)
     {
         g->cb.resized(g, width, height);
@@ -146,7 +152,7 @@ static RPG_RESULT RPG_Game_CreateShaderProgram(RPGgame *game)
     // Only need the shader name for storing within the game structure
     game->shader.program = *((GLuint *) shader);
     RPG_FREE(shader);
-    glUseProgram(game->shader.program);
+    RPG_Drawing_UseProgram(game->shader.program);
 
     // Pre-cache the uniform locations
     game->shader.projection = glGetUniformLocation(game->shader.program, UNIFORM_PROJECTION);
@@ -156,6 +162,9 @@ static RPG_RESULT RPG_Game_CreateShaderProgram(RPGgame *game)
     game->shader.alpha      = glGetUniformLocation(game->shader.program, UNIFORM_ALPHA);
     game->shader.hue        = glGetUniformLocation(game->shader.program, UNIFORM_HUE);
     game->shader.flash      = glGetUniformLocation(game->shader.program, UNIFORM_FLASH);
+    game->shader.source     = glGetUniformLocation(game->shader.program, UNIFORM_SOURCE);
+    game->shader.distortion = glGetUniformLocation(game->shader.program, UNIFORM_DISTORTION);
+    game->shader.time       = glGetUniformLocation(game->shader.program, UNIFORM_TIME);
 
     return RPG_NO_ERROR;
 }
@@ -196,7 +205,7 @@ RPG_RESULT RPG_Game_SetResolution(RPGgame *game, RPGint width, RPGint height)
 
     // Update projection in the shader
     RPG_MAT4_ORTHO(game->projection, 0.0f, game->resolution.width, 0.0f, game->resolution.height, -1.0f, 1.0f);
-    glUniformMatrix4fv(game->shader.projection, 1, GL_FALSE, (float *) &game->projection);
+    RPG_Drawing_SetProjection(&game->projection);
 
     // Fake a framebuffer resize event to recalulate rendering area
     int w, h;
@@ -207,6 +216,17 @@ RPG_RESULT RPG_Game_SetResolution(RPGgame *game, RPGint width, RPGint height)
 
 RPG_RESULT RPG_Game_Destroy(RPGgame *game)
 {
+    RPG_Screen_Free(game);
+    RPG_PostFX_Terminate(game);
+    glDeleteProgram(game->light.program);
+    glDeleteProgram(game->particles.program);
+    glDeleteProgram(game->primitives.program);
+    glDeleteVertexArrays(1, &game->quad.vao);
+    glDeleteBuffers(1, &game->quad.vbo);
+    glDeleteVertexArrays(1, &game->unit.vao);
+    glDeleteBuffers(1, &game->unit.vbo);
+    glDeleteVertexArrays(1, &game->strip.vao);
+    glDeleteBuffers(1, &game->strip.vbo);
     glfwTerminate();
 #ifndef RPG_WITHOUT_OPENAL
     RPG_Audio_Terminate();
@@ -214,6 +234,15 @@ RPG_RESULT RPG_Game_Destroy(RPGgame *game)
     alcCloseDevice(game->audio.device);
 #endif
     RPG_Batch_Free(&game->batch);  // TODO: Check if initialized first
+    RPG_Batch_Free(&game->nodes);
+    RPG_Batch_Free(&game->animations);
+    RPG_Batch_Free(&game->windows);
+    RPG_FREE(game->tweens.items);
+    RPG_FREE(game->worlds.items);
+    RPG_Batch_Free(&game->particles.emitters);
+    RPG_FREE(game->pick.entries);
+    RPG_FREE(game->pick.cells);
+    RPG_FREE(game->pick.items);
     RPG_FREE(game);
     return RPG_NO_ERROR;
 }  // TODO:
@@ -253,6 +282,10 @@ RPG_RESULT RPG_Game_Create(const char *title, RPGint width, RPGint height, RPG_I
         return RPG_Game_GetError();
     }
     RPG_Batch_Init(&g->batch);
+    RPG_Batch_Init(&g->nodes);
+    RPG_Batch_Init(&g->animations);
+    RPG_Batch_Init(&g->windows);
+    RPG_Batch_Init(&g->particles.emitters);
     RPG_CHECK_DIMENSIONS(width, height);
 
     g->resolution.width  = width;
@@ -260,6 +293,7 @@ RPG_RESULT RPG_Game_Create(const char *title, RPGint width, RPGint height, RPG_I
     g->flags             = flags;
     g->font.defaultColor = RPG_FONT_DEFAULT_COLOR;
     g->font.defaultSize  = RPG_FONT_DEFAULT_SIZE;
+    g->screen.brightness = 1.0f;
     if (title)
     {
         g->title = RPG_MALLOC(strlen(title) + 1);
@@ -298,6 +332,34 @@ RPG_RESULT RPG_Game_Create(const char *title, RPGint width, RPGint height, RPG_I
     RPG_GAME = g;
     gladLoadGLLoader((GLADloadproc) glfwGetProcAddress);
     glfwSetWindowUserPointer(g->window, g);
+    RPG_Drawing_Initialize(g);
+    RPG_Tilemap_SetupLoader();
+
+    // Create a quad that covers the render target in clip-space, shared by all full-screen passes
+    float vertices[VERTICES_COUNT] = {-1.0f, 1.0f, 0.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f, 0.0f,
+                                      -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f,  1.0f, 1.0f, 1.0f,  -1.0f, 1.0f, 0.0f};
+    g->quad.vbo = RPG_Drawing_CreateBuffer(VERTICES_SIZE, vertices, RPG_FALSE);
+    g->quad.vao = RPG_Drawing_CreateVertexArray(g->quad.vbo);
+
+    // Create a unit quad for sprites, which are scaled by their model matrix and select their source rectangle in the shader
+    float unit[VERTICES_COUNT] = {0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+                                  0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+    g->unit.vbo = RPG_Drawing_CreateBuffer(VERTICES_SIZE, unit, RPG_FALSE);
+    g->unit.vao = RPG_Drawing_CreateVertexArray(g->unit.vbo);
+
+    // Subdivide the unit quad into horizontal rows, giving the vertex shader enough vertices to bend for distortion effects
+    float *strip = RPG_ALLOC_N(float, VERTICES_COUNT * RPG_STRIP_ROWS);
+    for (int i = 0; i < RPG_STRIP_ROWS; i++)
+    {
+        float t                   = (float) i / RPG_STRIP_ROWS;
+        float b                   = (float) (i + 1) / RPG_STRIP_ROWS;
+        float row[VERTICES_COUNT] = {0.0f, b, 0.0f, b, 1.0f, t, 1.0f, t, 0.0f, t, 0.0f, t,
+                                     0.0f, b, 0.0f, b, 1.0f, b, 1.0f, b, 1.0f, t, 1.0f, t};
+        memcpy(&strip[i * VERTICES_COUNT], row, VERTICES_SIZE);
+    }
+    g->strip.vbo = RPG_Drawing_CreateBuffer(VERTICES_SIZE * RPG_STRIP_ROWS, strip, RPG_FALSE);
+    g->strip.vao = RPG_Drawing_CreateVertexArray(g->strip.vbo);
+    RPG_FREE(strip);
 
     // Enable required OpenGL capabilities
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
@@ -337,6 +399,12 @@ RPG_RESULT RPG_Game_Main(RPGgame *game, RPGdouble tps, RPGupdatefunc updateCallb
             game->update.count++;
             updateCallback(game->update.count);
             RPG_Input_Update();
+            RPG_Screen_Update(game);
+            RPG_Emitter_UpdateAll(game);
+            RPG_Animation_UpdateAll(game);
+            RPG_Tween_UpdateAll(game);
+            RPG_Window_UpdateAll(game);
+            RPG_World_UpdateAll(game);
             delta += game->update.tick;
         }
         RPG_Game_Render(game);
@@ -393,12 +461,19 @@ RPG_RESULT RPG_Game_SetBackColor(RPGgame *game, RPGcolor *color)
 
 RPG_RESULT RPG_Game_Render(RPGgame *game)
 {
-
+    // Render offscreen when any screen effect is applied, which is then composited to the window in a single pass
+    RPGbool effects = RPG_Screen_Begin(game);
     glClear(GL_COLOR_BUFFER_BIT);
+
+    // Distortion effects are animated entirely by the shader, this is the only value that changes each frame
+    RPG_Drawing_UseProgram(game->shader.program);
+    glUniform1f(game->shader.time, (GLfloat) game->update.count);
     if (game->batch.updated)
     {
         RPG_Batch_Sort(&game->batch, 0, game->batch.total - 1);
     }
+    // Resolve the world transform of every node hierarchy before any model matrices are built
+    RPG_BasicSprite_ResolveNodes(&game->nodes);
     RPGrenderable *r;
     int count = game->batch.total;
     for (int i = 0; i < count; i++)
@@ -406,6 +481,14 @@ RPG_RESULT RPG_Game_Render(RPGgame *game)
         r = game->batch.items[i];
         r->render(r);
     }
+    if (effects)
+    {
+        RPG_Screen_Finish(game);
+    }
+    RPG_PostFX_Collect(game);
+    game->pick.dirty = RPG_TRUE;
+    // Leave the default program active for any drawing performed outside of the render pass
+    RPG_Drawing_UseProgram(game->shader.program);
     return RPG_NO_ERROR;
 }
 
@@ -680,18 +763,12 @@ RPG_RESULT RPG_Game_Snapshot(RPGgame *game, RPGimage **image)
     glDisable(GL_SCISSOR_TEST);
 
     // Create texture the same size as the internal resolution
-    glGenTextures(1, &img->texture);
-    RPG_Drawing_BindTexture(img->texture, GL_TEXTURE0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, game->resolution.width, game->resolution.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    img->texture = RPG_Drawing_CreateTexture(game->resolution.width, game->resolution.height, GL_RGBA8, GL_RGBA, NULL, GL_CLAMP_TO_EDGE,
+                                             GL_LINEAR);
 
     // Create FBO and bind as the draw buffer
-    glGenFramebuffers(1, &img->fbo);
+    img->fbo = RPG_Drawing_CreateFramebuffer(img->texture);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, img->fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, img->texture, 0);
     glClear(GL_COLOR_BUFFER_BIT);
 
     RPGint l, r, t, b;
@@ -794,7 +871,7 @@ RPG_RESULT RPG_Game_Transition(RPGgame *game, RPGshader *shader, RPGint duration
     RPG_Game_Snapshot(game, &from);
 
     // Enable transition shader and yield control back to change scene, set uniforms, etc,
-    glUseProgram(shader->program);
+    RPG_Drawing_UseProgram(shader->program);
     func(game, shader);
 
     // Take copy of the target screen to transition to
@@ -812,7 +889,7 @@ RPG_RESULT RPG_Game_Transition(RPGgame *game, RPGshader *shader, RPGint duration
     glReadBuffer(GL_BACK);
 
     // Bind the shader and set the locations to recieve the from/to textures
-    glUseProgram(shader->program);
+    RPG_Drawing_UseProgram(shader->program);
     GLint progress = glGetUniformLocation(shader->program, "progress");
     glUniform1i(glGetUniformLocation(shader->program, "from"), 0);  // TODO:
     glUniform1i(glGetUniformLocation(shader->program, "to"), 1);
@@ -826,21 +903,8 @@ RPG_RESULT RPG_Game_Transition(RPGgame *game, RPGshader *shader, RPGint duration
     RPG_Drawing_BindTexture(from->texture, GL_TEXTURE0);
     RPG_Drawing_BindTexture(to->texture, GL_TEXTURE1);
 
-    // Create a VAO and VBO to use for the transition
-    GLuint vao, vbo;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    float vertices[VERTICES_COUNT] = {-1.0f, 1.0f, 0.0f, 1.0f, 1.0f, -1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f, 0.0f,
-                                      -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f,  1.0f, 1.0f, 1.0f,  -1.0f, 1.0f, 0.0f};
-    glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, vertices, GL_STATIC_DRAW);
-    glBindVertexArray(vao);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, VERTICES_STRIDE, NULL);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
     // Get time, and calculate length of transition
-    glBindVertexArray(vao);
+    glBindVertexArray(game->quad.vao);
     double done   = duration * game->update.tick;
     GLdouble time = glfwGetTime();
     GLdouble max  = time + (duration * game->update.tick);
@@ -872,8 +936,6 @@ RPG_RESULT RPG_Game_Transition(RPGgame *game, RPGshader *shader, RPGint duration
     // Cleanup
     RPG_Image_Free(from);
     RPG_Image_Free(to);
-    glDeleteVertexArrays(1, &vao);
-    glDeleteBuffers(1, &vbo);
 
     return RPG_NO_ERROR;
 }
\ No newline at end of file
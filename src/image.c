@@ -85,6 +85,49 @@ RPG_RESULT RPG_Bitmap_Free(RPGbitmap *bitmap)
  * Image (OpenGL texture)
  ****************************************************************************************/
 
+/**
+ * @brief Packs the alpha channel of an image into one bit per pixel, used to hit-test without reading back from the GPU.
+ *
+ * @param image The image to generate the mask of.
+ * @param pixels The pixel data of the image, in RGBA format.
+ */
+static void RPG_Image_BuildMask(RPGimage *image, const RPGubyte *pixels)
+{
+    RPGint words = (image->width + 31) / 32;
+    if (image->mask == NULL)
+    {
+        image->mask = RPG_ALLOC_N(RPGuint, words * image->height);
+    }
+    memset(image->mask, 0, sizeof(RPGuint) * words * image->height);
+    for (RPGint y = 0; y < image->height; y++)
+    {
+        const RPGubyte *alpha = pixels + (RPGsize) y * image->width * BYTES_PER_PIXEL + 3;
+        RPGuint *row          = image->mask + y * words;
+        for (RPGint x = 0; x < image->width; x++, alpha += BYTES_PER_PIXEL)
+        {
+            if (*alpha > RPG_MASK_ALPHA_THRESHOLD)
+            {
+                row[x >> 5] |= 1u << (x & 31);
+            }
+        }
+    }
+}
+
+RPGbool RPG_Image_HitTest(RPGimage *image, RPGint x, RPGint y)
+{
+    if (x < 0 || y < 0 || x >= image->width || y >= image->height)
+    {
+        return RPG_FALSE;
+    }
+    // Images without a mask, such as those only ever drawn to, are treated as solid
+    if (image->mask == NULL)
+    {
+        return RPG_TRUE;
+    }
+    RPGint words = (image->width + 31) / 32;
+    return (image->mask[y * words + (x >> 5)] >> (x & 31)) & 1u;
+}
+
 RPG_RESULT RPG_Image_Create(RPGint width, RPGint height, const void *pixels, RPG_PIXEL_FORMAT format, RPGimage **image)
 {
     RPG_CHECK_DIMENSIONS(width, height);
@@ -92,13 +135,11 @@ RPG_RESULT RPG_Image_Create(RPGint width, RPGint height, const void *pixels, RPG
     img->width  = width;
     img->height = height;
 
-    glGenTextures(1, &img->texture);
-    RPG_Drawing_BindTexture(img->texture, GL_TEXTURE0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    img->texture = RPG_Drawing_CreateTexture(width, height, GL_RGBA8, format, pixels, GL_CLAMP_TO_EDGE, GL_NEAREST);
+    if (pixels != NULL && format == RPG_PIXEL_FORMAT_RGBA)
+    {
+        RPG_Image_BuildMask(img, pixels);
+    }
 
     *image = img;
     return RPG_NO_ERROR;
@@ -151,12 +192,25 @@ RPG_RESULT RPG_Image_CreateFromFile(const char *filename, RPGimage **image)
 RPG_RESULT RPG_Image_Free(RPGimage *image)
 {
     RPG_RETURN_IF_NULL(image);
+    RPG_Pick_Invalidate();
     glDeleteFramebuffers(1, &image->fbo);
-    glDeleteTextures(1, &image->texture);
+    RPG_Drawing_DeleteTexture(image->texture);
+    RPG_FREE(image->mask);
     RPG_FREE(image);
     return RPG_NO_ERROR;
 }
 
+RPG_RESULT RPG_Image_UpdateMask(RPGimage *image)
+{
+    RPG_RETURN_IF_NULL(image);
+    RPGubyte *pixels = RPG_MALLOC((RPGsize) image->width * image->height * BYTES_PER_PIXEL);
+    RPG_Drawing_BindTexture(image->texture, GL_TEXTURE0);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    RPG_Image_BuildMask(image, pixels);
+    RPG_FREE(pixels);
+    return RPG_NO_ERROR;
+}
+
 DEF_GETTER(Image, Texture, RPGimage, RPGuint, texture)
 DEF_GETTER(Image, Framebuffer, RPGimage, RPGuint, fbo)
 
@@ -265,15 +319,8 @@ RPG_RESULT RPG_Image_Blit(RPGimage *dst, RPGrect *dstRect, RPGimage *src, RPGrec
     // Generate VBO/VAO if not defined yet
     if (blitVAO == 0)
     {
-        glGenVertexArrays(1, &blitVAO);
-        glGenBuffers(1, &blitVBO);
-        glBindVertexArray(blitVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, blitVBO);
-        glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, NULL, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, VERTICES_STRIDE, NULL);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        blitVBO = RPG_Drawing_CreateBuffer(VERTICES_SIZE, NULL, RPG_TRUE);
+        blitVAO = RPG_Drawing_CreateVertexArray(blitVBO);
         mtx_init(&vaoMutex, mtx_plain);
     }
 
@@ -285,12 +332,15 @@ RPG_RESULT RPG_Image_Blit(RPGimage *dst, RPGrect *dstRect, RPGimage *src, RPGrec
     mtx_lock(&vaoMutex);
 
     // Set shader uniforms for opacity and ortho, default for all others
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
     RPG_Drawing_SetBlending(GL_FUNC_ADD, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glUniformMatrix4fv(RPG_GAME->shader.model, 1, GL_FALSE, (GLfloat *) &model);
     glUniform1f(RPG_GAME->shader.alpha, alpha);
     glUniform4f(RPG_GAME->shader.color, 0.0f, 0.0f, 0.0f, 0.0f);
     glUniform4f(RPG_GAME->shader.tone, 0.0f, 0.0f, 0.0f, 0.0f);
     glUniform4f(RPG_GAME->shader.flash, 0.0f, 0.0f, 0.0f, 0.0f);
+    glUniform4f(RPG_GAME->shader.source, 0.0f, 0.0f, 1.0f, 1.0f);
+    glUniform4fv(RPG_GAME->shader.distortion, 3, (GLfloat[12]){0.0f});
     glActiveTexture(GL_TEXTURE0);
     glBindVertexArray(blitVAO);
 
@@ -299,17 +349,15 @@ RPG_RESULT RPG_Image_Blit(RPGimage *dst, RPGrect *dstRect, RPGimage *src, RPGrec
     GLfloat t = (GLfloat) s.y / src->height;
     GLfloat r = l + ((GLfloat) s.w / src->width);
     GLfloat b = t + ((GLfloat) s.h / src->height);
-    glBindBuffer(GL_ARRAY_BUFFER, blitVBO);
     GLfloat vertices[VERTICES_COUNT] = {0.0f, 1.0f, l, b, 1.0f, 0.0f, r, t, 0.0f, 0.0f, l, t,
                                         0.0f, 1.0f, l, b, 1.0f, 1.0f, r, b, 1.0f, 0.0f, r, t};
-    glBufferSubData(GL_ARRAY_BUFFER, 0, VERTICES_SIZE, vertices);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    RPG_Drawing_BufferSubData(blitVBO, 0, VERTICES_SIZE, vertices);
 
     // Create projection matrix and viewport to reflect the destination image
     RPG_ENSURE_FBO(dst);
     RPGmat4 m;
     RPG_MAT4_ORTHO(m, 0.0f, dst->width, dst->height, 0.0f, -1.0f, 1.0f);
-    glUniformMatrix4fv(RPG_GAME->shader.projection, 1, GL_FALSE, (RPGfloat *) &m);
+    RPG_Drawing_SetProjection(&m);
     RPG_VIEWPORT(0, 0, dst->width, dst->height);
 
     // Render the source image to the destination's framebuffer
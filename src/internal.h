@@ -3,6 +3,7 @@
 
 #include <math.h>
 #include <string.h>
+#include <stddef.h>
 
 #ifdef __linux__
 #define RPG_LINUX
@@ -48,10 +49,14 @@ typedef struct RPGchannel RPGchannel;
 #define UNIFORM_ALPHA "alpha"
 #define UNIFORM_HUE "hue"
 #define UNIFORM_FLASH "flash"
+#define UNIFORM_SOURCE "source"
+#define UNIFORM_DISTORTION "distortion"
+#define UNIFORM_TIME "time"
 
 #define VERTICES_COUNT 24
 #define VERTICES_SIZE (sizeof(RPGfloat) * VERTICES_COUNT)
 #define VERTICES_STRIDE (sizeof(RPGfloat) * 4)
+#define RPG_STRIP_ROWS 128
 #define RPG_PI 3.14159274f
 
 #define RPG_ENSURE_FILE(filename)                                                                                                          \
@@ -62,15 +67,19 @@ typedef struct RPGchannel RPGchannel;
     if (ptr == NULL)                                                                                                                       \
     return RPG_ERR_INVALID_POINTER
 
-#define RPG_BASE_UNIFORMS(r)                                                                                                               \
-    glUniform4f(RPG_GAME->shader.color, r.color.x, r.color.y, r.color.z, r.color.w);                                                       \
-    glUniform4f(RPG_GAME->shader.tone, r.tone.x, r.tone.y, r.tone.z, r.tone.w);                                                            \
-    glUniform1f(RPG_GAME->shader.alpha, r.alpha);                                                                                          \
-    glUniform1f(RPG_GAME->shader.hue, r.hue);                                                                                              \
-    glUniform4f(RPG_GAME->shader.flash, r.flash.color.x, r.flash.color.y, r.flash.color.z, r.flash.color.w);                               \
-    glUniformMatrix4fv(RPG_GAME->shader.model, 1, GL_FALSE, (GLfloat *) &r.model);                                                         \
+// Sets the uniforms of a basic sprite, using a structure containing the uniform locations of the active program
+#define RPG_BASE_UNIFORMS_EX(loc, r)                                                                                                       \
+    glUniform4f(loc.color, r.color.x, r.color.y, r.color.z, r.color.w);                                                                    \
+    glUniform4f(loc.tone, r.tone.x, r.tone.y, r.tone.z, r.tone.w);                                                                         \
+    glUniform1f(loc.alpha, r.alpha);                                                                                                       \
+    glUniform1f(loc.hue, r.hue);                                                                                                           \
+    glUniform4f(loc.flash, r.flash.color.x, r.flash.color.y, r.flash.color.z, r.flash.color.w);                                            \
+    glUniform4f(loc.source, r.source.x, r.source.y, r.source.z, r.source.w);                                                               \
+    glUniformMatrix4fv(loc.model, 1, GL_FALSE, (GLfloat *) &r.model);                                                                      \
     RPG_Drawing_SetBlending(r.blend.op, r.blend.src, r.blend.dst)
 
+#define RPG_BASE_UNIFORMS(r) RPG_BASE_UNIFORMS_EX(RPG_GAME->shader, r)
+
 #define RPG_CLAMPF(v, min, max) (fmaxf(min, fminf(max, v)))
 
 #define RPG_CLAMPI(v, min, max) (imax(min, imin(v, max)))
@@ -235,11 +244,14 @@ typedef struct RPGchannel RPGchannel;
 // Resets the clear color back to the user-defined value.
 #define RPG_RESET_BACK_COLOR() glClearColor(RPG_GAME->color.x, RPG_GAME->color.y, RPG_GAME->color.z, RPG_GAME->color.w)
 
-// Resets the primary viewport to fit the window correctly.
-#define RPG_RESET_VIEWPORT() RPG_VIEWPORT(RPG_GAME->bounds.x, RPG_GAME->bounds.y, RPG_GAME->bounds.w, RPG_GAME->bounds.h)
+// Resets the primary viewport to fit the current render target correctly.
+#define RPG_RESET_VIEWPORT() RPG_VIEWPORT(RPG_GAME->target.x, RPG_GAME->target.y, RPG_GAME->target.w, RPG_GAME->target.h)
+
+// Binds the framebuffer the game is currently rendering to.
+#define RPG_BIND_TARGET() glBindFramebuffer(GL_FRAMEBUFFER, RPG_GAME->target.fbo)
 
 // Resets the primary projection matrix.
-#define RPG_RESET_PROJECTION() glUniformMatrix4fv(RPG_GAME->shader.projection, 1, GL_FALSE, (GLfloat *) &RPG_GAME->projection)
+#define RPG_RESET_PROJECTION() RPG_Drawing_SetProjection(&RPG_GAME->projection)
 
 // Sets the viewport and scissor rectangle of the primary viewport.
 #define RPG_VIEWPORT(x, y, w, h)                                                                                                           \
@@ -250,27 +262,36 @@ typedef struct RPGchannel RPGchannel;
 #define RPG_ENSURE_FBO(img)                                                                                                                \
     if (img->fbo == 0)                                                                                                                     \
     {                                                                                                                                      \
-        glGenFramebuffers(1, &img->fbo);                                                                                                   \
-        glBindFramebuffer(GL_FRAMEBUFFER, img->fbo);                                                                                       \
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, img->texture, 0);                                      \
+        img->fbo = RPG_Drawing_CreateFramebuffer(img->texture);                                                                            \
     }                                                                                                                                      \
-    else                                                                                                                                   \
-        glBindFramebuffer(GL_FRAMEBUFFER, img->fbo)
+    glBindFramebuffer(GL_FRAMEBUFFER, img->fbo)
 
 // Binds an image's framebuffer, using the specified coordinates for its ortho
 #define RPG_BIND_FBO(img, x, y, w, h)                                                                                                      \
     RPG_ENSURE_FBO(img);                                                                                                                   \
     RPGmat4 m;                                                                                                                             \
     RPG_MAT4_ORTHO(m, 0.0f, w, 0.0f, h, -1.0f, 1.0f);                                                                                      \
-    glUniformMatrix4fv(RPG_GAME->shader.projection, 1, GL_FALSE, (RPGfloat *) &m);                                                         \
+    RPG_Drawing_SetProjection(&m);                                                                                                         \
     RPG_VIEWPORT(x, y, w, h)
 
 // Unbinds an image's framebuffer, and resets the projection and viewport
 #define RPG_UNBIND_FBO(img)                                                                                                                \
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);                                                                                                  \
+    RPG_BIND_TARGET();                                                                                                                     \
     RPG_RESET_PROJECTION();                                                                                                                \
     RPG_RESET_VIEWPORT()
 
+// The maximum number of textures that can be bound to a material, unit 0 is reserved for the object's own image.
+#define RPG_MATERIAL_MAX_TEXTURES 8
+
+// Pixels with an alpha greater than this are solid within the alpha mask of an image.
+#define RPG_MASK_ALPHA_THRESHOLD 0
+
+// The width and height, in pixels, of each cell of the picking index.
+#define RPG_PICK_CELL_SIZE 64
+
+// The maximum number of keys in the color and alpha ramps of a particle emitter.
+#define RPG_EMITTER_MAX_KEYS 8
+
 // The initial pixel size used for font unless set by the user.
 #define RPG_FONT_DEFAULT_SIZE 32
 
@@ -296,12 +317,35 @@ static inline int imax(int i1, int i2) { return i1 > i2 ? i1 : i2; }
  */
 static inline int imin(int i1, int i2) { return i1 < i2 ? i1 : i2; }
 
+/**
+ * @brief Multiplies two 4x4 matrices, storing the product in the result.
+ *
+ * @param result The matrix to receive the product, may be the same as either operand.
+ * @param left The left-hand operand.
+ * @param right The right-hand operand.
+ */
+static inline void RPG_Mat4_Multiply(RPGmat4 *result, const RPGmat4 *left, const RPGmat4 *right)
+{
+    const RPGfloat *a = (const RPGfloat *) left;
+    const RPGfloat *b = (const RPGfloat *) right;
+    RPGfloat m[16];
+    for (int col = 0; col < 4; col++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            m[col * 4 + row] = a[row] * b[col * 4] + a[4 + row] * b[col * 4 + 1] + a[8 + row] * b[col * 4 + 2] + a[12 + row] * b[col * 4 + 3];
+        }
+    }
+    memcpy(result, m, sizeof(RPGmat4));
+}
+
 typedef struct RPGimage
 {
     RPGint width;
     RPGint height;
     GLuint texture;
     GLuint fbo;
+    RPGuint *mask; /** Packed 1-bit alpha mask used for picking, rows are padded to 32 bits, or NULL if not generated. */
     void *user;
 } RPGimage;
 
@@ -316,11 +360,132 @@ typedef struct
     RPGbool updated;       /** Flag indicating the items may need reordered due to added entry or change of z-axis. */
 } RPGbatch;
 
+/**
+ * @brief An intermediate render target, owned by the pool and lent to post-processing passes.
+ */
+typedef struct RPGrendertarget
+{
+    GLuint fbo;      /** The framebuffer object with the texture attached. */
+    GLuint texture;  /** The color attachment, with linear filtering for sampling at different resolutions. */
+    RPGint width;    /** The width of the target, in pixels. */
+    RPGint height;   /** The height of the target, in pixels. */
+    RPGbool busy;    /** Flag indicating the target is currently acquired. */
+    RPGint64 frame;  /** The frame number the target was last acquired on. */
+} RPGrendertarget;
+
+/**
+ * @brief Describes the method a post-processing effect is applied with.
+ */
+typedef enum
+{
+    RPG_POSTFX_SHADER, /** A user-defined fragment shader. */
+    RPG_POSTFX_BLUR,   /** Separable gaussian blur. */
+    RPG_POSTFX_BLOOM   /** Bright-pass, blurred and added back over the source. */
+} RPG_POSTFX_TYPE;
+
+typedef struct RPGpostfx
+{
+    RPG_POSTFX_TYPE type;         /** The type of effect. */
+    RPGbool enabled;              /** Flag indicating if the effect is applied. */
+    RPGint downsample;            /** The divisor of the resolution the effect is computed at, either 1, 2, or 4. */
+    RPGfloat radius;              /** The blur radius, in pixels at full resolution. */
+    RPGfloat threshold;           /** The brightness a pixel must exceed to contribute to bloom. */
+    RPGfloat intensity;           /** The strength bloom is added back to the image with. */
+    RPGshader *shader;            /** The shader used by user-defined effects. */
+    GLint resolution;             /** The location of the "resolution" uniform in a user-defined shader. */
+    struct RPGpostchain **chains; /** The chains the effect has been added to. */
+    RPGint chainCount;            /** The number of chains the effect has been added to. */
+    void *user;
+} RPGpostfx;
+
+/**
+ * @brief An ordered list of post-processing effects applied to a rendered image.
+ */
+typedef struct RPGpostchain
+{
+    RPGpostfx **items; /** The effects, in the order they are applied. */
+    RPGint count;      /** The number of effects in the chain. */
+    RPGint capacity;   /** The number of effects that can be held before reallocation. */
+} RPGpostchain;
+
+/**
+ * @brief The geometry of a collision shape.
+ */
+typedef enum
+{
+    RPG_SHAPE_BOX,   /** An axis-aligned rectangle. */
+    RPG_SHAPE_CIRCLE /** A circle, described by its center and radius. */
+} RPG_SHAPE_TYPE;
+
+/**
+ * @brief A shape registered with a collision world, positioned relative to the location of its object.
+ */
+typedef struct RPGshape
+{
+    RPGbasic *object;    /** The object the shape follows, or NULL when the slot is unused. */
+    RPG_SHAPE_TYPE type; /** The geometry of the shape. */
+    RPGint x;            /** The offset of the left edge, or center of a circle, from the object on the x-axis. */
+    RPGint y;            /** The offset of the top edge, or center of a circle, from the object on the y-axis. */
+    RPGint w;            /** The width of a box, or the radius of a circle. */
+    RPGint h;            /** The height of a box, unused by circles. */
+    RPGuint layer;       /** The layers the shape belongs to. */
+    RPGuint mask;        /** The layers the shape collides with. */
+    RPGbool precise;     /** Flag indicating overlaps are confirmed against the alpha mask of a sprite's image. */
+    RPGint next;         /** The next unused slot when the slot is unused, otherwise -1. */
+    RPGrect bounds;      /** The bounding box computed on the last step. */
+    RPGint worldX;       /** The location of the object in world space on the x-axis, computed on the last step. */
+    RPGint worldY;       /** The location of the object in world space on the y-axis, computed on the last step. */
+} RPGshape;
+
+/**
+ * @brief A set of shapes tested for overlaps once per update with sort-and-sweep.
+ */
+typedef struct RPGworld
+{
+    RPGshape *shapes;       /** The shapes, indexed by their identifier. */
+    RPGint count;           /** The number of slots in use, including unused slots below the highest identifier. */
+    RPGint capacity;        /** The number of slots that can be held before reallocation. */
+    RPGint unused;          /** The first unused slot, or -1. */
+    RPGint *order;          /** Identifiers sorted by the left edge of their bounds, kept between steps. */
+    RPGint orderCount;      /** The number of identifiers in the order. */
+    RPGcontact *contacts;   /** The overlapping pairs found on the last step. */
+    RPGint contactCount;    /** The number of overlapping pairs. */
+    RPGint contactCapacity; /** The number of pairs that can be held before reallocation. */
+} RPGworld;
+
+/**
+ * @brief A visible object within the picking index, with its transforms resolved to screen space.
+ */
+typedef struct RPGpickentry
+{
+    RPGrenderable *item;   /** The object that would be returned by a query. */
+    RPGviewport *viewport; /** The viewport the object is clipped to, or NULL. */
+    RPGfloat local[6];     /** Affine transform from screen space to the local space of the object. */
+    RPGfloat clip[6];      /** Affine transform from screen space to the pixels of the viewport. */
+    RPGrect bounds;        /** The screen-space bounding box, clipped to the viewport and the screen. */
+} RPGpickentry;
+
 typedef struct RPGgame
 {
     GLFWwindow *window;
     RPGmat4 projection;
     RPGbatch batch;
+    RPGbatch nodes;      /** The root nodes of each transform hierarchy, resolved before rendering. */
+    RPGbatch animations; /** Sprites playing an animation, advanced once per update. */
+    RPGbatch windows;    /** Windows that are opening or closing, advanced once per update. */
+    struct
+    {
+        RPGtween **items; /** Running tweens that are not part of a group. */
+        RPGint count;
+        RPGint capacity;
+        RPGtween *first; /** The head of the list of every allocated tween, running or not. */
+    } tweens;
+    struct
+    {
+        RPGworld **items; /** Collision worlds, stepped once per update. */
+        RPGint count;
+        RPGint capacity;
+    } worlds;
     struct
     {
         RPGint width;
@@ -350,7 +515,146 @@ typedef struct RPGgame
         GLint flash;
         GLint alpha;
         GLint hue;
+        GLint source;
+        GLint distortion;
+        GLint time;
     } shader;
+    struct
+    {
+        GLint major;  /** The major version of the OpenGL context. */
+        GLint minor;  /** The minor version of the OpenGL context. */
+        RPGbool dsa;  /** Flag indicating direct state access and immutable buffer storage are available. */
+    } gl;
+    struct
+    {
+        GLuint fbo;        /** The framebuffer the game is currently being rendered to, 0 for the window. */
+        RPGint x, y, w, h; /** The viewport that maps the resolution onto the current render target. */
+    } target;
+    struct
+    {
+        GLuint vbo;
+        GLuint vao;
+    } quad; /** A quad covering the entire render target in clip-space, used for full-screen passes. */
+    struct
+    {
+        GLuint vbo;
+        GLuint vao;
+    } unit; /** A unit quad shared by all sprites, the source rectangle is applied by the shader. */
+    struct
+    {
+        GLuint vbo;
+        GLuint vao;
+    } strip; /** The unit quad subdivided into RPG_STRIP_ROWS rows, used in place of the unit quad by distorted objects. */
+    struct
+    {
+        RPGtone tone;          /** The current tone applied to the entire screen. */
+        RPGtone toneTarget;    /** The tone the screen is changing to. */
+        RPGint toneDuration;   /** The remaining number of updates until the tone target is reached. */
+        RPGcolor flash;        /** The current flash color, the alpha component diminishes over the duration. */
+        RPGint flashDuration;  /** The remaining number of updates until the flash completes. */
+        RPGfloat brightness;   /** Scalar applied to the final color, where 1.0 is normal. */
+        struct
+        {
+            RPGfloat power;
+            RPGfloat speed;
+            RPGfloat offset;   /** The current horizontal displacement, in pixels. */
+            RPGint duration;
+            RPGint direction;
+        } shake;
+        struct
+        {
+            GLuint texture;    /** A 3D texture containing the color lookup table, or 0 when not used. */
+            RPGint size;       /** The number of entries on each axis of the lookup table. */
+            RPGfloat amount;   /** The strength of the color grading, from 0.0 to 1.0. */
+        } lut;
+        struct
+        {
+            GLuint program;
+            GLint offset;
+            GLint tone;
+            GLint flash;
+            GLint brightness;
+            GLint grading;
+        } shader;
+        GLuint fbo;            /** Offscreen target the game is rendered to when any effect is applied. */
+        GLuint texture;        /** The color attachment of the offscreen target. */
+        RPGint width, height;  /** The size of the offscreen target. */
+    } screen;
+    struct
+    {
+        RPGpostchain chain;      /** Effects applied to the entire screen before the final composite. */
+        RPGrendertarget **pool;  /** Intermediate targets, bucketed by size and reused across passes and frames. */
+        RPGint poolCount;
+        RPGint poolCapacity;
+        RPGint64 frame;          /** The number of frames rendered, used to expire unused targets. */
+        struct
+        {
+            GLuint program;
+        } copy;
+        struct
+        {
+            GLuint program;
+            GLint direction;
+        } blur;
+        struct
+        {
+            GLuint program;
+            GLint threshold;
+        } threshold;
+        struct
+        {
+            GLuint program;
+            GLint intensity;
+        } combine;
+    } postfx;
+    struct
+    {
+        GLuint program;
+        GLint projection;
+        GLint origin;
+        GLint occluder;
+        GLint ambient;
+    } light;
+    struct
+    {
+        RPGbatch emitters; /** Every particle emitter, simulated once per update. */
+        GLuint program;
+        GLint projection;
+        GLint model;
+        GLint color;
+        GLint tone;
+        GLint flash;
+        GLint alpha;
+        GLint hue;
+        GLint source;
+        GLint frames;
+        RPGuint projectionVersion; /** The projection version last uploaded to the particle program. */
+    } particles;
+    struct
+    {
+        GLuint program;
+        GLint projection;
+        GLint model;
+        GLint color;
+        GLint tone;
+        GLint flash;
+        GLint alpha;
+        GLint hue;
+        GLint source;
+        RPGuint projectionVersion; /** The projection version last uploaded to the primitive program. */
+    } primitives;
+    struct
+    {
+        RPGpickentry *entries; /** Every visible object that can be picked, in the order they are drawn. */
+        RPGint count;          /** The number of entries. */
+        RPGint capacity;       /** The number of entries that can be stored before reallocation. */
+        RPGint *cells;         /** The offset of each cell's list within items, followed by the total. */
+        RPGint *items;         /** Entry indices of every cell, concatenated in the order they are drawn. */
+        RPGint itemCapacity;   /** The number of indices that can be stored before reallocation. */
+        RPGint columns;        /** The number of cells on the x-axis. */
+        RPGint rows;           /** The number of cells on the y-axis. */
+        RPGbool dirty;         /** Flag indicating the index must be rebuilt, set each time the game is rendered or an object is freed. */
+    } pick;
 #ifndef RPG_WITHOUT_OPENAL
     struct
     {
@@ -408,14 +712,76 @@ typedef struct RPGshader
 {
     GLuint program;
     void *user;
+    RPGmaterial *material; /** The material whose uniform values were last uploaded to the program, or NULL. */
 } RPGshader;
 
+/**
+ * @brief A uniform value stored on the CPU-side by a material, uploaded to the program only when changed.
+ */
+typedef struct RPGuniform
+{
+    GLint location; /** The location of the uniform within the program. */
+    GLenum type;    /** The base type of the value, either GL_FLOAT, GL_INT, or GL_FLOAT_MAT4. */
+    GLint count;    /** The number of components in the value. */
+    union {
+        GLfloat f[16];
+        GLint i[4];
+    } value;       /** The stored value of the uniform. */
+    RPGbool dirty; /** Flag indicating the value has changed since it was last uploaded. */
+} RPGuniform;
+
+/**
+ * @brief A shader program with its own uniform values and textures that can be assigned to any renderable.
+ */
+typedef struct RPGmaterial
+{
+    RPGshader *shader; /** The shader program used to render objects with this material. */
+    struct
+    {
+        GLint projection;
+        GLint model;
+        GLint color;
+        GLint tone;
+        GLint flash;
+        GLint alpha;
+        GLint hue;
+        GLint source;
+        GLint distortion;
+        GLint time;
+    } builtin;            /** Locations of the standard sprite uniforms within the program, -1 when not used. */
+    RPGuniform *uniforms; /** Array of stored uniform values. */
+    RPGint uniformCount;  /** The number of stored uniform values. */
+    RPGint capacity;      /** The number of uniform values that can be stored before reallocation. */
+    struct
+    {
+        GLint location;  /** The location of the sampler uniform. */
+        RPGimage *image; /** The image bound to the unit, or NULL. */
+    } textures[RPG_MATERIAL_MAX_TEXTURES];
+    RPGuint projection; /** The version of the projection matrix last uploaded to the program. */
+    RPGint64 time;      /** The update count last uploaded to the time uniform of the program. */
+    RPGbatch users;     /** Every renderable the material is assigned to. */
+    void *user;         /** Arbitrary user-defined pointer to store with this instance */
+} RPGmaterial;
+
+/**
+ * @brief Describes how an object is hit-tested when picking.
+ */
+typedef enum
+{
+    RPG_PICK_NONE,     /** The object can not be picked. */
+    RPG_PICK_SPRITE,   /** Tested against the alpha mask of the sprite's source rectangle. */
+    RPG_PICK_WINDOW,   /** Tested against the bounds of the window. */
+    RPG_PICK_VIEWPORT  /** Clips and transforms the objects rendered within the viewport. */
+} RPG_PICK_TYPE;
+
 typedef struct RPGrenderable
 {
-    RPGint z;             /** The position of the sprite on the z-axis. */
-    RPGbatch *parent;     /** Pointer to the rendering batch the object is contained within */
-    RPGrenderfunc render; /** The function to call when the object needs rendered. */
-    RPGbool visible;      /** Flag indicating if object should be rendered. */
+    RPGint z;              /** The position of the sprite on the z-axis. */
+    RPGbatch *parent;      /** Pointer to the rendering batch the object is contained within */
+    RPGrenderfunc render;  /** The function to call when the object needs rendered. */
+    RPGbool visible;       /** Flag indicating if object should be rendered. */
+    RPGmaterial *material; /** The material to render the object with, or NULL to use the default shader. */
+    RPG_PICK_TYPE pick;    /** How the object is hit-tested when picking. */
 } RPGrenderable;
 
 /**
@@ -450,9 +816,19 @@ typedef struct RPGbasic
         RPG_BLEND_OP op; /** The equation used for combining the source and destination factors. */
         RPG_BLEND src;   /** The factor to be used for the source pixel color. */
         RPG_BLEND dst;   /** The factor ot used for the destination pixel color. */
-    } blend;             /** The blending factors to apply during rendering. */
-    RPGmat4 model;       /** The model matrix for the object. */
-    void *user;          /** Arbitrary user-defined pointer to store with this instance */
+    } blend;               /** The blending factors to apply during rendering. */
+    RPGvec4 source;        /** The region of the texture to sample, as a normalized offset (xy) and scale (zw). */
+    RPGvec4 distortion[3]; /** The amplitude, length, speed, and phase of each effect, indexed by RPG_DISTORTION. */
+    RPGbool distorted;     /** Flag indicating any distortion effect has a non-zero amplitude. */
+    RPGmat4 model;         /** The model matrix for the object. */
+    struct
+    {
+        struct RPGbasic *parent; /** The node whose transform this object is relative to, or NULL. */
+        struct RPGbasic *child;  /** The first child node of this object, or NULL. */
+        struct RPGbasic *next;   /** The next sibling node that shares the same parent, or NULL. */
+        RPGmat4 world;           /** Cached world transform of the node, excluding the object's dimensions. */
+    } node;                      /** Optional transform hierarchy this object is a member of. */
+    void *user;                  /** Arbitrary user-defined pointer to store with this instance */
 } RPGbasic;
 
 /**
@@ -464,26 +840,231 @@ typedef struct RPGsprite
     RPGimage *image;       /** A pointer ot the sprite's image, or NULL. */
     RPGviewport *viewport; /** A pointer to the sprite's viewport, or NULL. */
     RPGrect rect;          /** The source rectangle of the sprite's image. */
-    GLuint vbo;            /** The Vertex Buffer Object bound to this sprite. */
-    GLuint vao;            /** The Vertex Array Object bound to this sprite. */
+    struct
+    {
+        RPGanimation *clip; /** The animation being played, or NULL. */
+        RPGint frame;       /** The index of the current frame. */
+        RPGint timer;       /** The number of updates remaining until the next frame. */
+        RPGint step;        /** The direction frames are advanced in, either 1 or -1. */
+        RPGbool playing;    /** Flag indicating the sprite is in the list of animations being advanced. */
+    } animation;
 } RPGsprite;
 
+/**
+ * @brief Describes how a tween is advanced.
+ */
+typedef enum
+{
+    RPG_TWEEN_TYPE_PROPERTY, /** Interpolates a property of an object. */
+    RPG_TWEEN_TYPE_DELAY,    /** Waits for a number of updates. */
+    RPG_TWEEN_TYPE_SEQUENCE, /** Runs each child after the previous has completed. */
+    RPG_TWEEN_TYPE_PARALLEL  /** Runs all children at once, completing with the last. */
+} RPG_TWEEN_TYPE;
+
+/**
+ * @brief Interpolates properties of an object over a number of updates, or a group of other tweens.
+ */
+typedef struct RPGtween
+{
+    RPG_TWEEN_TYPE type;         /** Determines how the tween is advanced. */
+    RPGbasic *target;            /** The object being modified, or NULL if it has been freed. */
+    RPG_TWEEN_PROPERTY property; /** The property being interpolated. */
+    RPG_EASING easing;           /** The easing curve applied to the progress. */
+    RPGfloat from[4];            /** The starting value of each component. */
+    RPGfloat to[4];              /** The ending value of each component. */
+    RPGbool explicitFrom;        /** Flag indicating the starting value was specified, rather than read when started. */
+    RPGbool started;             /** Flag indicating the starting value has been captured. */
+    RPGbool finished;            /** Flag indicating the tween has completed within its parent group. */
+    RPGbool running;             /** Flag indicating the tween is being advanced by the game. */
+    RPGbool yoyo;                /** Flag indicating repeats of a property tween alternate direction. */
+    RPGbool reverse;             /** Flag indicating the current repetition is played backwards. */
+    RPGint duration;             /** The number of updates the tween lasts. */
+    RPGint elapsed;              /** The number of updates that have elapsed. */
+    RPGint repeat;               /** The number of times to repeat, or -1 to repeat indefinitely. */
+    RPGint iteration;            /** The number of times the tween has repeated since started. */
+    struct RPGtween *parent;     /** The group containing this tween, or NULL. */
+    struct RPGtween **children;  /** The tweens within a group. */
+    RPGint count;                /** The number of tweens within a group. */
+    RPGint capacity;             /** The number of tweens a group can contain before reallocation. */
+    RPGint current;              /** The index of the active child of a sequence. */
+    RPGtweenfunc callback;       /** Function called when the tween completes, or NULL. */
+    void *user;                  /** Arbitrary user pointer, passed to the callback. */
+    struct RPGtween *prev;       /** The previous tween in the list of allocated tweens. */
+    struct RPGtween *next;       /** The next tween in the list of allocated tweens. */
+} RPGtween;
+
+/**
+ * @brief A single frame of an animation clip.
+ */
+typedef struct RPGanimframe
+{
+    RPGrect rect;    /** The source rectangle of the frame, in pixels. */
+    RPGint duration; /** The number of updates the frame is displayed for. */
+} RPGanimframe;
+
+/**
+ * @brief A sequence of frames within an image, shared by any number of sprites.
+ */
+typedef struct RPGanimation
+{
+    RPGimage *image;         /** The image the frames are taken from. */
+    RPGanimframe *frames;    /** The frames of the animation. */
+    RPGint count;            /** The number of frames. */
+    RPGint capacity;         /** The number of frames that can be added before reallocation. */
+    RPG_ANIMATION_MODE mode; /** Determines what happens when the last frame is reached. */
+    RPGbatch sprites;        /** Every sprite referencing the animation, whether playing, stopped, or paused. */
+    void *user;              /** Arbitrary user pointer. */
+} RPGanimation;
+
 /**
  * @brief A container for sprites that is drawn in its own independent batch with its own projection.
  */
 typedef struct RPGviewport
 {
-    RPGbasic base;      /** The base sprite object, MUST BE FIRST FIELD IN THE STRUCTURE! */
-    RPGint width;       /** The dimension of the viewport, in pixels, on the x-axis. */
-    RPGint height;      /** The dimension of the viewport, in pixels, on the y-axis. */
-    RPGbatch batch;     /** A collection containing pointers to the sprites within this viewport. */
-    GLuint fbo;         /** The Framebuffer Object for rendering to the viewport. */
-    GLuint texture;     /** Texture with the viewport batch rendered onto it. */
-    RPGmat4 projection; /** The projection matrix for the viewport. */
-    GLuint vbo;         /** The Vertex Buffer Object bound to this viewport. */
-    GLuint vao;         /** The Vertex Array Object bound to this viewport. */
+    RPGbasic base;       /** The base sprite object, MUST BE FIRST FIELD IN THE STRUCTURE! */
+    RPGint width;        /** The dimension of the viewport, in pixels, on the x-axis. */
+    RPGint height;       /** The dimension of the viewport, in pixels, on the y-axis. */
+    RPGbatch batch;      /** A collection containing pointers to the sprites within this viewport. */
+    GLuint fbo;          /** The Framebuffer Object for rendering to the viewport. */
+    GLuint texture;      /** Texture with the viewport batch rendered onto it. */
+    RPGmat4 projection;  /** The projection matrix for the viewport. */
+    GLuint vbo;          /** The Vertex Buffer Object bound to this viewport. */
+    GLuint vao;          /** The Vertex Array Object bound to this viewport. */
+    RPGpostchain postfx; /** Effects applied to the rendered contents of the viewport. */
 } RPGviewport;
 
+/**
+ * @brief Instance data for a single light, matching the attribute layout of the light shader.
+ */
+typedef struct RPGlightdata
+{
+    RPGvec4 shape;  /** The location on the x and y axis, the radius, and a flag indicating the slot is in use. */
+    RPGcolor color; /** The color of the light, with the alpha component used as the intensity. */
+    RPGvec4 cone;   /** The direction, half-angle, and edge softness of a cone light. The half-angle is >= PI for point lights. */
+} RPGlightdata;
+
+/**
+ * @brief Reduced-resolution viewport that accumulates lights, and is multiplied over everything beneath it.
+ */
+typedef struct RPGlightmap
+{
+    RPGviewport viewport;  /** The base viewport object, MUST BE FIRST FIELD IN THE STRUCTURE! */
+    RPGint scale;          /** The divisor of the game resolution the light map is rendered at. */
+    RPGcolor ambient;      /** The light level of areas not reached by any light. */
+    struct
+    {
+        RPGlightdata *items; /** The instance data for each light slot. */
+        RPGint count;        /** The number of slots, including any removed lights not at the end. */
+        RPGint capacity;     /** The number of slots the instance buffer can hold. */
+        RPGbool dirty;       /** Flag indicating the instance data needs uploaded. */
+        GLuint vbo;
+        GLuint vao;
+    } lights;
+    struct
+    {
+        RPGint count; /** The number of occluder rectangles. */
+        GLuint vbo;
+        GLuint vao;
+    } occluders;
+} RPGlightmap;
+
+/**
+ * @brief Instance data for a single particle, matching the attribute layout of the particle shader.
+ */
+typedef struct RPGparticlevertex
+{
+    RPGfloat x, y;     /** The location of the particle, relative to the emitter. */
+    RPGfloat size;     /** The width and height of the particle, in pixels. */
+    RPGfloat rotation; /** The rotation of the particle, in radians. */
+    RPGubyte color[4]; /** The color of the particle, sampled from the color and alpha ramps. */
+    RPGfloat frame;    /** The cell of the texture atlas to draw. */
+} RPGparticlevertex;
+
+/**
+ * @brief Renderable that simulates a pool of particles, drawing them all with a single instanced call.
+ */
+typedef struct RPGemitter
+{
+    RPGbasic base;         /** The base sprite object, MUST BE FIRST FIELD IN THE STRUCTURE! */
+    RPGimage *image;       /** The image or texture atlas particles are drawn with. */
+    RPGviewport *viewport; /** A pointer to the emitter's viewport, or NULL. */
+    RPGint capacity;       /** The maximum number of live particles. */
+    RPGint count;          /** The number of live particles. */
+    RPGfloat rate;         /** The number of particles spawned per second. */
+    RPGfloat budget;       /** Accumulated fraction of a particle to spawn on the next update. */
+    RPGbool emitting;      /** Flag indicating if particles are spawned at the current rate. */
+    RPGbool dirty;         /** Flag indicating the instance data needs rebuilt before rendering. */
+    RPGuint seed;          /** State of the random number generator. */
+    struct
+    {
+        RPGfloat *x, *y;   /** The location of each particle. */
+        RPGfloat *vx, *vy; /** The velocity of each particle, in pixels per second. */
+        RPGfloat *angle;   /** The rotation of each particle, in radians. */
+        RPGfloat *spin;    /** The angular velocity of each particle, in radians per second. */
+        RPGfloat *age;     /** The number of seconds each particle has been alive. */
+        RPGfloat *life;    /** The number of seconds each particle lives for. */
+        RPGfloat *frame;   /** The fixed atlas cell of each particle, when not animated. */
+    } particles;           /** Structure of arrays, allocated as a single block. */
+    struct
+    {
+        RPGfloat width, height;
+    } area; /** The size of the area centered on the emitter that particles spawn within. */
+    struct
+    {
+        RPGfloat min, max;
+    } life, speed, spin;
+    RPGfloat direction; /** The direction particles are launched in, in radians. */
+    RPGfloat spread;    /** The maximum deviation from the direction, in radians. */
+    RPGvec2 gravity;    /** Constant acceleration applied to every particle, in pixels per second squared. */
+    struct
+    {
+        RPGfloat start, end;
+    } size;
+    struct
+    {
+        RPGcolor keys[RPG_EMITTER_MAX_KEYS];
+        RPGint count;
+    } color; /** Colors evenly spaced over the lifetime of a particle. */
+    struct
+    {
+        RPGfloat keys[RPG_EMITTER_MAX_KEYS];
+        RPGint count;
+    } alpha; /** Opacity levels evenly spaced over the lifetime of a particle. */
+    struct
+    {
+        RPGint columns, rows;
+        RPGbool animate; /** Flag indicating frames advance over the lifetime, otherwise each particle picks one at random. */
+    } frames;
+    RPGparticlevertex *vertices; /** Staging memory for the instance data. */
+    GLuint vbo;
+    GLuint vao;
+} RPGemitter;
+
+/**
+ * @brief A single vertex of a primitive, matching the attribute layout of the primitive shader.
+ */
+typedef struct RPGprimitivevertex
+{
+    RPGfloat x, y;     /** The location of the vertex, relative to the object. */
+    RPGubyte color[4]; /** The color of the vertex. */
+} RPGprimitivevertex;
+
+/**
+ * @brief Renderable that accumulates lines and shapes into a single vertex buffer, drawn with one call.
+ */
+typedef struct RPGprimitives
+{
+    RPGbasic base;                /** The base sprite object, MUST BE FIRST FIELD IN THE STRUCTURE! */
+    RPGviewport *viewport;        /** A pointer to the object's viewport, or NULL. */
+    RPGprimitivevertex *vertices; /** The accumulated triangles of every primitive. */
+    RPGint count;                 /** The number of vertices. */
+    RPGint capacity;              /** The number of vertices that can be stored before reallocation. */
+    RPGint allocated;             /** The number of vertices the vertex buffer can hold. */
+    RPGbool dirty;                /** Flag indicating the vertices have changed since last uploaded. */
+    GLuint vbo;                   /** The Vertex Buffer Object bound to this object. */
+    GLuint vao;                   /** The Vertex Array Object bound to this object. */
+} RPGprimitives;
+
 /**
  * @brief Specialized sprite that automatically tiles its source image across its bounds.
  */
@@ -494,19 +1075,70 @@ typedef struct RPGplane
     RPGviewport *viewport; /** A pointer to the sprite's viewport, or NULL. */
     RPGint width;          /** The dimension of the plane, in pixels, on the x-axis. */
     RPGint height;         /** The dimension of the plane, in pixels, on the y-axis. */
-    GLuint vbo;            /** The Vertex Buffer Object bound to this sprite. */
-    GLuint vao;            /** The Vertex Array Object bound to this sprite. */
     GLuint sampler;        /** Sampler object for tiling the image across the bounds of the plane. */
-    RPGbool updateVAO;     /** Flag indicating the plane's VAO needs updated to reflect a change. */
+    RPGbool updateSource;  /** Flag indicating the plane's source region needs updated to reflect a change. */
     RPGvec2 zoom;          /** The amount of scaling to apply to the source image. */
 } RPGplane;
 
+/**
+ * @brief Menu window drawn directly from a window skin, with a scrollable contents image and selection cursor.
+ */
+typedef struct RPGwindow
+{
+    RPGbasic base;         /** The base sprite object, MUST BE FIRST FIELD IN THE STRUCTURE! */
+    RPGviewport *viewport; /** A pointer to the window's viewport, or NULL. */
+    RPGimage *skin;        /** The window skin the frame, background, and cursor are taken from. */
+    RPGimage *contents;    /** The image drawn within the padding of the window, or NULL. */
+    RPGint width;          /** The dimension of the window, in pixels, on the x-axis. */
+    RPGint height;         /** The dimension of the window, in pixels, on the y-axis. */
+    RPGint padding;        /** The distance between the edge of the window and its contents. */
+    RPGint ox;             /** The scroll offset of the contents on the x-axis. */
+    RPGint oy;             /** The scroll offset of the contents on the y-axis. */
+    RPGrect cursor;        /** The cursor rectangle, relative to the contents, hidden when empty. */
+    RPGbool tiled;         /** Flag indicating the background is tiled rather than stretched. */
+    struct
+    {
+        RPGrect background;  /** The source rectangle of the background. */
+        RPGrect frame;       /** The source rectangle of the frame, split into nine slices. */
+        RPGrect cursor;      /** The source rectangle of the cursor, split into nine slices. */
+        RPGint frameBorder;  /** The size of the frame's corners and edges. */
+        RPGint cursorBorder; /** The size of the cursor's corners and edges. */
+        RPGint margin;       /** The inset of the background from the edge of the window. */
+    } layout;
+    struct
+    {
+        RPGfloat value; /** The current openness, from 0.0 (closed) to 1.0 (open). */
+        RPGfloat speed; /** The change in openness per update while animating. */
+        RPGbool active; /** Flag indicating the window is in the list of windows being animated. */
+    } openness;
+    RPGfloat *vertices;    /** Cached geometry, the skin quads followed by the contents quad. */
+    RPGint quadCount;      /** The number of quads drawn from the skin. */
+    RPGint capacity;       /** The number of quads the vertex buffer can hold. */
+    RPGbool updateVAO;     /** Flag indicating the geometry needs rebuilt to reflect a change. */
+    GLuint vbo;            /** The Vertex Buffer Object bound to this window. */
+    GLuint vao;            /** The Vertex Array Object bound to this window. */
+} RPGwindow;
+
 extern const char *RPG_VERTEX_SHADER;
 extern const char *RPG_FRAGMENT_SHADER;
 extern const char *RPG_FONT_VERTEX;
 extern const char *RPG_FONT_FRAGMENT;
+extern const char *RPG_SCREEN_VERTEX;
+extern const char *RPG_SCREEN_FRAGMENT;
+extern const char *RPG_POSTFX_COPY_FRAGMENT;
+extern const char *RPG_POSTFX_BLUR_FRAGMENT;
+extern const char *RPG_POSTFX_THRESHOLD_FRAGMENT;
+extern const char *RPG_POSTFX_COMBINE_FRAGMENT;
+extern const char *RPG_LIGHT_VERTEX;
+extern const char *RPG_LIGHT_FRAGMENT;
+extern const char *RPG_PARTICLE_VERTEX;
+extern const char *RPG_PARTICLE_FRAGMENT;
+extern const char *RPG_PRIMITIVE_VERTEX;
+extern const char *RPG_PRIMITIVE_FRAGMENT;
 extern const char *RPG_TILEMAP_VERTEX;
 extern const char *RPG_TILEMAP_FRAGMENT;
+extern const char *RPG_TILEMAP_INDEXED_VERTEX;
+extern const char *RPG_TILEMAP_INDEXED_FRAGMENT;
 
 extern const char *RPG_TRANSITION_BASE_VERTEX;
 extern const char *RPG_TRANSITION_BASE_FRAGMENT;
@@ -584,15 +1216,68 @@ void RPG_Batch_DeleteItem(RPGbatch *batch, RPGrenderable *item);
 void RPG_Batch_Sort(RPGbatch *batch, int first, int last);
 
 void RPG_BasicSprite_Init(RPGbasic *basic, RPGrenderfunc renderfunc, RPGbatch *batch);
+void RPG_BasicSprite_Detach(RPGbasic *basic);
+void RPG_BasicSprite_UpdateModel(RPGbasic *basic, RPGfloat x, RPGfloat y, RPGfloat w, RPGfloat h, RPGint offsetX, RPGint offsetY);
+void RPG_BasicSprite_ResolveNodes(RPGbatch *roots);
+void RPG_BasicSprite_ToWorld(RPGbasic *basic, RPGfloat x, RPGfloat y, RPGfloat *wx, RPGfloat *wy);
+void RPG_BasicSprite_BindUniforms(RPGbasic *basic);
+void RPG_BasicSprite_RenderTexture(RPGbasic *basic, GLuint texture);
+void RPG_Material_Bind(RPGmaterial *material);
 void RPG_Renderable_Init(RPGrenderable *renderable, RPGrenderfunc renderfunc, RPGbatch *batch);
 
+void RPG_Viewport_Init(RPGviewport *viewport, RPGint x, RPGint y, RPGint width, RPGint height, RPGrenderfunc renderfunc);
+void RPG_Viewport_Destroy(RPGviewport *viewport);
+RPGint RPG_Tilemap_FindTiles(RPGtilemap *tilemap, const char *property, RPGvec4 **rects);
+void RPG_Tilemap_SetupLoader(void);
+struct _tmx_map *RPG_Tilemap_LoadMap(const char *path);
+RPG_RESULT RPG_Tilemap_CreateFromMap(struct _tmx_map *map, RPGviewport *viewport, RPGtilemap **tilemap);
+void RPG_Tilemap_DiscardMap(struct _tmx_map *map);
+
+void RPG_Emitter_UpdateAll(RPGgame *game);
+void RPG_Animation_UpdateAll(RPGgame *game);
+void RPG_Tween_UpdateAll(RPGgame *game);
+void RPG_Tween_Detach(RPGbasic *target);
+void RPG_Window_UpdateAll(RPGgame *game);
+void RPG_World_UpdateAll(RPGgame *game);
+void RPG_World_Detach(RPGbasic *object);
+RPGbool RPG_Image_HitTest(RPGimage *image, RPGint x, RPGint y);
+void RPG_Animation_Detach(RPGsprite *sprite);
+void RPG_Sprite_SetSource(RPGsprite *sprite, RPGrect *rect);
+
+void RPG_Screen_Update(RPGgame *game);
+RPGbool RPG_Screen_Begin(RPGgame *game);
+void RPG_Screen_Finish(RPGgame *game);
+void RPG_Screen_Free(RPGgame *game);
+
+RPGrendertarget *RPG_PostFX_Acquire(RPGint width, RPGint height);
+void RPG_PostFX_Release(RPGrendertarget *target);
+void RPG_PostFX_Collect(RPGgame *game);
+void RPG_PostFX_Terminate(RPGgame *game);
+RPGbool RPG_PostFX_IsActive(RPGpostchain *chain);
+RPGrendertarget *RPG_PostFX_Apply(RPGpostchain *chain, GLuint texture, RPGint width, RPGint height);
+void RPG_PostFX_ClearChain(RPGpostchain *chain);
+
 RPG_RESULT RPG_ReadFile(const char *filename, char **buffer, size_t *size);
 
+void RPG_Drawing_Initialize(RPGgame *game);
+GLuint RPG_Drawing_CreateTexture(GLsizei width, GLsizei height, GLenum internalFormat, GLenum format, const void *pixels, GLenum wrap,
+                                 GLenum filter);
+void RPG_Drawing_DeleteTexture(GLuint texture);
+GLuint RPG_Drawing_CreateFramebuffer(GLuint texture);
+GLuint RPG_Drawing_CreateBuffer(GLsizeiptr size, const void *data, RPGbool dynamic);
+void RPG_Drawing_BufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data);
+void *RPG_Drawing_MapBuffer(GLuint buffer, GLintptr offset, GLsizeiptr length);
+void RPG_Drawing_UnmapBuffer(GLuint buffer);
+GLuint RPG_Drawing_CreateVertexArray(GLuint vbo);
+
 GLuint _texture[32];
 GLenum _unit;
 GLenum _op;
 GLenum _srcFactor;
 GLenum _dstFactor;
+GLuint _program;
+RPGmat4 _projection;
+RPGuint _projectionVersion;
 
 static inline float RPG_Drawing_GetUV(float t, float dim)
 {
@@ -613,6 +1298,55 @@ static inline void RPG_Drawing_BindTexture(GLuint texture, GLenum unit)
     }
 }
 
+/**
+ * @brief Binds a buffer texture to a texture unit, leaving the 2D texture bound to the unit unchanged.
+ *
+ * @param texture The buffer texture to bind.
+ * @param unit The texture unit to bind to.
+ */
+static inline void RPG_Drawing_BindTextureBuffer(GLuint texture, GLenum unit)
+{
+    if (unit != _unit)
+    {
+        glActiveTexture(unit);
+        _unit = unit;
+    }
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+}
+
+/**
+ * @brief Flags the picking index to be rebuilt before the next query, as an object within it was freed or changed.
+ */
+static inline void RPG_Pick_Invalidate(void)
+{
+    if (RPG_GAME != NULL)
+    {
+        RPG_GAME->pick.dirty = RPG_TRUE;
+    }
+}
+
+static inline void RPG_Drawing_UseProgram(GLuint program)
+{
+    if (program != _program)
+    {
+        glUseProgram(program);
+        _program = program;
+    }
+}
+
+/**
+ * @brief Sets the projection matrix of the default program, and records it for materials to upload when they are next bound.
+ *
+ * @param projection The projection matrix to apply.
+ */
+static inline void RPG_Drawing_SetProjection(const RPGmat4 *projection)
+{
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+    glUniformMatrix4fv(RPG_GAME->shader.projection, 1, GL_FALSE, (const GLfloat *) projection);
+    _projection = *projection;
+    _projectionVersion++;
+}
+
 static inline void RPG_Drawing_SetBlending(GLenum op, GLenum srcFactor, GLenum dstFactor)
 {
     if (op != _op)
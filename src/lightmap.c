@@ -0,0 +1,422 @@
+#include "internal.h"
+
+#define RPG_LIGHTMAP_INIT_CAPACITY 16
+
+// Returns RPG_ERR_OUT_OF_RANGE if a light handle does not refer to a light in use
+#define RPG_CHECK_LIGHT(lm, light)                                                                                                         \
+    if ((light) < 0 || (light) >= (lm)->lights.count || (lm)->lights.items[light].shape.w == 0.0f)                                         \
+    return RPG_ERR_OUT_OF_RANGE
+
+/****************************************************************************************
+ * Helper Functions
+ ****************************************************************************************/
+
+/**
+ * @brief Compiles the light program shared by all light maps on first use.
+ *
+ * @param game The game instance.
+ * @return RPG_RESULT The result of the operation.
+ */
+static RPG_RESULT RPG_Lightmap_EnsureProgram(RPGgame *game)
+{
+    if (game->light.program != 0)
+    {
+        return RPG_NO_ERROR;
+    }
+    RPGshader *shader;
+    RPG_RESULT result = RPG_Shader_Create(RPG_LIGHT_VERTEX, RPG_LIGHT_FRAGMENT, NULL, &shader);
+    if (result)
+    {
+        return result;
+    }
+
+    // Only need the shader name for storing within the game structure
+    game->light.program = shader->program;
+    RPG_FREE(shader);
+
+    game->light.projection = glGetUniformLocation(game->light.program, UNIFORM_PROJECTION);
+    game->light.origin     = glGetUniformLocation(game->light.program, "origin");
+    game->light.occluder   = glGetUniformLocation(game->light.program, "occluder");
+    game->light.ambient    = glGetUniformLocation(game->light.program, "ambient");
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Configures a VAO to read consecutive vec4 attributes from a buffer once per instance.
+ *
+ * @param vao The vertex array object to configure.
+ * @param vbo The vertex buffer object containing the instance data.
+ * @param count The number of vec4 attributes in each instance.
+ */
+static void RPG_Lightmap_SetupVAO(GLuint vao, GLuint vbo, GLint count)
+{
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    for (GLint i = 0; i < count; i++)
+    {
+        glEnableVertexAttribArray(i);
+        glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, (GLsizei)(sizeof(RPGvec4) * count), (void *) (sizeof(RPGvec4) * i));
+        glVertexAttribDivisor(i, 1);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/**
+ * @brief Grows the light storage and its instance buffer to hold at least the specified number of lights.
+ *
+ * @param lm The light map.
+ * @param capacity The required capacity.
+ */
+static void RPG_Lightmap_Reserve(RPGlightmap *lm, RPGint capacity)
+{
+    if (capacity <= lm->lights.capacity)
+    {
+        return;
+    }
+    capacity          = imax(capacity, lm->lights.capacity * 2);
+    lm->lights.items  = RPG_REALLOC(lm->lights.items, sizeof(RPGlightdata) * capacity);
+    memset(&lm->lights.items[lm->lights.capacity], 0, sizeof(RPGlightdata) * (capacity - lm->lights.capacity));
+    lm->lights.capacity = capacity;
+
+    // Buffer storage may be immutable, so it is recreated rather than resized
+    if (lm->lights.vbo != 0)
+    {
+        glDeleteBuffers(1, &lm->lights.vbo);
+    }
+    else
+    {
+        glGenVertexArrays(1, &lm->lights.vao);
+    }
+    lm->lights.vbo   = RPG_Drawing_CreateBuffer(sizeof(RPGlightdata) * capacity, NULL, RPG_TRUE);
+    lm->lights.dirty = RPG_TRUE;
+    RPG_Lightmap_SetupVAO(lm->lights.vao, lm->lights.vbo, 3);
+}
+
+/**
+ * @brief Finds an unused light slot, growing the storage if required.
+ *
+ * @param lm The light map.
+ * @return RPGint The index of the slot.
+ */
+static RPGint RPG_Lightmap_AllocLight(RPGlightmap *lm)
+{
+    for (RPGint i = 0; i < lm->lights.count; i++)
+    {
+        if (lm->lights.items[i].shape.w == 0.0f)
+        {
+            return i;
+        }
+    }
+    RPG_Lightmap_Reserve(lm, lm->lights.count + 1);
+    return lm->lights.count++;
+}
+
+static void RPG_Lightmap_DeleteOccluders(RPGlightmap *lm)
+{
+    if (lm->occluders.vbo != 0)
+    {
+        glDeleteVertexArrays(1, &lm->occluders.vao);
+        glDeleteBuffers(1, &lm->occluders.vbo);
+        lm->occluders.vao = 0;
+        lm->occluders.vbo = 0;
+    }
+    lm->occluders.count = 0;
+}
+
+/****************************************************************************************
+ * Rendering
+ ****************************************************************************************/
+
+static void RPG_Lightmap_Render(void *lightmap)
+{
+    RPGlightmap *lm = lightmap;
+    RPGviewport *v  = &lm->viewport;
+    if (v->batch.updated)
+    {
+        RPG_Batch_Sort(&v->batch, 0, v->batch.total - 1);
+    }
+
+    // Bind the light map's FBO, and start from the ambient light level
+    glBindFramebuffer(GL_FRAMEBUFFER, v->fbo);
+    RPG_VIEWPORT(0, 0, v->width, v->height);
+    glClearColor(lm->ambient.x, lm->ambient.y, lm->ambient.z, lm->ambient.w);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Accumulate every light in a single instanced draw
+    RPGgame *game = RPG_GAME;
+    RPG_Drawing_UseProgram(game->light.program);
+    glUniformMatrix4fv(game->light.projection, 1, GL_FALSE, (GLfloat *) &v->projection);
+    glUniform2f(game->light.origin, (GLfloat) v->base.ox, (GLfloat) v->base.oy);
+    if (lm->lights.count > 0)
+    {
+        if (lm->lights.dirty)
+        {
+            RPG_Drawing_BufferSubData(lm->lights.vbo, 0, sizeof(RPGlightdata) * lm->lights.count, lm->lights.items);
+            lm->lights.dirty = RPG_FALSE;
+        }
+        glUniform1i(game->light.occluder, GL_FALSE);
+        RPG_Drawing_SetBlending(GL_FUNC_ADD, GL_ONE, GL_ONE);
+        glBindVertexArray(lm->lights.vao);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, lm->lights.count);
+    }
+
+    // Child sprites are rendered with their own blending, allowing custom light shapes with additive sprites
+    if (v->batch.total > 0)
+    {
+        RPG_Drawing_SetProjection(&v->projection);
+        RPGrenderable *r;
+        for (int i = 0; i < v->batch.total; i++)
+        {
+            r = v->batch.items[i];
+            r->render(r);
+        }
+    }
+
+    // Occluders receive no light, replace them with the ambient level
+    if (lm->occluders.count > 0)
+    {
+        RPG_Drawing_UseProgram(game->light.program);
+        glUniform1i(game->light.occluder, GL_TRUE);
+        glUniform4f(game->light.ambient, lm->ambient.x, lm->ambient.y, lm->ambient.z, lm->ambient.w);
+        RPG_Drawing_SetBlending(GL_FUNC_ADD, GL_ONE, GL_ZERO);
+        glBindVertexArray(lm->occluders.vao);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, lm->occluders.count);
+    }
+    // Apply any post-processing, such as a blur to soften the edges of occluders
+    RPGrendertarget *post = RPG_PostFX_Apply(&v->postfx, v->texture, v->width, v->height);
+
+    // Change the render target back to the screen
+    RPG_BIND_TARGET();
+    RPG_RESET_VIEWPORT();
+    RPG_RESET_BACK_COLOR();
+
+    // The light map always covers the entire resolution, regardless of the scale it is rendered at
+    if (v->base.updated)
+    {
+        RPG_BasicSprite_UpdateModel(&v->base, v->base.x, v->base.y, game->resolution.width, game->resolution.height, 0, 0);
+        v->base.updated = RPG_FALSE;
+    }
+
+    // Multiply over the scene with the blending of the light map
+    RPG_RESET_PROJECTION();
+    RPG_BasicSprite_BindUniforms(&v->base);
+    RPG_RENDER_TEXTURE(post ? post->texture : v->texture, v->vao);
+    RPG_PostFX_Release(post);
+}
+
+/****************************************************************************************
+ * Light Map
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Lightmap_Create(RPGint scale, RPGlightmap **lightmap)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    if (scale < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_RESULT result = RPG_Lightmap_EnsureProgram(RPG_GAME);
+    if (result)
+    {
+        return result;
+    }
+
+    RPGint width  = RPG_GAME->resolution.width;
+    RPGint height = RPG_GAME->resolution.height;
+    RPG_ALLOC_ZERO(lm, RPGlightmap);
+    RPG_Viewport_Init(&lm->viewport, 0, 0, imax(1, width / scale), imax(1, height / scale), RPG_Lightmap_Render);
+
+    // Lights are positioned in pixels of the full resolution
+    RPG_MAT4_ORTHO(lm->viewport.projection, 0.0f, width, height, 0.0f, -1.0f, 1.0f);
+
+    // Smooth the reduced resolution when it is stretched over the screen
+    RPG_Drawing_BindTexture(lm->viewport.texture, GL_TEXTURE0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // Multiply the light levels with everything beneath the light map
+    lm->viewport.base.blend.op  = RPG_BLEND_OP_ADD;
+    lm->viewport.base.blend.src = RPG_BLEND_DST_COLOR;
+    lm->viewport.base.blend.dst = RPG_BLEND_ZERO;
+
+    lm->scale   = scale;
+    lm->ambient = (RPGcolor){0.0f, 0.0f, 0.0f, 1.0f};
+    RPG_Lightmap_Reserve(lm, RPG_LIGHTMAP_INIT_CAPACITY);
+
+    *lightmap = lm;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_Free(RPGlightmap *lightmap)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_Lightmap_DeleteOccluders(lightmap);
+    glDeleteVertexArrays(1, &lightmap->lights.vao);
+    glDeleteBuffers(1, &lightmap->lights.vbo);
+    RPG_FREE(lightmap->lights.items);
+    RPG_Viewport_Destroy(&lightmap->viewport);
+    RPG_FREE(lightmap);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_GetScale(RPGlightmap *lightmap, RPGint *scale)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    if (scale != NULL)
+    {
+        *scale = lightmap->scale;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_GetAmbient(RPGlightmap *lightmap, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    if (color != NULL)
+    {
+        *color = lightmap->ambient;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_SetAmbient(RPGlightmap *lightmap, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    if (color == NULL)
+    {
+        lightmap->ambient = (RPGcolor){0.0f, 0.0f, 0.0f, 1.0f};
+    }
+    else
+    {
+        lightmap->ambient = *color;
+    }
+    return RPG_NO_ERROR;
+}
+
+/****************************************************************************************
+ * Lights
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Lightmap_CreatePointLight(RPGlightmap *lightmap, RPGfloat x, RPGfloat y, RPGfloat radius, RPGcolor *color, RPGint *light)
+{
+    return RPG_Lightmap_CreateConeLight(lightmap, x, y, radius, 0.0f, (RPGfloat) RPG_PI, color, light);
+}
+
+RPG_RESULT RPG_Lightmap_CreateConeLight(RPGlightmap *lightmap, RPGfloat x, RPGfloat y, RPGfloat radius, RPGfloat direction,
+                                        RPGfloat angle, RPGcolor *color, RPGint *light)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_RETURN_IF_NULL(light);
+
+    RPGint index       = RPG_Lightmap_AllocLight(lightmap);
+    RPGlightdata *data = &lightmap->lights.items[index];
+    data->shape        = (RPGvec4){x, y, fmaxf(radius, 0.0f), 1.0f};
+    data->color        = color ? *color : (RPGcolor){1.0f, 1.0f, 1.0f, 1.0f};
+    data->cone         = (RPGvec4){direction, fmaxf(angle, 0.0f), 0.25f, 0.0f};
+
+    lightmap->lights.dirty = RPG_TRUE;
+    *light                 = index;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_RemoveLight(RPGlightmap *lightmap, RPGint light)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_CHECK_LIGHT(lightmap, light);
+    memset(&lightmap->lights.items[light], 0, sizeof(RPGlightdata));
+
+    // Trim unused slots from the end so they are not drawn
+    while (lightmap->lights.count > 0 && lightmap->lights.items[lightmap->lights.count - 1].shape.w == 0.0f)
+    {
+        lightmap->lights.count--;
+    }
+    lightmap->lights.dirty = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_GetLightLocation(RPGlightmap *lightmap, RPGint light, RPGfloat *x, RPGfloat *y)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_CHECK_LIGHT(lightmap, light);
+    if (x != NULL)
+    {
+        *x = lightmap->lights.items[light].shape.x;
+    }
+    if (y != NULL)
+    {
+        *y = lightmap->lights.items[light].shape.y;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_SetLightLocation(RPGlightmap *lightmap, RPGint light, RPGfloat x, RPGfloat y)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_CHECK_LIGHT(lightmap, light);
+    lightmap->lights.items[light].shape.x = x;
+    lightmap->lights.items[light].shape.y = y;
+    lightmap->lights.dirty                = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_SetLightRadius(RPGlightmap *lightmap, RPGint light, RPGfloat radius)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_CHECK_LIGHT(lightmap, light);
+    lightmap->lights.items[light].shape.z = fmaxf(radius, 0.0f);
+    lightmap->lights.dirty                = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_SetLightColor(RPGlightmap *lightmap, RPGint light, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_RETURN_IF_NULL(color);
+    RPG_CHECK_LIGHT(lightmap, light);
+    lightmap->lights.items[light].color = *color;
+    lightmap->lights.dirty              = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_SetLightCone(RPGlightmap *lightmap, RPGint light, RPGfloat direction, RPGfloat angle, RPGfloat softness)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_CHECK_LIGHT(lightmap, light);
+    RPGvec4 *cone          = &lightmap->lights.items[light].cone;
+    cone->x                = direction;
+    cone->y                = fmaxf(angle, 0.0f);
+    cone->z                = RPG_CLAMPF(softness, 0.0f, 1.0f);
+    lightmap->lights.dirty = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+/****************************************************************************************
+ * Occluders
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Lightmap_SetOccluders(RPGlightmap *lightmap, RPGtilemap *tilemap, const char *property)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_RETURN_IF_NULL(tilemap);
+    RPG_RETURN_IF_NULL(property);
+    RPG_Lightmap_DeleteOccluders(lightmap);
+
+    RPGvec4 *rects;
+    RPGint count = RPG_Tilemap_FindTiles(tilemap, property, &rects);
+    if (count > 0)
+    {
+        lightmap->occluders.vbo = RPG_Drawing_CreateBuffer(sizeof(RPGvec4) * count, rects, RPG_FALSE);
+        glGenVertexArrays(1, &lightmap->occluders.vao);
+        RPG_Lightmap_SetupVAO(lightmap->occluders.vao, lightmap->occluders.vbo, 1);
+        lightmap->occluders.count = count;
+    }
+    RPG_FREE(rects);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Lightmap_ClearOccluders(RPGlightmap *lightmap)
+{
+    RPG_RETURN_IF_NULL(lightmap);
+    RPG_Lightmap_DeleteOccluders(lightmap);
+    return RPG_NO_ERROR;
+}
@@ -0,0 +1,294 @@
+#include "internal.h"
+
+#define RPG_MATERIAL_INIT_CAPACITY 4
+
+/**
+ * @brief Finds the stored value for a uniform location, creating a new entry if one does not exist.
+ *
+ * @param material The material to search.
+ * @param location The location of the uniform.
+ * @return RPGuniform* The stored uniform.
+ */
+static RPGuniform *RPG_Material_FindUniform(RPGmaterial *material, GLint location)
+{
+    for (RPGint i = 0; i < material->uniformCount; i++)
+    {
+        if (material->uniforms[i].location == location)
+        {
+            return &material->uniforms[i];
+        }
+    }
+    if (material->uniformCount == material->capacity)
+    {
+        material->capacity *= 2;
+        material->uniforms = RPG_REALLOC(material->uniforms, sizeof(RPGuniform) * material->capacity);
+    }
+    RPGuniform *uniform = &material->uniforms[material->uniformCount++];
+    memset(uniform, 0, sizeof(RPGuniform));
+    uniform->location = location;
+    return uniform;
+}
+
+/**
+ * @brief Stores a uniform value, flagging it for upload only if it differs from the current value.
+ *
+ * @param material The material to store the value within.
+ * @param location The location of the uniform.
+ * @param type The base type of the value.
+ * @param count The number of components in the value.
+ * @param value A pointer to the components.
+ * @return RPG_RESULT The result of the operation.
+ */
+static RPG_RESULT RPG_Material_StoreUniform(RPGmaterial *material, GLint location, GLenum type, GLint count, const void *value)
+{
+    RPG_RETURN_IF_NULL(material);
+    if (location < 0)
+    {
+        // Consistent with glUniform, values for inactive uniforms are silently ignored
+        return RPG_NO_ERROR;
+    }
+    RPGuniform *uniform = RPG_Material_FindUniform(material, location);
+    RPGsize size        = (type == GL_INT ? sizeof(GLint) : sizeof(GLfloat)) * count;
+    if (uniform->type != type || uniform->count != count || memcmp(&uniform->value, value, size) != 0)
+    {
+        uniform->type  = type;
+        uniform->count = count;
+        memcpy(&uniform->value, value, size);
+        uniform->dirty = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Uploads a stored uniform value to the currently active program.
+ *
+ * @param uniform The uniform to upload.
+ */
+static void RPG_Material_UploadUniform(RPGuniform *uniform)
+{
+    if (uniform->type == GL_FLOAT_MAT4)
+    {
+        glUniformMatrix4fv(uniform->location, 1, GL_FALSE, uniform->value.f);
+    }
+    else if (uniform->type == GL_INT)
+    {
+        switch (uniform->count)
+        {
+            case 1: glUniform1iv(uniform->location, 1, uniform->value.i); break;
+            case 2: glUniform2iv(uniform->location, 1, uniform->value.i); break;
+            case 3: glUniform3iv(uniform->location, 1, uniform->value.i); break;
+            default: glUniform4iv(uniform->location, 1, uniform->value.i); break;
+        }
+    }
+    else
+    {
+        switch (uniform->count)
+        {
+            case 1: glUniform1fv(uniform->location, 1, uniform->value.f); break;
+            case 2: glUniform2fv(uniform->location, 1, uniform->value.f); break;
+            case 3: glUniform3fv(uniform->location, 1, uniform->value.f); break;
+            default: glUniform4fv(uniform->location, 1, uniform->value.f); break;
+        }
+    }
+    uniform->dirty = RPG_FALSE;
+}
+
+void RPG_Material_Bind(RPGmaterial *material)
+{
+    RPGshader *shader = material->shader;
+    RPG_Drawing_UseProgram(shader->program);
+
+    // Programs may be shared between materials, in which case the uniform state of the program belongs to whichever was last bound
+    RPGbool owner = shader->material == material;
+    if (!owner)
+    {
+        shader->material     = material;
+        material->projection = _projectionVersion - 1;
+        material->time       = -1;
+        for (int i = 1; i < RPG_MATERIAL_MAX_TEXTURES; i++)
+        {
+            if (material->textures[i].location >= 0)
+            {
+                glUniform1i(material->textures[i].location, i);
+            }
+        }
+    }
+    for (RPGint i = 0; i < material->uniformCount; i++)
+    {
+        if (!owner || material->uniforms[i].dirty)
+        {
+            RPG_Material_UploadUniform(&material->uniforms[i]);
+        }
+    }
+    if (material->projection != _projectionVersion)
+    {
+        glUniformMatrix4fv(material->builtin.projection, 1, GL_FALSE, (GLfloat *) &_projection);
+        material->projection = _projectionVersion;
+    }
+    if (material->time != RPG_GAME->update.count)
+    {
+        glUniform1f(material->builtin.time, (GLfloat) RPG_GAME->update.count);
+        material->time = RPG_GAME->update.count;
+    }
+    for (int i = 1; i < RPG_MATERIAL_MAX_TEXTURES; i++)
+    {
+        if (material->textures[i].image != NULL)
+        {
+            RPG_Drawing_BindTexture(material->textures[i].image->texture, GL_TEXTURE0 + i);
+        }
+    }
+}
+
+RPG_RESULT RPG_Material_Create(RPGshader *shader, RPGmaterial **material)
+{
+    RPG_RETURN_IF_NULL(shader);
+    RPG_RETURN_IF_NULL(material);
+    RPG_ALLOC_ZERO(m, RPGmaterial);
+
+    m->shader   = shader;
+    m->capacity = RPG_MATERIAL_INIT_CAPACITY;
+    m->uniforms = RPG_ALLOC_N(RPGuniform, RPG_MATERIAL_INIT_CAPACITY);
+    for (int i = 0; i < RPG_MATERIAL_MAX_TEXTURES; i++)
+    {
+        m->textures[i].location = -1;
+    }
+
+    // Pre-cache the locations of the standard uniforms, any the program does not declare are ignored
+    m->builtin.projection = glGetUniformLocation(shader->program, UNIFORM_PROJECTION);
+    m->builtin.model      = glGetUniformLocation(shader->program, UNIFORM_MODEL);
+    m->builtin.color      = glGetUniformLocation(shader->program, UNIFORM_COLOR);
+    m->builtin.tone       = glGetUniformLocation(shader->program, UNIFORM_TONE);
+    m->builtin.alpha      = glGetUniformLocation(shader->program, UNIFORM_ALPHA);
+    m->builtin.hue        = glGetUniformLocation(shader->program, UNIFORM_HUE);
+    m->builtin.flash      = glGetUniformLocation(shader->program, UNIFORM_FLASH);
+    m->builtin.source     = glGetUniformLocation(shader->program, UNIFORM_SOURCE);
+    m->builtin.distortion = glGetUniformLocation(shader->program, UNIFORM_DISTORTION);
+    m->builtin.time       = glGetUniformLocation(shader->program, UNIFORM_TIME);
+    m->projection         = _projectionVersion - 1;
+    RPG_Batch_Init(&m->users);
+
+    *material = m;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Material_Free(RPGmaterial *material)
+{
+    RPG_RETURN_IF_NULL(material);
+    if (material->shader->material == material)
+    {
+        material->shader->material = NULL;
+    }
+    // Objects still using the material revert to the default shader
+    RPGrenderable *r;
+    for (RPGint i = 0; i < material->users.total; i++)
+    {
+        r           = material->users.items[i];
+        r->material = NULL;
+        if (r->parent != NULL)
+        {
+            r->parent->updated = RPG_TRUE;
+        }
+    }
+    RPG_Batch_Free(&material->users);
+    RPG_FREE(material->uniforms);
+    RPG_FREE(material);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Material_GetShader(RPGmaterial *material, RPGshader **shader)
+{
+    RPG_RETURN_IF_NULL(material);
+    if (shader != NULL)
+    {
+        *shader = material->shader;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Material_SetUniform1f(RPGmaterial *material, RPGint location, RPGfloat v1)
+{
+    GLfloat v[] = {v1};
+    return RPG_Material_StoreUniform(material, location, GL_FLOAT, 1, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform2f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2)
+{
+    GLfloat v[] = {v1, v2};
+    return RPG_Material_StoreUniform(material, location, GL_FLOAT, 2, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform3f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2, RPGfloat v3)
+{
+    GLfloat v[] = {v1, v2, v3};
+    return RPG_Material_StoreUniform(material, location, GL_FLOAT, 3, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform4f(RPGmaterial *material, RPGint location, RPGfloat v1, RPGfloat v2, RPGfloat v3, RPGfloat v4)
+{
+    GLfloat v[] = {v1, v2, v3, v4};
+    return RPG_Material_StoreUniform(material, location, GL_FLOAT, 4, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform1i(RPGmaterial *material, RPGint location, RPGint v1)
+{
+    GLint v[] = {v1};
+    return RPG_Material_StoreUniform(material, location, GL_INT, 1, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform2i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2)
+{
+    GLint v[] = {v1, v2};
+    return RPG_Material_StoreUniform(material, location, GL_INT, 2, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform3i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2, RPGint v3)
+{
+    GLint v[] = {v1, v2, v3};
+    return RPG_Material_StoreUniform(material, location, GL_INT, 3, v);
+}
+
+RPG_RESULT RPG_Material_SetUniform4i(RPGmaterial *material, RPGint location, RPGint v1, RPGint v2, RPGint v3, RPGint v4)
+{
+    GLint v[] = {v1, v2, v3, v4};
+    return RPG_Material_StoreUniform(material, location, GL_INT, 4, v);
+}
+
+RPG_RESULT RPG_Material_SetUniformMat4(RPGmaterial *material, RPGint location, RPGmat4 *mat)
+{
+    RPG_RETURN_IF_NULL(mat);
+    return RPG_Material_StoreUniform(material, location, GL_FLOAT_MAT4, 16, mat);
+}
+
+RPG_RESULT RPG_Material_BindImage(RPGmaterial *material, RPGint location, RPGint unit, RPGimage *image)
+{
+    RPG_RETURN_IF_NULL(material);
+    if (unit < 1 || unit >= RPG_MATERIAL_MAX_TEXTURES)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (material->textures[unit].location != location && material->shader->material == material)
+    {
+        // Force the sampler units to be assigned again when next bound
+        material->shader->material = NULL;
+    }
+    material->textures[unit].location = location;
+    material->textures[unit].image    = image;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Material_GetUserPointer(RPGmaterial *material, void **user)
+{
+    RPG_RETURN_IF_NULL(material);
+    if (user != NULL)
+    {
+        *user = material->user;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Material_SetUserPointer(RPGmaterial *material, void *user)
+{
+    RPG_RETURN_IF_NULL(material);
+    material->user = user;
+    return RPG_NO_ERROR;
+}
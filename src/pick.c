@@ -0,0 +1,389 @@
+#include "internal.h"
+
+#define RPG_PICK_INIT_CAPACITY 64
+
+/****************************************************************************************
+ * Affine Transforms
+ *
+ * Stored as {a, b, c, d, tx, ty}, mapping a point to (a * x + c * y + tx, b * x + d * y + ty).
+ ****************************************************************************************/
+
+static inline void RPG_Affine_FromModel(const RPGmat4 *m, RPGfloat *out)
+{
+    out[0] = m->m11;
+    out[1] = m->m12;
+    out[2] = m->m21;
+    out[3] = m->m22;
+    out[4] = m->m41;
+    out[5] = m->m42;
+}
+
+static inline void RPG_Affine_Multiply(const RPGfloat *left, const RPGfloat *right, RPGfloat *out)
+{
+    RPGfloat r[6] = {left[0] * right[0] + left[2] * right[1],
+                     left[1] * right[0] + left[3] * right[1],
+                     left[0] * right[2] + left[2] * right[3],
+                     left[1] * right[2] + left[3] * right[3],
+                     left[0] * right[4] + left[2] * right[5] + left[4],
+                     left[1] * right[4] + left[3] * right[5] + left[5]};
+    memcpy(out, r, sizeof(r));
+}
+
+static inline RPGbool RPG_Affine_Invert(const RPGfloat *m, RPGfloat *out)
+{
+    RPGfloat det = m[0] * m[3] - m[2] * m[1];
+    if (fabsf(det) < __FLT_EPSILON__)
+    {
+        return RPG_FALSE;
+    }
+    RPGfloat inv  = 1.0f / det;
+    RPGfloat r[6] = {m[3] * inv, -m[1] * inv, -m[2] * inv, m[0] * inv, (m[2] * m[5] - m[3] * m[4]) * inv,
+                     (m[1] * m[4] - m[0] * m[5]) * inv};
+    memcpy(out, r, sizeof(r));
+    return RPG_TRUE;
+}
+
+static inline void RPG_Affine_Apply(const RPGfloat *m, RPGfloat x, RPGfloat y, RPGfloat *rx, RPGfloat *ry)
+{
+    *rx = m[0] * x + m[2] * y + m[4];
+    *ry = m[1] * x + m[3] * y + m[5];
+}
+
+/**
+ * @brief Computes the screen-space bounding box of a rectangle in local space.
+ *
+ * @param m The transform from local space to screen space.
+ * @param w The width of the rectangle.
+ * @param h The height of the rectangle.
+ * @param bounds The rectangle to receive the bounding box, rounded outwards to whole pixels.
+ */
+static void RPG_Affine_Bounds(const RPGfloat *m, RPGfloat w, RPGfloat h, RPGrect *bounds)
+{
+    RPGfloat xs[4], ys[4];
+    RPG_Affine_Apply(m, 0.0f, 0.0f, &xs[0], &ys[0]);
+    RPG_Affine_Apply(m, w, 0.0f, &xs[1], &ys[1]);
+    RPG_Affine_Apply(m, 0.0f, h, &xs[2], &ys[2]);
+    RPG_Affine_Apply(m, w, h, &xs[3], &ys[3]);
+    RPGfloat l = fminf(fminf(xs[0], xs[1]), fminf(xs[2], xs[3]));
+    RPGfloat t = fminf(fminf(ys[0], ys[1]), fminf(ys[2], ys[3]));
+    RPGfloat r = fmaxf(fmaxf(xs[0], xs[1]), fmaxf(xs[2], xs[3]));
+    RPGfloat b = fmaxf(fmaxf(ys[0], ys[1]), fmaxf(ys[2], ys[3]));
+    bounds->x  = (RPGint) floorf(l);
+    bounds->y  = (RPGint) floorf(t);
+    bounds->w  = (RPGint) ceilf(r) - bounds->x;
+    bounds->h  = (RPGint) ceilf(b) - bounds->y;
+}
+
+static inline void RPG_Rect_Intersect(RPGrect *rect, const RPGrect *other)
+{
+    RPGint l = imax(rect->x, other->x);
+    RPGint t = imax(rect->y, other->y);
+    RPGint r = imin(rect->x + rect->w, other->x + other->w);
+    RPGint b = imin(rect->y + rect->h, other->y + other->h);
+    *rect    = (RPGrect){l, t, imax(r - l, 0), imax(b - t, 0)};
+}
+
+/****************************************************************************************
+ * Spatial Index
+ ****************************************************************************************/
+
+/**
+ * @brief Adds an object to the list of entries, if any of it is visible on the screen.
+ *
+ * @param game The game instance.
+ * @param item The object.
+ * @param viewport The viewport the object is rendered within, or NULL.
+ * @param parent The transform from the pixels of the viewport to the screen, ignored when viewport is NULL.
+ * @param w The width of the object's local space.
+ * @param h The height of the object's local space.
+ */
+static void RPG_Pick_AddEntry(RPGgame *game, RPGrenderable *item, RPGviewport *viewport, const RPGfloat *parent, RPGfloat w, RPGfloat h)
+{
+    RPGbasic *basic = (RPGbasic *) item;
+    RPGfloat transform[6];
+    RPG_Affine_FromModel(&basic->model, transform);
+    if (viewport != NULL)
+    {
+        RPG_Affine_Multiply(parent, transform, transform);
+    }
+
+    RPGpickentry entry;
+    if (!RPG_Affine_Invert(transform, entry.local))
+    {
+        return;
+    }
+    RPGrect screen = {0, 0, game->resolution.width, game->resolution.height};
+    RPG_Affine_Bounds(transform, w, h, &entry.bounds);
+    RPG_Rect_Intersect(&entry.bounds, &screen);
+    if (viewport != NULL)
+    {
+        RPGrect clip;
+        RPG_Affine_Bounds(parent, viewport->width, viewport->height, &clip);
+        RPG_Rect_Intersect(&entry.bounds, &clip);
+        RPG_Affine_Invert(parent, entry.clip);
+    }
+    if (entry.bounds.w == 0 || entry.bounds.h == 0)
+    {
+        return;
+    }
+    entry.item     = item;
+    entry.viewport = viewport;
+
+    if (game->pick.count == game->pick.capacity)
+    {
+        game->pick.capacity = imax(game->pick.capacity * 2, RPG_PICK_INIT_CAPACITY);
+        game->pick.entries  = RPG_REALLOC(game->pick.entries, sizeof(RPGpickentry) * game->pick.capacity);
+    }
+    game->pick.entries[game->pick.count++] = entry;
+}
+
+/**
+ * @brief Adds an object and anything rendered within it to the list of entries.
+ *
+ * @param game The game instance.
+ * @param item The object.
+ * @param viewport The viewport the object is rendered within, or NULL.
+ * @param parent The transform from the pixels of the viewport to the screen, ignored when viewport is NULL.
+ */
+static void RPG_Pick_Collect(RPGgame *game, RPGrenderable *item, RPGviewport *viewport, const RPGfloat *parent)
+{
+    RPGbasic *basic = (RPGbasic *) item;
+    if (item->pick == RPG_PICK_NONE || !item->visible || basic->alpha < __FLT_EPSILON__)
+    {
+        return;
+    }
+    // The model is only rebuilt when rendered, so objects changed since are picked where they were last drawn, and objects
+    // never drawn have no model to invert and are excluded, what is picked is what is seen
+    switch (item->pick)
+    {
+        case RPG_PICK_SPRITE:
+        {
+            if (((RPGsprite *) item)->image != NULL)
+            {
+                RPG_Pick_AddEntry(game, item, viewport, parent, 1.0f, 1.0f);
+            }
+            break;
+        }
+        case RPG_PICK_WINDOW:
+        {
+            RPGwindow *w = (RPGwindow *) item;
+            if (w->openness.value > 0.0f)
+            {
+                RPG_Pick_AddEntry(game, item, viewport, parent, w->width, w->height);
+            }
+            break;
+        }
+        case RPG_PICK_VIEWPORT:
+        {
+            // The viewport's model maps a unit quad, scale it so its children are transformed from pixels of the viewport
+            RPGviewport *v  = (RPGviewport *) item;
+            RPGfloat fit[6] = {1.0f / v->width, 0.0f, 0.0f, 1.0f / v->height, 0.0f, 0.0f};
+            RPGfloat vtm[6];
+            RPG_Affine_FromModel(&v->base.model, vtm);
+            RPG_Affine_Multiply(vtm, fit, vtm);
+            for (int i = 0; i < v->batch.total; i++)
+            {
+                RPG_Pick_Collect(game, v->batch.items[i], v, vtm);
+            }
+            break;
+        }
+        default: break;
+    }
+}
+
+/**
+ * @brief Rebuilds the list of entries and the grid of cells that reference them.
+ *
+ * @param game The game instance.
+ */
+static void RPG_Pick_Rebuild(RPGgame *game)
+{
+    game->pick.count = 0;
+    for (int i = 0; i < game->batch.total; i++)
+    {
+        RPG_Pick_Collect(game, game->batch.items[i], NULL, NULL);
+    }
+
+    RPGint columns = (game->resolution.width + RPG_PICK_CELL_SIZE - 1) / RPG_PICK_CELL_SIZE;
+    RPGint rows    = (game->resolution.height + RPG_PICK_CELL_SIZE - 1) / RPG_PICK_CELL_SIZE;
+    if (columns * rows != game->pick.columns * game->pick.rows || game->pick.cells == NULL)
+    {
+        game->pick.cells = RPG_REALLOC(game->pick.cells, sizeof(RPGint) * (columns * rows + 1));
+    }
+    game->pick.columns = columns;
+    game->pick.rows    = rows;
+
+    // Counting sort of entries into cells, which keeps each cell's list in the order the entries were drawn
+    RPGint *cells = game->pick.cells;
+    memset(cells, 0, sizeof(RPGint) * (columns * rows + 1));
+    RPGpickentry *e;
+    for (RPGint i = 0; i < game->pick.count; i++)
+    {
+        e = &game->pick.entries[i];
+        for (RPGint cy = e->bounds.y / RPG_PICK_CELL_SIZE; cy <= (e->bounds.y + e->bounds.h - 1) / RPG_PICK_CELL_SIZE; cy++)
+        {
+            for (RPGint cx = e->bounds.x / RPG_PICK_CELL_SIZE; cx <= (e->bounds.x + e->bounds.w - 1) / RPG_PICK_CELL_SIZE; cx++)
+            {
+                cells[cy * columns + cx + 1]++;
+            }
+        }
+    }
+    for (RPGint i = 1; i <= columns * rows; i++)
+    {
+        cells[i] += cells[i - 1];
+    }
+    RPGint total = cells[columns * rows];
+    if (total > game->pick.itemCapacity)
+    {
+        game->pick.itemCapacity = total;
+        game->pick.items        = RPG_REALLOC(game->pick.items, sizeof(RPGint) * total);
+    }
+
+    // Fill each cell using the cell starts, which are shifted back into place afterwards
+    for (RPGint i = 0; i < game->pick.count; i++)
+    {
+        e = &game->pick.entries[i];
+        for (RPGint cy = e->bounds.y / RPG_PICK_CELL_SIZE; cy <= (e->bounds.y + e->bounds.h - 1) / RPG_PICK_CELL_SIZE; cy++)
+        {
+            for (RPGint cx = e->bounds.x / RPG_PICK_CELL_SIZE; cx <= (e->bounds.x + e->bounds.w - 1) / RPG_PICK_CELL_SIZE; cx++)
+            {
+                game->pick.items[cells[cy * columns + cx]++] = i;
+            }
+        }
+    }
+    for (RPGint i = columns * rows; i > 0; i--)
+    {
+        cells[i] = cells[i - 1];
+    }
+    cells[0]         = 0;
+    game->pick.dirty = RPG_FALSE;
+}
+
+/**
+ * @brief Tests if a point in screen space hits an entry.
+ *
+ * @param e The entry to test.
+ * @param x The location on the x-axis.
+ * @param y The location on the y-axis.
+ * @return RPGbool RPG_TRUE if the point hits a solid part of the object, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_Pick_HitTest(RPGpickentry *e, RPGfloat x, RPGfloat y)
+{
+    RPGfloat lx, ly;
+    if (e->viewport != NULL)
+    {
+        RPG_Affine_Apply(e->clip, x, y, &lx, &ly);
+        if (lx < 0.0f || ly < 0.0f || lx >= e->viewport->width || ly >= e->viewport->height)
+        {
+            return RPG_FALSE;
+        }
+    }
+    RPG_Affine_Apply(e->local, x, y, &lx, &ly);
+    switch (e->item->pick)
+    {
+        case RPG_PICK_SPRITE:
+        {
+            // Local space is the unit quad, which maps to the source rectangle of the image
+            if (lx < 0.0f || ly < 0.0f || lx >= 1.0f || ly >= 1.0f)
+            {
+                return RPG_FALSE;
+            }
+            RPGsprite *s = (RPGsprite *) e->item;
+            return RPG_Image_HitTest(s->image, s->rect.x + (RPGint)(lx * s->rect.w), s->rect.y + (RPGint)(ly * s->rect.h));
+        }
+        case RPG_PICK_WINDOW:
+        {
+            RPGwindow *w = (RPGwindow *) e->item;
+            return lx >= 0.0f && ly >= 0.0f && lx < w->width && ly < w->height;
+        }
+        default: return RPG_FALSE;
+    }
+}
+
+/****************************************************************************************
+ * Picking
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Game_PickPoint(RPGgame *game, RPGint x, RPGint y, RPGrenderable **result)
+{
+    RPG_RETURN_IF_NULL(game);
+    RPG_RETURN_IF_NULL(result);
+    *result = NULL;
+    if (x < 0 || y < 0 || x >= game->resolution.width || y >= game->resolution.height)
+    {
+        return RPG_NO_ERROR;
+    }
+    if (game->pick.dirty || game->pick.cells == NULL)
+    {
+        RPG_Pick_Rebuild(game);
+    }
+
+    // Test the centre of the pixel, from the last drawn entry in the cell to the first
+    RPGint cell = (y / RPG_PICK_CELL_SIZE) * game->pick.columns + (x / RPG_PICK_CELL_SIZE);
+    RPGpickentry *e;
+    for (RPGint i = game->pick.cells[cell + 1] - 1; i >= game->pick.cells[cell]; i--)
+    {
+        e = &game->pick.entries[game->pick.items[i]];
+        if (x < e->bounds.x || y < e->bounds.y || x >= e->bounds.x + e->bounds.w || y >= e->bounds.y + e->bounds.h)
+        {
+            continue;
+        }
+        if (RPG_Pick_HitTest(e, x + 0.5f, y + 0.5f))
+        {
+            *result = e->item;
+            break;
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_PickRect(RPGgame *game, RPGrect *rect, RPGrenderable **result)
+{
+    RPG_RETURN_IF_NULL(game);
+    RPG_RETURN_IF_NULL(rect);
+    RPG_RETURN_IF_NULL(result);
+    *result = NULL;
+
+    RPGrect area   = *rect;
+    RPGrect screen = {0, 0, game->resolution.width, game->resolution.height};
+    RPG_Rect_Intersect(&area, &screen);
+    if (area.w == 0 || area.h == 0)
+    {
+        return RPG_NO_ERROR;
+    }
+    if (game->pick.dirty || game->pick.cells == NULL)
+    {
+        RPG_Pick_Rebuild(game);
+    }
+
+    // Entries are indexed in draw order, so the topmost is the highest index overlapping the area
+    RPGint top = -1, index;
+    RPGpickentry *e;
+    for (RPGint cy = area.y / RPG_PICK_CELL_SIZE; cy <= (area.y + area.h - 1) / RPG_PICK_CELL_SIZE; cy++)
+    {
+        for (RPGint cx = area.x / RPG_PICK_CELL_SIZE; cx <= (area.x + area.w - 1) / RPG_PICK_CELL_SIZE; cx++)
+        {
+            RPGint cell = cy * game->pick.columns + cx;
+            for (RPGint i = game->pick.cells[cell + 1] - 1; i >= game->pick.cells[cell]; i--)
+            {
+                index = game->pick.items[i];
+                if (index <= top)
+                {
+                    break;
+                }
+                e = &game->pick.entries[index];
+                if (e->bounds.x < area.x + area.w && area.x < e->bounds.x + e->bounds.w && e->bounds.y < area.y + area.h &&
+                    area.y < e->bounds.y + e->bounds.h)
+                {
+                    top = index;
+                    break;
+                }
+            }
+        }
+    }
+    if (top >= 0)
+    {
+        *result = game->pick.entries[top].item;
+    }
+    return RPG_NO_ERROR;
+}
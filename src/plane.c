@@ -8,44 +8,33 @@ static void RPG_Plane_Render(void *plane)
         return;
     }
 
-    if (p->updateVAO)
+    if (p->updateSource)
     {
         GLfloat l = ((GLfloat) p->base.ox / p->image->width) * p->zoom.x;
         GLfloat t = ((GLfloat) p->base.oy / p->image->height) * p->zoom.y;
-        GLfloat r = l + (((GLfloat) p->width / p->image->width) * p->zoom.x);
-        GLfloat b = t + (((GLfloat) p->height / p->image->height) * p->zoom.y);
-        glBindBuffer(GL_ARRAY_BUFFER, p->vbo);
-        float vertices[VERTICES_COUNT] = {0.0f, 1.0f, l, b, 1.0f, 0.0f, r, t, 0.0f, 0.0f, l, t,
-                                          0.0f, 1.0f, l, b, 1.0f, 1.0f, r, b, 1.0f, 0.0f, r, t};
-        glBufferSubData(GL_ARRAY_BUFFER, 0, VERTICES_SIZE, vertices);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        p->updateVAO = RPG_FALSE;
+        GLfloat w = ((GLfloat) p->width / p->image->width) * p->zoom.x;
+        GLfloat h = ((GLfloat) p->height / p->image->height) * p->zoom.y;
+
+        // Coordinates outside of the image are wrapped by the sampler, so the shared unit quad can tile the image
+        p->base.source  = (RPGvec4){l, t, w, h};
+        p->updateSource = RPG_FALSE;
     }
 
     if (p->base.updated)
     {
-        GLint x = p->base.x;
-        GLint y = p->base.y;
+        RPGint ox = 0, oy = 0;
         if (p->viewport != NULL)
         {
-            x += p->viewport->base.ox;
-            y += p->viewport->base.oy;
+            ox = p->viewport->base.ox;
+            oy = p->viewport->base.oy;
         }
-
-        GLfloat sx  = p->base.scale.x * p->width;
-        GLfloat sy  = p->base.scale.y * p->height;
-        GLfloat cos = cosf(p->base.rotation.radians);
-        GLfloat sin = sinf(p->base.rotation.radians);
-        RPG_MAT4_SET(p->base.model, sx * cos, sx * sin, 0.0f, 0.0f, sy * -sin, sy * cos, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
-                     (p->base.rotation.ox * (1.0f - cos) + p->base.rotation.oy * sin) + x,
-                     (p->base.rotation.oy * (1.0f - cos) - p->base.rotation.ox * sin) + y, 0.0f, 1.0f);
-
+        RPG_BasicSprite_UpdateModel(&p->base, p->base.x, p->base.y, p->width, p->height, ox, oy);
         p->base.updated = RPG_FALSE;
     }
 
-    RPG_BASE_UNIFORMS(p->base);
+    RPG_BasicSprite_BindUniforms(&p->base);
     glBindSampler(0, p->sampler);
-    RPG_RENDER_TEXTURE(p->image->texture, p->vao);
+    RPG_BasicSprite_RenderTexture(&p->base, p->image->texture);
     glBindSampler(0, 0);
 }
 
@@ -66,9 +55,9 @@ RPG_RESULT RPG_Plane_Create(RPGviewport *viewport, RPGplane **plane)
         p->width  = RPG_GAME->resolution.width;
         p->height = RPG_GAME->resolution.height;
     }
-    p->zoom.x    = 1.0f;
-    p->zoom.y    = 1.0f;
-    p->updateVAO = RPG_TRUE;
+    p->zoom.x       = 1.0f;
+    p->zoom.y       = 1.0f;
+    p->updateSource = RPG_TRUE;
 
     // Generate sampler
     glGenSamplers(1, &p->sampler);
@@ -77,17 +66,6 @@ RPG_RESULT RPG_Plane_Create(RPGviewport *viewport, RPGplane **plane)
     glSamplerParameteri(p->sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glSamplerParameteri(p->sampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-    // Generate VAO/VBO
-    glGenVertexArrays(1, &p->vao);
-    glBindVertexArray(p->vao);
-    glGenBuffers(1, &p->vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, p->vbo);
-    glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), NULL);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
     *plane = p;
     return RPG_NO_ERROR;
 }
@@ -95,10 +73,9 @@ RPG_RESULT RPG_Plane_Create(RPGviewport *viewport, RPGplane **plane)
 RPG_RESULT RPG_Plane_Free(RPGplane *plane)
 {
     RPG_RETURN_IF_NULL(plane);
+    RPG_BasicSprite_Detach(&plane->base);
     RPG_Renderable_Free(&plane->base.renderable);
 
-    glDeleteVertexArrays(1, &plane->vao);
-    glDeleteBuffers(1, &plane->vbo);
     glDeleteSamplers(1, &plane->sampler);
     RPG_FREE(plane);
     return RPG_NO_ERROR;
@@ -135,6 +112,7 @@ RPG_RESULT RPG_Plane_SetRect(RPGplane *plane, RPGrect *rect)
     plane->width        = rect->w;
     plane->height       = rect->h;
     plane->base.updated = RPG_TRUE;
+    plane->updateSource = RPG_TRUE;
 
     return RPG_NO_ERROR;
 }
@@ -169,6 +147,7 @@ RPG_RESULT RPG_Plane_SetBounds(RPGplane *plane, RPGint x, RPGint y, RPGint width
     plane->width        = width;
     plane->height       = height;
     plane->base.updated = RPG_TRUE;
+    plane->updateSource = RPG_TRUE;
 
     return RPG_NO_ERROR;
 }
@@ -192,9 +171,9 @@ RPG_RESULT RPG_Plane_SetOrigin(RPGplane *plane, RPGint x, RPGint y)
     RPG_RETURN_IF_NULL(plane);
     if (x != plane->base.ox || y != plane->base.oy)
     {
-        plane->base.ox   = x;
-        plane->base.oy   = y;
-        plane->updateVAO = RPG_TRUE;
+        plane->base.ox      = x;
+        plane->base.oy      = y;
+        plane->updateSource = RPG_TRUE;
     }
     return RPG_NO_ERROR;
 }
@@ -216,9 +195,9 @@ RPG_RESULT RPG_Plane_GetZoom(RPGplane *plane, RPGfloat *x, RPGfloat *y)
 RPG_RESULT RPG_Plane_SetZoom(RPGplane *plane, RPGfloat x, RPGfloat y)
 {
     RPG_RETURN_IF_NULL(plane);
-    plane->zoom.x    = x;
-    plane->zoom.y    = y;
-    plane->updateVAO = RPG_TRUE;
+    plane->zoom.x       = x;
+    plane->zoom.y       = y;
+    plane->updateSource = RPG_TRUE;
     return RPG_NO_ERROR;
 }
 
@@ -237,6 +216,6 @@ RPG_RESULT RPG_Plane_SetImage(RPGplane *plane, RPGimage *image)
     RPG_RETURN_IF_NULL(plane);
     plane->image        = image;
     plane->base.updated = RPG_TRUE;
-    plane->updateVAO    = RPG_TRUE;
+    plane->updateSource = RPG_TRUE;
     return RPG_NO_ERROR;
 }
\ No newline at end of file
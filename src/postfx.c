@@ -0,0 +1,604 @@
+#include "internal.h"
+
+#define RPG_POSTFX_INIT_CAPACITY 4
+
+// The number of frames an unused render target is kept in the pool before being deleted
+#define RPG_POSTFX_MAX_IDLE 120
+
+/****************************************************************************************
+ * Render Target Pool
+ ****************************************************************************************/
+
+RPGrendertarget *RPG_PostFX_Acquire(RPGint width, RPGint height)
+{
+    RPGgame *game = RPG_GAME;
+    for (RPGint i = 0; i < game->postfx.poolCount; i++)
+    {
+        RPGrendertarget *target = game->postfx.pool[i];
+        if (!target->busy && target->width == width && target->height == height)
+        {
+            target->busy  = RPG_TRUE;
+            target->frame = game->postfx.frame;
+            return target;
+        }
+    }
+
+    // No free target in this size bucket, create a new one
+    if (game->postfx.poolCount == game->postfx.poolCapacity)
+    {
+        game->postfx.poolCapacity = imax(RPG_POSTFX_INIT_CAPACITY, game->postfx.poolCapacity * 2);
+        game->postfx.pool         = RPG_REALLOC(game->postfx.pool, sizeof(RPGrendertarget *) * game->postfx.poolCapacity);
+    }
+    RPG_ALLOC_ZERO(target, RPGrendertarget);
+    target->width   = width;
+    target->height  = height;
+    target->texture = RPG_Drawing_CreateTexture(width, height, GL_RGBA8, GL_RGBA, NULL, GL_CLAMP_TO_EDGE, GL_LINEAR);
+    target->fbo     = RPG_Drawing_CreateFramebuffer(target->texture);
+    target->busy    = RPG_TRUE;
+    target->frame   = game->postfx.frame;
+
+    game->postfx.pool[game->postfx.poolCount++] = target;
+    return target;
+}
+
+void RPG_PostFX_Release(RPGrendertarget *target)
+{
+    if (target != NULL)
+    {
+        target->busy = RPG_FALSE;
+    }
+}
+
+/**
+ * @brief Deletes a render target and its GPU resources.
+ *
+ * @param target The target to delete.
+ */
+static void RPG_PostFX_DeleteTarget(RPGrendertarget *target)
+{
+    glDeleteFramebuffers(1, &target->fbo);
+    RPG_Drawing_DeleteTexture(target->texture);
+    RPG_FREE(target);
+}
+
+void RPG_PostFX_Collect(RPGgame *game)
+{
+    // Expire targets that have gone unused, i.e. after a change of resolution or an effect being removed
+    RPGint count = 0;
+    for (RPGint i = 0; i < game->postfx.poolCount; i++)
+    {
+        RPGrendertarget *target = game->postfx.pool[i];
+        if (!target->busy && game->postfx.frame - target->frame > RPG_POSTFX_MAX_IDLE)
+        {
+            RPG_PostFX_DeleteTarget(target);
+        }
+        else
+        {
+            game->postfx.pool[count++] = target;
+        }
+    }
+    game->postfx.poolCount = count;
+    game->postfx.frame++;
+}
+
+void RPG_PostFX_Terminate(RPGgame *game)
+{
+    for (RPGint i = 0; i < game->postfx.poolCount; i++)
+    {
+        RPG_PostFX_DeleteTarget(game->postfx.pool[i]);
+    }
+    RPG_FREE(game->postfx.pool);
+    RPG_PostFX_ClearChain(&game->postfx.chain);
+    game->postfx.pool         = NULL;
+    game->postfx.poolCount    = 0;
+    game->postfx.poolCapacity = 0;
+    glDeleteProgram(game->postfx.copy.program);
+    glDeleteProgram(game->postfx.blur.program);
+    glDeleteProgram(game->postfx.threshold.program);
+    glDeleteProgram(game->postfx.combine.program);
+}
+
+/****************************************************************************************
+ * Passes
+ ****************************************************************************************/
+
+/**
+ * @brief Compiles a built-in post-processing program, returning only its name.
+ *
+ * @param fragSrc The source of the fragment shader.
+ * @return GLuint The program name, or 0 on failure.
+ */
+static GLuint RPG_PostFX_CreateProgram(const char *fragSrc)
+{
+    RPGshader *shader;
+    if (RPG_Shader_Create(RPG_SCREEN_VERTEX, fragSrc, NULL, &shader) != RPG_NO_ERROR)
+    {
+        return 0;
+    }
+    GLuint program = shader->program;
+    RPG_FREE(shader);
+    RPG_Drawing_UseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "image"), 0);
+    return program;
+}
+
+/**
+ * @brief Compiles the built-in programs on first use.
+ *
+ * @param game The game instance.
+ * @return RPGbool RPG_TRUE if the programs are available, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_PostFX_EnsurePrograms(RPGgame *game)
+{
+    if (game->postfx.copy.program != 0)
+    {
+        return RPG_TRUE;
+    }
+    game->postfx.copy.program      = RPG_PostFX_CreateProgram(RPG_POSTFX_COPY_FRAGMENT);
+    game->postfx.blur.program      = RPG_PostFX_CreateProgram(RPG_POSTFX_BLUR_FRAGMENT);
+    game->postfx.threshold.program = RPG_PostFX_CreateProgram(RPG_POSTFX_THRESHOLD_FRAGMENT);
+    game->postfx.combine.program   = RPG_PostFX_CreateProgram(RPG_POSTFX_COMBINE_FRAGMENT);
+    if (!game->postfx.copy.program || !game->postfx.blur.program || !game->postfx.threshold.program || !game->postfx.combine.program)
+    {
+        glDeleteProgram(game->postfx.copy.program);
+        glDeleteProgram(game->postfx.blur.program);
+        glDeleteProgram(game->postfx.threshold.program);
+        glDeleteProgram(game->postfx.combine.program);
+        game->postfx.copy.program = 0;
+        return RPG_FALSE;
+    }
+
+    game->postfx.blur.direction      = glGetUniformLocation(game->postfx.blur.program, "direction");
+    game->postfx.threshold.threshold = glGetUniformLocation(game->postfx.threshold.program, "threshold");
+    game->postfx.combine.intensity   = glGetUniformLocation(game->postfx.combine.program, "intensity");
+    RPG_Drawing_UseProgram(game->postfx.combine.program);
+    glUniform1i(glGetUniformLocation(game->postfx.combine.program, "bloom"), 1);
+    return RPG_TRUE;
+}
+
+/**
+ * @brief Draws a texture into a render target using the active program.
+ *
+ * @param input The texture to sample from, bound to unit 0.
+ * @param output The target to render to.
+ */
+static void RPG_PostFX_Pass(GLuint input, RPGrendertarget *output)
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, output->fbo);
+    RPG_VIEWPORT(0, 0, output->width, output->height);
+    RPG_Drawing_BindTexture(input, GL_TEXTURE0);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+}
+
+/**
+ * @brief Reduces a texture by successive halving, letting linear filtering average each 2x2 block.
+ *
+ * @param input The texture to reduce.
+ * @param width The width of the input texture.
+ * @param height The height of the input texture.
+ * @param factor The divisor of the resolution, either 1, 2, or 4.
+ * @return RPGrendertarget* The reduced target, or NULL if @a factor is 1.
+ */
+static RPGrendertarget *RPG_PostFX_Downsample(GLuint input, RPGint width, RPGint height, RPGint factor)
+{
+    RPGrendertarget *result = NULL;
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.copy.program);
+    for (RPGint f = 2; f <= factor; f *= 2)
+    {
+        width                   = imax(1, width / 2);
+        height                  = imax(1, height / 2);
+        RPGrendertarget *output = RPG_PostFX_Acquire(width, height);
+        RPG_PostFX_Pass(input, output);
+        RPG_PostFX_Release(result);
+        result = output;
+        input  = output->texture;
+    }
+    return result;
+}
+
+/**
+ * @brief Blurs a target in-place with a horizontal and vertical pass.
+ *
+ * @param target The target to blur.
+ * @param radius The blur radius, in texels of the target.
+ */
+static void RPG_PostFX_BlurTarget(RPGrendertarget *target, RPGfloat radius)
+{
+    // The kernel spans roughly 3.23 taps in each direction, scale the step to cover the radius
+    RPGfloat step         = fmaxf(radius / 3.2307692308f, 0.0f);
+    RPGrendertarget *temp = RPG_PostFX_Acquire(target->width, target->height);
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.blur.program);
+    glUniform2f(RPG_GAME->postfx.blur.direction, step / target->width, 0.0f);
+    RPG_PostFX_Pass(target->texture, temp);
+    glUniform2f(RPG_GAME->postfx.blur.direction, 0.0f, step / target->height);
+    RPG_PostFX_Pass(temp->texture, target);
+    RPG_PostFX_Release(temp);
+}
+
+static void RPG_PostFX_ApplyBlur(RPGpostfx *fx, GLuint input, RPGrendertarget *output)
+{
+    RPGrendertarget *small = RPG_PostFX_Downsample(input, output->width, output->height, fx->downsample);
+    if (small == NULL)
+    {
+        // Full resolution, copy into the output and blur it there
+        RPG_Drawing_UseProgram(RPG_GAME->postfx.copy.program);
+        RPG_PostFX_Pass(input, output);
+        RPG_PostFX_BlurTarget(output, fx->radius);
+        return;
+    }
+    RPG_PostFX_BlurTarget(small, fx->radius / fx->downsample);
+
+    // Upsample back to full resolution
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.copy.program);
+    RPG_PostFX_Pass(small->texture, output);
+    RPG_PostFX_Release(small);
+}
+
+static void RPG_PostFX_ApplyBloom(RPGpostfx *fx, GLuint input, RPGrendertarget *output)
+{
+    // Extract the bright areas at reduced resolution
+    RPGrendertarget *small  = RPG_PostFX_Downsample(input, output->width, output->height, fx->downsample);
+    RPGint w                = small ? small->width : output->width;
+    RPGint h                = small ? small->height : output->height;
+    RPGrendertarget *bright = RPG_PostFX_Acquire(w, h);
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.threshold.program);
+    glUniform1f(RPG_GAME->postfx.threshold.threshold, fx->threshold);
+    RPG_PostFX_Pass(small ? small->texture : input, bright);
+    RPG_PostFX_Release(small);
+    RPG_PostFX_BlurTarget(bright, fx->radius / fx->downsample);
+
+    // Add the blurred highlights back over the source, upsampling with linear filtering
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.combine.program);
+    glUniform1f(RPG_GAME->postfx.combine.intensity, fx->intensity);
+    RPG_Drawing_BindTexture(bright->texture, GL_TEXTURE1);
+    RPG_PostFX_Pass(input, output);
+    RPG_PostFX_Release(bright);
+}
+
+static void RPG_PostFX_ApplyShader(RPGpostfx *fx, GLuint input, RPGrendertarget *output)
+{
+    RPGint w = imax(1, output->width / fx->downsample);
+    RPGint h = imax(1, output->height / fx->downsample);
+    RPG_Drawing_UseProgram(fx->shader->program);
+    glUniform2f(fx->resolution, (GLfloat) w, (GLfloat) h);
+    if (fx->downsample == 1)
+    {
+        RPG_PostFX_Pass(input, output);
+        return;
+    }
+    RPGrendertarget *small = RPG_PostFX_Acquire(w, h);
+    RPG_PostFX_Pass(input, small);
+    RPG_Drawing_UseProgram(RPG_GAME->postfx.copy.program);
+    RPG_PostFX_Pass(small->texture, output);
+    RPG_PostFX_Release(small);
+}
+
+RPGbool RPG_PostFX_IsActive(RPGpostchain *chain)
+{
+    for (RPGint i = 0; i < chain->count; i++)
+    {
+        if (chain->items[i]->enabled)
+        {
+            return RPG_TRUE;
+        }
+    }
+    return RPG_FALSE;
+}
+
+RPGrendertarget *RPG_PostFX_Apply(RPGpostchain *chain, GLuint texture, RPGint width, RPGint height)
+{
+    if (!RPG_PostFX_IsActive(chain) || !RPG_PostFX_EnsurePrograms(RPG_GAME))
+    {
+        return NULL;
+    }
+
+    // Each pass overwrites every pixel of its output, so blending is not required
+    glDisable(GL_BLEND);
+    glBindVertexArray(RPG_GAME->quad.vao);
+
+    RPGrendertarget *result = NULL, *output;
+    GLuint input            = texture;
+    RPGpostfx *fx;
+    for (RPGint i = 0; i < chain->count; i++)
+    {
+        fx = chain->items[i];
+        if (!fx->enabled)
+        {
+            continue;
+        }
+        output = RPG_PostFX_Acquire(width, height);
+        switch (fx->type)
+        {
+            case RPG_POSTFX_BLUR: RPG_PostFX_ApplyBlur(fx, input, output); break;
+            case RPG_POSTFX_BLOOM: RPG_PostFX_ApplyBloom(fx, input, output); break;
+            default: RPG_PostFX_ApplyShader(fx, input, output); break;
+        }
+        RPG_PostFX_Release(result);
+        result = output;
+        input  = output->texture;
+    }
+    glEnable(GL_BLEND);
+    return result;
+}
+
+/****************************************************************************************
+ * Chains
+ ****************************************************************************************/
+
+static RPG_RESULT RPG_PostFX_Add(RPGpostchain *chain, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(fx);
+    for (RPGint i = 0; i < chain->count; i++)
+    {
+        if (chain->items[i] == fx)
+        {
+            return RPG_ERR_INVALID_VALUE;
+        }
+    }
+    if (chain->count == chain->capacity)
+    {
+        chain->capacity = imax(RPG_POSTFX_INIT_CAPACITY, chain->capacity * 2);
+        chain->items    = RPG_REALLOC(chain->items, sizeof(RPGpostfx *) * chain->capacity);
+    }
+    chain->items[chain->count++] = fx;
+
+    // Effects remember each chain they are in, so that freeing one removes it from all of them
+    fx->chains                   = RPG_REALLOC(fx->chains, sizeof(RPGpostchain *) * (fx->chainCount + 1));
+    fx->chains[fx->chainCount++] = chain;
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Removes a chain from the list of chains an effect has been added to.
+ *
+ * @param fx The effect.
+ * @param chain The chain the effect was removed from.
+ */
+static void RPG_PostFX_ForgetChain(RPGpostfx *fx, RPGpostchain *chain)
+{
+    for (RPGint i = 0; i < fx->chainCount; i++)
+    {
+        if (fx->chains[i] == chain)
+        {
+            fx->chains[i] = fx->chains[--fx->chainCount];
+            break;
+        }
+    }
+}
+
+static RPG_RESULT RPG_PostFX_Remove(RPGpostchain *chain, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(fx);
+    for (RPGint i = 0; i < chain->count; i++)
+    {
+        if (chain->items[i] == fx)
+        {
+            memmove(&chain->items[i], &chain->items[i + 1], sizeof(RPGpostfx *) * (chain->count - i - 1));
+            chain->count--;
+            RPG_PostFX_ForgetChain(fx, chain);
+            return RPG_NO_ERROR;
+        }
+    }
+    return RPG_ERR_INVALID_VALUE;
+}
+
+void RPG_PostFX_ClearChain(RPGpostchain *chain)
+{
+    for (RPGint i = 0; i < chain->count; i++)
+    {
+        RPG_PostFX_ForgetChain(chain->items[i], chain);
+    }
+    RPG_FREE(chain->items);
+    chain->items    = NULL;
+    chain->count    = 0;
+    chain->capacity = 0;
+}
+
+RPG_RESULT RPG_Game_AddPostFX(RPGgame *game, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(game);
+    return RPG_PostFX_Add(&game->postfx.chain, fx);
+}
+
+RPG_RESULT RPG_Game_RemovePostFX(RPGgame *game, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(game);
+    return RPG_PostFX_Remove(&game->postfx.chain, fx);
+}
+
+RPG_RESULT RPG_Viewport_AddPostFX(RPGviewport *viewport, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(viewport);
+    return RPG_PostFX_Add(&viewport->postfx, fx);
+}
+
+RPG_RESULT RPG_Viewport_RemovePostFX(RPGviewport *viewport, RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(viewport);
+    return RPG_PostFX_Remove(&viewport->postfx, fx);
+}
+
+/****************************************************************************************
+ * Effects
+ ****************************************************************************************/
+
+/**
+ * @brief Allocates an effect with default values.
+ *
+ * @param type The type of effect.
+ * @param downsample The divisor of the resolution the effect is computed at.
+ * @return RPGpostfx* The allocated effect, or NULL if the divisor is invalid.
+ */
+static RPGpostfx *RPG_PostFX_Alloc(RPG_POSTFX_TYPE type, RPGint downsample)
+{
+    if (downsample != 1 && downsample != 2 && downsample != 4)
+    {
+        return NULL;
+    }
+    RPG_ALLOC_ZERO(fx, RPGpostfx);
+    fx->type       = type;
+    fx->enabled    = RPG_TRUE;
+    fx->downsample = downsample;
+    fx->resolution = -1;
+    fx->intensity  = 1.0f;
+    return fx;
+}
+
+RPG_RESULT RPG_PostFX_Create(const char *fragSrc, RPGint downsample, RPGpostfx **fx)
+{
+    RPG_RETURN_IF_NULL(fragSrc);
+    RPG_RETURN_IF_NULL(fx);
+    RPGpostfx *p = RPG_PostFX_Alloc(RPG_POSTFX_SHADER, downsample);
+    if (p == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_RESULT result = RPG_Shader_Create(RPG_SCREEN_VERTEX, fragSrc, NULL, &p->shader);
+    if (result)
+    {
+        RPG_FREE(p);
+        return result;
+    }
+    RPG_Drawing_UseProgram(p->shader->program);
+    glUniform1i(glGetUniformLocation(p->shader->program, "image"), 0);
+    p->resolution = glGetUniformLocation(p->shader->program, "resolution");
+    *fx           = p;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_CreateBlur(RPGfloat radius, RPGint downsample, RPGpostfx **fx)
+{
+    RPG_RETURN_IF_NULL(fx);
+    RPGpostfx *p = RPG_PostFX_Alloc(RPG_POSTFX_BLUR, downsample);
+    if (p == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    p->radius = fmaxf(radius, 0.0f);
+    *fx       = p;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_CreateBloom(RPGfloat threshold, RPGfloat intensity, RPGfloat radius, RPGpostfx **fx)
+{
+    RPG_RETURN_IF_NULL(fx);
+    // Bloom is soft by nature, always compute it at half resolution
+    RPGpostfx *p = RPG_PostFX_Alloc(RPG_POSTFX_BLOOM, 2);
+    p->threshold = RPG_CLAMPF(threshold, 0.0f, 1.0f);
+    p->intensity = fmaxf(intensity, 0.0f);
+    p->radius    = fmaxf(radius, 0.0f);
+    *fx          = p;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_Free(RPGpostfx *fx)
+{
+    RPG_RETURN_IF_NULL(fx);
+    // Remove the effect from every chain still applying it
+    while (fx->chainCount > 0)
+    {
+        RPG_PostFX_Remove(fx->chains[fx->chainCount - 1], fx);
+    }
+    RPG_FREE(fx->chains);
+    if (fx->shader != NULL)
+    {
+        RPG_Shader_Free(fx->shader);
+    }
+    RPG_FREE(fx);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetShader(RPGpostfx *fx, RPGshader **shader)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (shader != NULL)
+    {
+        *shader = fx->shader;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetEnabled(RPGpostfx *fx, RPGbool *enabled)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (enabled != NULL)
+    {
+        *enabled = fx->enabled;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_SetEnabled(RPGpostfx *fx, RPGbool enabled)
+{
+    RPG_RETURN_IF_NULL(fx);
+    fx->enabled = enabled;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetRadius(RPGpostfx *fx, RPGfloat *radius)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (radius != NULL)
+    {
+        *radius = fx->radius;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_SetRadius(RPGpostfx *fx, RPGfloat radius)
+{
+    RPG_RETURN_IF_NULL(fx);
+    fx->radius = fmaxf(radius, 0.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetThreshold(RPGpostfx *fx, RPGfloat *threshold)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (threshold != NULL)
+    {
+        *threshold = fx->threshold;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_SetThreshold(RPGpostfx *fx, RPGfloat threshold)
+{
+    RPG_RETURN_IF_NULL(fx);
+    fx->threshold = RPG_CLAMPF(threshold, 0.0f, 1.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetIntensity(RPGpostfx *fx, RPGfloat *intensity)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (intensity != NULL)
+    {
+        *intensity = fx->intensity;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_SetIntensity(RPGpostfx *fx, RPGfloat intensity)
+{
+    RPG_RETURN_IF_NULL(fx);
+    fx->intensity = fmaxf(intensity, 0.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_GetUserPointer(RPGpostfx *fx, void **user)
+{
+    RPG_RETURN_IF_NULL(fx);
+    if (user != NULL)
+    {
+        *user = fx->user;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_PostFX_SetUserPointer(RPGpostfx *fx, void *user)
+{
+    RPG_RETURN_IF_NULL(fx);
+    fx->user = user;
+    return RPG_NO_ERROR;
+}
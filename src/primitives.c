@@ -0,0 +1,459 @@
+#include "internal.h"
+
+#define RPG_PRIMITIVES_INIT_CAPACITY 256
+
+// The approximate length, in pixels, of each segment used to approximate a circle
+#define RPG_PRIMITIVES_SEGMENT_LENGTH 4.0f
+#define RPG_PRIMITIVES_MIN_SEGMENTS 8
+#define RPG_PRIMITIVES_MAX_SEGMENTS 128
+
+/**
+ * @brief Creates the shader program shared by all primitive batches if it has not been created yet.
+ *
+ * @param game The game instance.
+ * @return RPG_RESULT The result of the operation.
+ */
+static RPG_RESULT RPG_Primitives_EnsureProgram(RPGgame *game)
+{
+    if (game->primitives.program != 0)
+    {
+        return RPG_NO_ERROR;
+    }
+    RPGshader *shader;
+    RPG_RESULT result = RPG_Shader_Create(RPG_PRIMITIVE_VERTEX, RPG_PRIMITIVE_FRAGMENT, NULL, &shader);
+    if (result)
+    {
+        return result;
+    }
+
+    // Only need the shader name for storing within the game structure
+    game->primitives.program = shader->program;
+    RPG_FREE(shader);
+
+    GLuint program                     = game->primitives.program;
+    game->primitives.projection        = glGetUniformLocation(program, UNIFORM_PROJECTION);
+    game->primitives.model             = glGetUniformLocation(program, UNIFORM_MODEL);
+    game->primitives.color             = glGetUniformLocation(program, UNIFORM_COLOR);
+    game->primitives.tone              = glGetUniformLocation(program, UNIFORM_TONE);
+    game->primitives.alpha             = glGetUniformLocation(program, UNIFORM_ALPHA);
+    game->primitives.hue               = glGetUniformLocation(program, UNIFORM_HUE);
+    game->primitives.flash             = glGetUniformLocation(program, UNIFORM_FLASH);
+    game->primitives.source            = glGetUniformLocation(program, UNIFORM_SOURCE);
+    game->primitives.projectionVersion = _projectionVersion - 1;
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Reserves space at the end of the vertex array, growing it as required.
+ *
+ * @param p The primitive batch.
+ * @param count The number of vertices to reserve.
+ * @return RPGprimitivevertex* The first reserved vertex.
+ */
+static RPGprimitivevertex *RPG_Primitives_Reserve(RPGprimitives *p, RPGint count)
+{
+    if (p->count + count > p->capacity)
+    {
+        while (p->count + count > p->capacity)
+        {
+            p->capacity *= 2;
+        }
+        p->vertices = RPG_REALLOC(p->vertices, sizeof(RPGprimitivevertex) * p->capacity);
+    }
+    RPGprimitivevertex *v = &p->vertices[p->count];
+    p->count += count;
+    p->dirty = RPG_TRUE;
+    return v;
+}
+
+/**
+ * @brief Writes a single vertex.
+ *
+ * @param v The vertex to write.
+ * @param x The location of the vertex on the x-axis.
+ * @param y The location of the vertex on the y-axis.
+ * @param color The color of the vertex.
+ */
+static inline void RPG_Primitives_SetVertex(RPGprimitivevertex *v, RPGfloat x, RPGfloat y, const RPGcolor *color)
+{
+    v->x        = x;
+    v->y        = y;
+    v->color[0] = (RPGubyte)(RPG_CLAMPF(color->x, 0.0f, 1.0f) * 255.0f);
+    v->color[1] = (RPGubyte)(RPG_CLAMPF(color->y, 0.0f, 1.0f) * 255.0f);
+    v->color[2] = (RPGubyte)(RPG_CLAMPF(color->z, 0.0f, 1.0f) * 255.0f);
+    v->color[3] = (RPGubyte)(RPG_CLAMPF(color->w, 0.0f, 1.0f) * 255.0f);
+}
+
+/**
+ * @brief Writes a quadrilateral as two triangles, with the corners given in winding order.
+ */
+static void RPG_Primitives_PushQuad(RPGprimitives *p, RPGfloat x1, RPGfloat y1, RPGfloat x2, RPGfloat y2, RPGfloat x3, RPGfloat y3,
+                                    RPGfloat x4, RPGfloat y4, const RPGcolor *c1, const RPGcolor *c2, const RPGcolor *c3,
+                                    const RPGcolor *c4)
+{
+    RPGprimitivevertex *v = RPG_Primitives_Reserve(p, 6);
+    RPG_Primitives_SetVertex(&v[0], x1, y1, c1);
+    RPG_Primitives_SetVertex(&v[1], x2, y2, c2);
+    RPG_Primitives_SetVertex(&v[2], x3, y3, c3);
+    RPG_Primitives_SetVertex(&v[3], x1, y1, c1);
+    RPG_Primitives_SetVertex(&v[4], x3, y3, c3);
+    RPG_Primitives_SetVertex(&v[5], x4, y4, c4);
+}
+
+/**
+ * @brief Writes a line segment as a quad of the given width, centered on the line.
+ */
+static void RPG_Primitives_PushLine(RPGprimitives *p, RPGfloat x1, RPGfloat y1, RPGfloat x2, RPGfloat y2, RPGfloat width,
+                                    const RPGcolor *c1, const RPGcolor *c2)
+{
+    RPGfloat dx  = x2 - x1;
+    RPGfloat dy  = y2 - y1;
+    RPGfloat len = sqrtf(dx * dx + dy * dy);
+    if (len < __FLT_EPSILON__)
+    {
+        return;
+    }
+    RPGfloat nx = (-dy / len) * width * 0.5f;
+    RPGfloat ny = (dx / len) * width * 0.5f;
+    RPG_Primitives_PushQuad(p, x1 + nx, y1 + ny, x2 + nx, y2 + ny, x2 - nx, y2 - ny, x1 - nx, y1 - ny, c1, c2, c2, c1);
+}
+
+/**
+ * @brief Computes the number of segments used to approximate a circle of the given radius.
+ */
+static inline RPGint RPG_Primitives_Segments(RPGfloat radius)
+{
+    RPGint segments = (RPGint)(2.0f * RPG_PI * radius / RPG_PRIMITIVES_SEGMENT_LENGTH);
+    return RPG_CLAMPI(segments, RPG_PRIMITIVES_MIN_SEGMENTS, RPG_PRIMITIVES_MAX_SEGMENTS);
+}
+
+/**
+ * @brief Uploads the vertices to the vertex buffer, recreating it only when it is too small.
+ *
+ * @param p The primitive batch.
+ */
+static void RPG_Primitives_Upload(RPGprimitives *p)
+{
+    if (p->count > p->allocated)
+    {
+        glDeleteBuffers(1, &p->vbo);
+        p->allocated = p->capacity;
+        p->vbo       = RPG_Drawing_CreateBuffer(sizeof(RPGprimitivevertex) * p->allocated, NULL, RPG_TRUE);
+        glBindVertexArray(p->vao);
+        glBindBuffer(GL_ARRAY_BUFFER, p->vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(RPGprimitivevertex), (void *) offsetof(RPGprimitivevertex, x));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(RPGprimitivevertex), (void *) offsetof(RPGprimitivevertex, color));
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+    if (p->count > 0)
+    {
+        RPG_Drawing_BufferSubData(p->vbo, 0, sizeof(RPGprimitivevertex) * p->count, p->vertices);
+    }
+    p->dirty = RPG_FALSE;
+}
+
+/**
+ * @brief Activates the primitive program and sets its uniforms from the object.
+ *
+ * @param p The primitive batch.
+ */
+static void RPG_Primitives_Bind(RPGprimitives *p)
+{
+    RPGgame *game = RPG_GAME;
+    RPG_Drawing_UseProgram(game->primitives.program);
+    if (game->primitives.projectionVersion != _projectionVersion)
+    {
+        glUniformMatrix4fv(game->primitives.projection, 1, GL_FALSE, (GLfloat *) &_projection);
+        game->primitives.projectionVersion = _projectionVersion;
+    }
+    RPG_BASE_UNIFORMS_EX(game->primitives, p->base);
+}
+
+static void RPG_Primitives_Render(void *primitives)
+{
+    RPGprimitives *p = primitives;
+    if (!p->base.renderable.visible || p->base.alpha < __FLT_EPSILON__ || p->count == 0)
+    {
+        // No-op if nothing would be visible
+        return;
+    }
+    if (p->base.updated)
+    {
+        RPGint ox = 0, oy = 0;
+        if (p->viewport != NULL)
+        {
+            ox = p->viewport->base.ox;
+            oy = p->viewport->base.oy;
+        }
+        RPG_BasicSprite_UpdateModel(&p->base, p->base.x, p->base.y, 1.0f, 1.0f, ox, oy);
+        p->base.updated = RPG_FALSE;
+    }
+    if (p->dirty)
+    {
+        RPG_Primitives_Upload(p);
+    }
+    RPG_Primitives_Bind(p);
+    glBindVertexArray(p->vao);
+    glDrawArrays(GL_TRIANGLES, 0, p->count);
+}
+
+/****************************************************************************************
+ * Primitives
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Primitives_Create(RPGviewport *viewport, RPGprimitives **primitives)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RESULT result = RPG_Primitives_EnsureProgram(RPG_GAME);
+    if (result)
+    {
+        return result;
+    }
+
+    RPG_ALLOC_ZERO(p, RPGprimitives);
+    RPGbatch *batch = viewport ? &viewport->batch : &RPG_GAME->batch;
+    RPG_BasicSprite_Init(&p->base, RPG_Primitives_Render, batch);
+    p->viewport = viewport;
+    p->capacity = RPG_PRIMITIVES_INIT_CAPACITY;
+    p->vertices = RPG_ALLOC_N(RPGprimitivevertex, RPG_PRIMITIVES_INIT_CAPACITY);
+
+    // The buffer is created on the first upload, once the number of vertices is known
+    glGenVertexArrays(1, &p->vao);
+
+    *primitives = p;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_Free(RPGprimitives *primitives)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_BasicSprite_Detach(&primitives->base);
+    RPG_Renderable_Free(&primitives->base.renderable);
+    glDeleteVertexArrays(1, &primitives->vao);
+    glDeleteBuffers(1, &primitives->vbo);
+    RPG_FREE(primitives->vertices);
+    RPG_FREE(primitives);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_GetViewport(RPGprimitives *primitives, RPGviewport **viewport)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    if (viewport != NULL)
+    {
+        *viewport = primitives->viewport;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_GetCount(RPGprimitives *primitives, RPGint *count)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    if (count != NULL)
+    {
+        *count = primitives->count;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_Clear(RPGprimitives *primitives)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    primitives->count = 0;
+    primitives->dirty = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_DrawLine(RPGprimitives *primitives, RPGfloat x1, RPGfloat y1, RPGfloat x2, RPGfloat y2, RPGfloat width,
+                                   RPGcolor *color1, RPGcolor *color2)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(color1);
+    if (width <= 0.0f)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_Primitives_PushLine(primitives, x1, y1, x2, y2, width, color1, color2 ? color2 : color1);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_DrawRect(RPGprimitives *primitives, RPGrect *rect, RPGfloat width, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(rect);
+    RPG_RETURN_IF_NULL(color);
+    if (width <= 0.0f)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    // Four non-overlapping edges inside the rectangle, so translucent colors do not double up at the corners
+    RPGfloat l = rect->x, t = rect->y, r = rect->x + rect->w, b = rect->y + rect->h;
+    RPGfloat w = fminf(width, fminf(rect->w, rect->h) * 0.5f);
+    RPG_Primitives_PushQuad(primitives, l, t, r, t, r, t + w, l, t + w, color, color, color, color);
+    RPG_Primitives_PushQuad(primitives, l, b - w, r, b - w, r, b, l, b, color, color, color, color);
+    RPG_Primitives_PushQuad(primitives, l, t + w, l + w, t + w, l + w, b - w, l, b - w, color, color, color, color);
+    RPG_Primitives_PushQuad(primitives, r - w, t + w, r, t + w, r, b - w, r - w, b - w, color, color, color, color);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_FillRect(RPGprimitives *primitives, RPGrect *rect, RPGcolor *color)
+{
+    return RPG_Primitives_FillGradientRect(primitives, rect, color, color, RPG_FALSE);
+}
+
+RPG_RESULT RPG_Primitives_FillGradientRect(RPGprimitives *primitives, RPGrect *rect, RPGcolor *color1, RPGcolor *color2,
+                                           RPGbool vertical)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(rect);
+    RPG_RETURN_IF_NULL(color1);
+    RPG_RETURN_IF_NULL(color2);
+    RPGfloat l = rect->x, t = rect->y, r = rect->x + rect->w, b = rect->y + rect->h;
+    if (vertical)
+    {
+        RPG_Primitives_PushQuad(primitives, l, t, r, t, r, b, l, b, color1, color1, color2, color2);
+    }
+    else
+    {
+        RPG_Primitives_PushQuad(primitives, l, t, r, t, r, b, l, b, color1, color2, color2, color1);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_DrawCircle(RPGprimitives *primitives, RPGfloat x, RPGfloat y, RPGfloat radius, RPGfloat width, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(color);
+    if (radius <= 0.0f || width <= 0.0f)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    // A ring of quads between the inner and outer edge, centered on the radius
+    RPGint segments = RPG_Primitives_Segments(radius);
+    RPGfloat outer  = radius + width * 0.5f;
+    RPGfloat inner  = fmaxf(radius - width * 0.5f, 0.0f);
+    RPGfloat step   = 2.0f * RPG_PI / segments;
+    RPGfloat c0 = 1.0f, s0 = 0.0f, c1, s1;
+    for (RPGint i = 1; i <= segments; i++)
+    {
+        c1 = cosf(step * i);
+        s1 = sinf(step * i);
+        RPG_Primitives_PushQuad(primitives, x + c0 * outer, y + s0 * outer, x + c1 * outer, y + s1 * outer, x + c1 * inner, y + s1 * inner,
+                                x + c0 * inner, y + s0 * inner, color, color, color, color);
+        c0 = c1;
+        s0 = s1;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_FillCircle(RPGprimitives *primitives, RPGfloat x, RPGfloat y, RPGfloat radius, RPGcolor *inner, RPGcolor *outer)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(inner);
+    if (radius <= 0.0f)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (outer == NULL)
+    {
+        outer = inner;
+    }
+    RPGint segments       = RPG_Primitives_Segments(radius);
+    RPGfloat step         = 2.0f * RPG_PI / segments;
+    RPGprimitivevertex *v = RPG_Primitives_Reserve(primitives, segments * 3);
+    for (RPGint i = 0; i < segments; i++, v += 3)
+    {
+        RPG_Primitives_SetVertex(&v[0], x, y, inner);
+        RPG_Primitives_SetVertex(&v[1], x + cosf(step * i) * radius, y + sinf(step * i) * radius, outer);
+        RPG_Primitives_SetVertex(&v[2], x + cosf(step * (i + 1)) * radius, y + sinf(step * (i + 1)) * radius, outer);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_DrawPolygon(RPGprimitives *primitives, RPGvec2 *points, RPGint count, RPGfloat width, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(points);
+    RPG_RETURN_IF_NULL(color);
+    if (count < 2 || width <= 0.0f)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    // The outline is closed, joining the last point back to the first
+    for (RPGint i = 0; i < count; i++)
+    {
+        RPGvec2 *a = &points[i], *b = &points[(i + 1) % count];
+        RPG_Primitives_PushLine(primitives, a->x, a->y, b->x, b->y, width, color, color);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_FillPolygon(RPGprimitives *primitives, RPGvec2 *points, RPGint count, RPGcolor *color)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(points);
+    RPG_RETURN_IF_NULL(color);
+    if (count < 3)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    // Triangulated as a fan from the first point, so the polygon must be convex
+    RPGprimitivevertex *v = RPG_Primitives_Reserve(primitives, (count - 2) * 3);
+    for (RPGint i = 1; i < count - 1; i++, v += 3)
+    {
+        RPG_Primitives_SetVertex(&v[0], points[0].x, points[0].y, color);
+        RPG_Primitives_SetVertex(&v[1], points[i].x, points[i].y, color);
+        RPG_Primitives_SetVertex(&v[2], points[i + 1].x, points[i + 1].y, color);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_FillTriangles(RPGprimitives *primitives, RPGvec2 *points, RPGcolor *colors, RPGint count)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(points);
+    RPG_RETURN_IF_NULL(colors);
+    if (count < 3 || count % 3 != 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGprimitivevertex *v = RPG_Primitives_Reserve(primitives, count);
+    for (RPGint i = 0; i < count; i++)
+    {
+        RPG_Primitives_SetVertex(&v[i], points[i].x, points[i].y, &colors[i]);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Primitives_RenderToImage(RPGprimitives *primitives, RPGimage *image)
+{
+    RPG_RETURN_IF_NULL(primitives);
+    RPG_RETURN_IF_NULL(image);
+    if (primitives->count == 0)
+    {
+        return RPG_NO_ERROR;
+    }
+    if (primitives->dirty)
+    {
+        RPG_Primitives_Upload(primitives);
+    }
+
+    // Locations are in pixels of the image, the object's own transform is not applied
+    RPG_ENSURE_FBO(image);
+    RPGmat4 m;
+    RPG_MAT4_ORTHO(m, 0.0f, image->width, image->height, 0.0f, -1.0f, 1.0f);
+    RPG_Drawing_SetProjection(&m);
+    RPG_VIEWPORT(0, 0, image->width, image->height);
+
+    RPG_Primitives_Bind(primitives);
+    RPG_MAT4_SET(m, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+    glUniformMatrix4fv(RPG_GAME->primitives.model, 1, GL_FALSE, (GLfloat *) &m);
+    glBindVertexArray(primitives->vao);
+    glDrawArrays(GL_TRIANGLES, 0, primitives->count);
+    glBindVertexArray(0);
+    RPG_UNBIND_FBO(image);
+    return RPG_NO_ERROR;
+}
@@ -3,10 +3,12 @@
 void RPG_Renderable_Init(RPGrenderable *renderable, RPGrenderfunc renderfunc, RPGbatch *batch)
 {
     RPG_ASSERT(renderfunc);
-    renderable->z       = 0;
-    renderable->visible = RPG_TRUE;
-    renderable->render  = renderfunc;
-    renderable->parent  = batch;
+    renderable->z        = 0;
+    renderable->visible  = RPG_TRUE;
+    renderable->render   = renderfunc;
+    renderable->parent   = batch;
+    renderable->material = NULL;
+    renderable->pick     = RPG_PICK_NONE;
     RPG_Batch_Add(batch, renderable);
 }
 
@@ -17,6 +19,11 @@ RPG_RESULT RPG_Renderable_Free(RPGrenderable *renderable)
     {
         RPG_Batch_DeleteItem(renderable->parent, renderable);
     }
+    if (renderable->material != NULL)
+    {
+        RPG_Batch_DeleteItem(&renderable->material->users, renderable);
+    }
+    RPG_Pick_Invalidate();
     return RPG_NO_ERROR;
 }
 
@@ -58,6 +65,39 @@ RPG_RESULT RPG_Renderable_SetZ(RPGrenderable *renderable, RPGint z)
     return RPG_NO_ERROR;
 }
 
+RPG_RESULT RPG_Renderable_GetMaterial(RPGrenderable *renderable, RPGmaterial **material)
+{
+    RPG_RETURN_IF_NULL(renderable);
+    if (material != NULL)
+    {
+        *material = renderable->material;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Renderable_SetMaterial(RPGrenderable *renderable, RPGmaterial *material)
+{
+    RPG_RETURN_IF_NULL(renderable);
+    if (material != renderable->material)
+    {
+        // Materials track their users, so that freeing one never leaves an object referencing it
+        if (renderable->material != NULL)
+        {
+            RPG_Batch_DeleteItem(&renderable->material->users, renderable);
+        }
+        if (material != NULL)
+        {
+            RPG_Batch_Add(&material->users, renderable);
+        }
+        renderable->material = material;
+        if (renderable->parent != NULL)
+        {
+            renderable->parent->updated = RPG_TRUE;
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
 RPG_RESULT RPG_Renderable_SetRenderFunc(RPGrenderable *renderable, RPGrenderfunc func)
 {
     RPG_RETURN_IF_NULL(renderable);
@@ -0,0 +1,350 @@
+#include "internal.h"
+
+/**
+ * @brief Tests whether any screen effect would alter the rendered output.
+ *
+ * @param game The game instance.
+ * @return RPGbool RPG_TRUE if the composite pass is required, otherwise RPG_FALSE.
+ */
+static inline RPGbool RPG_Screen_IsActive(RPGgame *game)
+{
+    RPGtone *t = &game->screen.tone;
+    if (t->x != 0.0f || t->y != 0.0f || t->z != 0.0f || t->w != 0.0f)
+    {
+        return RPG_TRUE;
+    }
+    return game->screen.flash.w > 0.0f || game->screen.shake.offset != 0.0f || game->screen.brightness != 1.0f ||
+           (game->screen.lut.texture != 0 && game->screen.lut.amount > 0.0f);
+}
+
+/**
+ * @brief Compiles the composite program and caches its uniform locations.
+ *
+ * @param game The game instance.
+ * @return RPG_RESULT The result of the operation.
+ */
+static RPG_RESULT RPG_Screen_CreateProgram(RPGgame *game)
+{
+    RPGshader *shader;
+    RPG_RESULT result = RPG_Shader_Create(RPG_SCREEN_VERTEX, RPG_SCREEN_FRAGMENT, NULL, &shader);
+    if (result)
+    {
+        return result;
+    }
+
+    // Only need the shader name for storing within the game structure
+    game->screen.shader.program = shader->program;
+    RPG_FREE(shader);
+
+    GLuint program = game->screen.shader.program;
+    RPG_Drawing_UseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "image"), 0);
+    glUniform1i(glGetUniformLocation(program, "lut"), 1);
+    game->screen.shader.offset     = glGetUniformLocation(program, "offset");
+    game->screen.shader.tone       = glGetUniformLocation(program, UNIFORM_TONE);
+    game->screen.shader.flash      = glGetUniformLocation(program, UNIFORM_FLASH);
+    game->screen.shader.brightness = glGetUniformLocation(program, "brightness");
+    game->screen.shader.grading    = glGetUniformLocation(program, "grading");
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Ensures the offscreen target exists and matches the size of the internal resolution.
+ *
+ * @param game The game instance.
+ */
+static void RPG_Screen_EnsureTarget(RPGgame *game)
+{
+    if (game->screen.fbo != 0 && game->screen.width == game->resolution.width && game->screen.height == game->resolution.height)
+    {
+        return;
+    }
+    if (game->screen.fbo != 0)
+    {
+        glDeleteFramebuffers(1, &game->screen.fbo);
+        RPG_Drawing_DeleteTexture(game->screen.texture);
+    }
+    game->screen.width   = game->resolution.width;
+    game->screen.height  = game->resolution.height;
+    game->screen.texture = RPG_Drawing_CreateTexture(game->screen.width, game->screen.height, GL_RGBA8, GL_RGBA, NULL, GL_CLAMP_TO_EDGE,
+                                                     GL_LINEAR);
+    game->screen.fbo     = RPG_Drawing_CreateFramebuffer(game->screen.texture);
+}
+
+void RPG_Screen_Update(RPGgame *game)
+{
+    // Tone
+    if (game->screen.toneDuration > 0)
+    {
+        RPGint d        = game->screen.toneDuration;
+        RPGtone *t      = &game->screen.tone;
+        RPGtone *target = &game->screen.toneTarget;
+        t->x            = (t->x * (d - 1) + target->x) / d;
+        t->y            = (t->y * (d - 1) + target->y) / d;
+        t->z            = (t->z * (d - 1) + target->z) / d;
+        t->w            = (t->w * (d - 1) + target->w) / d;
+        game->screen.toneDuration--;
+    }
+
+    // Flash
+    if (game->screen.flashDuration > 0)
+    {
+        RPGint d             = game->screen.flashDuration;
+        game->screen.flash.w = game->screen.flash.w * (d - 1) / d;
+        game->screen.flashDuration--;
+    }
+
+    // Shake
+    if (game->screen.shake.duration > 0 || game->screen.shake.offset != 0.0f)
+    {
+        RPGfloat power   = game->screen.shake.power;
+        RPGfloat delta   = (power * game->screen.shake.speed * game->screen.shake.direction) / 10.0f;
+        RPGfloat *offset = &game->screen.shake.offset;
+        if (game->screen.shake.duration <= 1 && *offset * (*offset + delta) < 0.0f)
+        {
+            *offset = 0.0f;
+        }
+        else
+        {
+            *offset += delta;
+        }
+        if (*offset > power * 2.0f)
+        {
+            game->screen.shake.direction = -1;
+        }
+        else if (*offset < -power * 2.0f)
+        {
+            game->screen.shake.direction = 1;
+        }
+        if (game->screen.shake.duration > 0)
+        {
+            game->screen.shake.duration--;
+        }
+    }
+}
+
+RPGbool RPG_Screen_Begin(RPGgame *game)
+{
+    if (!RPG_Screen_IsActive(game) && !RPG_PostFX_IsActive(&game->postfx.chain))
+    {
+        return RPG_FALSE;
+    }
+    if (game->screen.shader.program == 0 && RPG_Screen_CreateProgram(game) != RPG_NO_ERROR)
+    {
+        // Effects are cosmetic, fail gracefully by rendering directly to the window
+        return RPG_FALSE;
+    }
+    RPG_Screen_EnsureTarget(game);
+
+    // Redirect all rendering to the offscreen target at the internal resolution
+    game->target.fbo = game->screen.fbo;
+    game->target.x   = 0;
+    game->target.y   = 0;
+    game->target.w   = game->screen.width;
+    game->target.h   = game->screen.height;
+    RPG_BIND_TARGET();
+    RPG_RESET_VIEWPORT();
+    return RPG_TRUE;
+}
+
+void RPG_Screen_Finish(RPGgame *game)
+{
+    // Run the post-processing chain over the offscreen image before compositing it
+    RPGrendertarget *post = RPG_PostFX_Apply(&game->postfx.chain, game->screen.texture, game->screen.width, game->screen.height);
+
+    // Restore the window as the render target
+    game->target.fbo = 0;
+    game->target.x   = game->bounds.x;
+    game->target.y   = game->bounds.y;
+    game->target.w   = game->bounds.w;
+    game->target.h   = game->bounds.h;
+    RPG_BIND_TARGET();
+    RPG_RESET_VIEWPORT();
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Apply every effect in a single pass
+    RPG_Drawing_UseProgram(game->screen.shader.program);
+    glUniform2f(game->screen.shader.offset, (2.0f * game->screen.shake.offset) / game->resolution.width, 0.0f);
+    glUniform4fv(game->screen.shader.tone, 1, (GLfloat *) &game->screen.tone);
+    glUniform4fv(game->screen.shader.flash, 1, (GLfloat *) &game->screen.flash);
+    glUniform1f(game->screen.shader.brightness, game->screen.brightness);
+    if (game->screen.lut.texture != 0)
+    {
+        // Scale and bias the color so that lookups sample the centers of the first and last texels
+        RPGfloat size = (RPGfloat) game->screen.lut.size;
+        glUniform3f(game->screen.shader.grading, game->screen.lut.amount, (size - 1.0f) / size, 0.5f / size);
+        if (_unit != GL_TEXTURE1)
+        {
+            glActiveTexture(GL_TEXTURE1);
+            _unit = GL_TEXTURE1;
+        }
+        glBindTexture(GL_TEXTURE_3D, game->screen.lut.texture);
+    }
+    else
+    {
+        glUniform3f(game->screen.shader.grading, 0.0f, 1.0f, 0.0f);
+    }
+
+    // The output is opaque, blending would only waste fill-rate
+    glDisable(GL_BLEND);
+    RPG_RENDER_TEXTURE(post ? post->texture : game->screen.texture, game->quad.vao);
+    glEnable(GL_BLEND);
+    RPG_PostFX_Release(post);
+}
+
+void RPG_Screen_Free(RPGgame *game)
+{
+    if (game->screen.fbo != 0)
+    {
+        glDeleteFramebuffers(1, &game->screen.fbo);
+        RPG_Drawing_DeleteTexture(game->screen.texture);
+        game->screen.fbo = 0;
+    }
+    if (game->screen.lut.texture != 0)
+    {
+        glDeleteTextures(1, &game->screen.lut.texture);
+        game->screen.lut.texture = 0;
+    }
+    if (game->screen.shader.program != 0)
+    {
+        glDeleteProgram(game->screen.shader.program);
+        game->screen.shader.program = 0;
+    }
+}
+
+RPG_RESULT RPG_Game_GetTone(RPGgame *game, RPGtone *tone)
+{
+    RPG_RETURN_IF_NULL(game);
+    if (tone != NULL)
+    {
+        *tone = game->screen.tone;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_SetTone(RPGgame *game, RPGtone *tone, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(game);
+    if (tone == NULL)
+    {
+        memset(&game->screen.toneTarget, 0, sizeof(RPGtone));
+    }
+    else
+    {
+        game->screen.toneTarget   = *tone;
+        game->screen.toneTarget.x = RPG_CLAMPF(tone->x, -1.0f, 1.0f);
+        game->screen.toneTarget.y = RPG_CLAMPF(tone->y, -1.0f, 1.0f);
+        game->screen.toneTarget.z = RPG_CLAMPF(tone->z, -1.0f, 1.0f);
+        game->screen.toneTarget.w = RPG_CLAMPF(tone->w, 0.0f, 1.0f);
+    }
+    if (duration < 1)
+    {
+        game->screen.tone         = game->screen.toneTarget;
+        game->screen.toneDuration = 0;
+    }
+    else
+    {
+        game->screen.toneDuration = duration;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_Flash(RPGgame *game, RPGcolor *color, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(game);
+    if (color == NULL || duration < 1)
+    {
+        memset(&game->screen.flash, 0, sizeof(RPGcolor));
+        game->screen.flashDuration = 0;
+    }
+    else
+    {
+        game->screen.flash         = *color;
+        game->screen.flashDuration = duration;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_Shake(RPGgame *game, RPGfloat power, RPGfloat speed, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(game);
+    game->screen.shake.power     = fmaxf(power, 0.0f);
+    game->screen.shake.speed     = fmaxf(speed, 0.0f);
+    game->screen.shake.duration  = imax(duration, 0);
+    game->screen.shake.direction = 1;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_GetBrightness(RPGgame *game, RPGfloat *brightness)
+{
+    RPG_RETURN_IF_NULL(game);
+    if (brightness != NULL)
+    {
+        *brightness = game->screen.brightness;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_SetBrightness(RPGgame *game, RPGfloat brightness)
+{
+    RPG_RETURN_IF_NULL(game);
+    game->screen.brightness = fmaxf(brightness, 0.0f);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Game_SetColorLookup(RPGgame *game, RPGimage *image, RPGfloat amount)
+{
+    RPG_RETURN_IF_NULL(game);
+    if (game->screen.lut.texture != 0)
+    {
+        glDeleteTextures(1, &game->screen.lut.texture);
+        game->screen.lut.texture = 0;
+    }
+    game->screen.lut.amount = RPG_CLAMPF(amount, 0.0f, 1.0f);
+    if (image == NULL)
+    {
+        return RPG_NO_ERROR;
+    }
+
+    // The image is expected to be a horizontal strip of square slices, one per blue value
+    RPGint size = image->height;
+    if (size < 2 || image->width != size * size)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    RPGsize length   = (RPGsize) image->width * image->height * 4;
+    RPGubyte *strip  = RPG_MALLOC(length);
+    RPGubyte *voxels = RPG_MALLOC(length);
+    RPG_Image_GetPixels(image, strip, length);
+
+    // Rearrange the slices into a contiguous volume where red is the x-axis, green the y-axis, and blue the z-axis
+    RPGsize row = (RPGsize) size * 4;
+    for (RPGint b = 0; b < size; b++)
+    {
+        for (RPGint g = 0; g < size; g++)
+        {
+            memcpy(&voxels[((RPGsize) b * size + g) * row], &strip[((RPGsize) g * image->width + b * size) * 4], row);
+        }
+    }
+
+    GLuint texture;
+    glGenTextures(1, &texture);
+    if (_unit != GL_TEXTURE1)
+    {
+        glActiveTexture(GL_TEXTURE1);
+        _unit = GL_TEXTURE1;
+    }
+    glBindTexture(GL_TEXTURE_3D, texture);
+    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGBA8, size, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, voxels);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    RPG_FREE(strip);
+    RPG_FREE(voxels);
+    game->screen.lut.texture = texture;
+    game->screen.lut.size    = size;
+    return RPG_NO_ERROR;
+}
@@ -151,6 +151,7 @@ RPG_RESULT RPG_Shader_Create(const char *vertSrc, const char *fragSrc, const cha
     RPGshader *s = RPG_ALLOC(RPGshader);
     s->program   = program;
     s->user      = NULL;
+    s->material  = NULL;
     *shader      = s;
     return RPG_NO_ERROR;
 }
@@ -175,6 +176,11 @@ RPG_RESULT RPG_Shader_Free(RPGshader *shader)
 {
     if (shader != NULL)
     {
+        if (_program == shader->program)
+        {
+            // Names are recycled by the driver, do not let the cache believe a new program is already in use
+            _program = 0;
+        }
         glDeleteProgram(shader->program);
         RPG_FREE(shader);
     }
@@ -184,13 +190,13 @@ RPG_RESULT RPG_Shader_Free(RPGshader *shader)
 RPG_RESULT RPG_Shader_Begin(RPGshader *shader)
 {
     RPG_RETURN_IF_NULL(shader);
-    glUseProgram(shader->program);
+    RPG_Drawing_UseProgram(shader->program);
     return RPG_NO_ERROR;
 }
 
 RPG_RESULT RPG_Shader_Finish(RPGshader *shader)
 {
-    glUseProgram(RPG_GAME->shader.program);
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
     return RPG_NO_ERROR;
 }
 
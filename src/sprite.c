@@ -10,32 +10,40 @@ static void RPG_Sprite_Render(void *sprite)
     }
     if (s->base.updated)
     {
-        GLint x = s->base.x + s->base.ox;
-        GLint y = s->base.y + s->base.oy;
+        RPGint ox = 0, oy = 0;
         if (s->viewport != NULL)
         {
-            x += s->viewport->base.ox;
-            y += s->viewport->base.oy;
+            ox = s->viewport->base.ox;
+            oy = s->viewport->base.oy;
         }
-        GLfloat sx  = s->base.scale.x * s->rect.w;
-        GLfloat sy  = s->base.scale.y * s->rect.h;
-        GLfloat cos = cosf(s->base.rotation.radians);
-        GLfloat sin = sinf(s->base.rotation.radians);
-        RPG_MAT4_SET(s->base.model, sx * cos, sx * sin, 0.0f, 0.0f, sy * -sin, sy * cos, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
-                     (s->base.rotation.ox * (1.0f - cos) + s->base.rotation.oy * sin) + x,
-                     (s->base.rotation.oy * (1.0f - cos) - s->base.rotation.ox * sin) + y, 0.0f, 1.0f);
+        RPG_BasicSprite_UpdateModel(&s->base, s->base.x + s->base.ox, s->base.y + s->base.oy, s->rect.w, s->rect.h, ox, oy);
         s->base.updated = RPG_FALSE;
     }
-    RPG_BASE_UNIFORMS(s->base);
-    RPG_RENDER_TEXTURE(s->image->texture, s->vao);
+    RPG_BasicSprite_BindUniforms(&s->base);
+    RPG_BasicSprite_RenderTexture(&s->base, s->image->texture);
+}
+
+void RPG_Sprite_SetSource(RPGsprite *sprite, RPGrect *rect)
+{
+    // The model matrix only depends on the size of the source rectangle
+    if (sprite->rect.w != rect->w || sprite->rect.h != rect->h)
+    {
+        sprite->base.updated = RPG_TRUE;
+    }
+    sprite->rect = *rect;
+
+    // Selecting the region is only a change of uniform, the shared vertex buffer is never modified
+    GLfloat w           = (GLfloat) sprite->image->width;
+    GLfloat h           = (GLfloat) sprite->image->height;
+    sprite->base.source = (RPGvec4){rect->x / w, rect->y / h, rect->w / w, rect->h / h};
 }
 
 RPG_RESULT RPG_Sprite_Free(RPGsprite *sprite)
 {
     RPG_RETURN_IF_NULL(sprite);
+    RPG_Animation_Detach(sprite);
+    RPG_BasicSprite_Detach(&sprite->base);
     RPG_Renderable_Free(&sprite->base.renderable);
-    glDeleteVertexArrays(1, &sprite->vao);
-    glDeleteBuffers(1, &sprite->vbo);
     RPG_FREE(sprite);
     return RPG_NO_ERROR;
 }
@@ -45,17 +53,7 @@ RPG_RESULT RPG_Sprite_Create(RPGviewport *viewport, RPGsprite **sprite)
     RPG_ALLOC_ZERO(s, RPGsprite);
     RPGbatch *batch = viewport ? &viewport->batch : &RPG_GAME->batch;
     RPG_BasicSprite_Init(&s->base, RPG_Sprite_Render, batch);
-
-    // Generate VAO/VBO
-    glGenVertexArrays(1, &s->vao);
-    glBindVertexArray(s->vao);
-    glGenBuffers(1, &s->vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, s->vbo);
-    glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, VERTICES_STRIDE, NULL);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    s->base.renderable.pick = RPG_PICK_SPRITE;
 
     *sprite = s;
     return RPG_NO_ERROR;
@@ -85,6 +83,7 @@ RPG_RESULT RPG_Sprite_SetImage(RPGsprite *sprite, RPGimage *image)
 {
     RPG_RETURN_IF_NULL(sprite);
     sprite->image = image;
+    RPG_Pick_Invalidate();
     if (image)
     {
         RPG_Sprite_SetSourceBounds(sprite, 0, 0, image->width, image->height);
@@ -136,23 +135,8 @@ RPG_RESULT RPG_Sprite_SetSourceBounds(RPGsprite *sprite, RPGint x, RPGint y, RPG
         return RPG_NO_ERROR;
     }
 
-    sprite->rect.x = x;
-    sprite->rect.y = y;
-    sprite->rect.w = w;
-    sprite->rect.h = h;
-
-    GLfloat l = (GLfloat) x / sprite->image->width;
-    GLfloat t = (GLfloat) y / sprite->image->height;
-    GLfloat r = l + ((GLfloat) w / sprite->image->width);
-    GLfloat b = t + ((GLfloat) h / sprite->image->height);
-
-    glBindBuffer(GL_ARRAY_BUFFER, sprite->vbo);
-    GLfloat vertices[VERTICES_COUNT] = {0.0f, 1.0f, l, b, 1.0f, 0.0f, r, t, 0.0f, 0.0f, l, t,
-                                        0.0f, 1.0f, l, b, 1.0f, 1.0f, r, b, 1.0f, 0.0f, r, t};
-    glBufferSubData(GL_ARRAY_BUFFER, 0, VERTICES_SIZE, vertices);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-    sprite->base.updated = RPG_TRUE;
+    RPGrect rect = {x, y, w, h};
+    RPG_Sprite_SetSource(sprite, &rect);
     return RPG_NO_ERROR;
 }
 
@@ -1,32 +1,145 @@
 
 #include "internal.h"
+#include "stb_image.h"
 #include "tmx/tmx.h"
+#include "uthash.h"
+#include <libxml/parser.h>
 #include <stdio.h>
+#include <threads.h>
 
 #define RPG_LAYER_OFFSET 32
 
+// The width and height of a chunk in tiles, the smallest region of a tile layer that is culled as a whole
+#define RPG_TILEMAP_CHUNK_SIZE 32
+
+// The number of tilesets that can be referenced by the tiles of a map, the last slot is reserved for drawing image layers
+#define RPG_TILEMAP_MAX_TILESETS 16
+
+// The preferred width of the atlas tilesets are packed into, wider tilesets widen the atlas to fit
+#define RPG_TILEMAP_ATLAS_WIDTH 2048
+
+// The flags of a cell in an index texture that has no tile, which no tile can have as there are too few tilesets
+#define RPG_TILEMAP_EMPTY 0xFFFF
+
+// The default limit of texture memory, in bytes, that each run of baked layers may keep resident
+#define RPG_TILEMAP_BAKE_BUDGET (64 * 1024 * 1024)
+
+// The default distance beyond the view that the chunks of infinite maps are streamed in, in pixels
+#define RPG_TILEMAP_STREAM_RADIUS 256
+
+// The most decoded chunks of infinite maps uploaded each frame, spreading the cost of a burst of chunks across frames
+#define RPG_TILEMAP_STREAM_UPLOADS 4
+
+// The flags of a chunk of a tile layer, marking it as edited since it was last uploaded, and as having an instance for every cell
+#define RPG_TILEMAP_CHUNK_DIRTY 0x1
+#define RPG_TILEMAP_CHUNK_OPEN 0x2
+
+// The widest border of repeated edge pixels that can be extruded around each tile when its tileset is packed
+#define RPG_TILEMAP_MAX_EXTRUSION 2
+
 /****************************************************************************************
  * Type Definitions
  ****************************************************************************************/
 
 typedef struct
 {
-    tmx_tile *tmx; /** The TMX format tile structure. */
-    struct
-    {
-        RPGubyte index;  /** The current animation frame index. */
-        RPGdouble delta; /** The target time when the next animation will occur. */
-    } anime;             /** Structure containing animation timing. */
+    tmx_tile *tmx;   /** The TMX format tile structure. */
+    RPGint instance; /** The index of the tile's instance within the layer's VBO, or -1 when empty. */
 } RPGtile;
 
+/**
+ * @brief A chunk of a run of baked layers, pre-rendered to a texture.
+ */
+typedef struct
+{
+    GLuint texture; /** The texture the chunk is baked to, or 0 when it is not resident. */
+    GLuint fbo;     /** The framebuffer used to render to the texture. */
+    RPGuint64 used; /** The frame of the run the chunk was last drawn. */
+} RPGbakedchunk;
+
+/**
+ * @brief The chunk textures of a run of consecutive baked tile layers, owned by the first layer of the run.
+ */
+typedef struct
+{
+    RPGbakedchunk *chunks; /** One entry for each chunk of the map, in row-major order. */
+    RPGint count;          /** The number of chunks. */
+    GLuint vao;
+    GLuint vbo;            /** One instance for each chunk, covering it with the tileset slot reserved for images. */
+    RPGuint64 frame;       /** The number of times the run has been drawn. */
+    RPGsize resident;      /** The texture memory used by resident chunks, in bytes. */
+    RPGint last;           /** The index of the last layer baked into the resident chunks. */
+} RPGtilebake;
+
+/**
+ * @brief The per-instance data of a tile, from which the shader derives its placement and texture coordinates.
+ */
+typedef struct
+{
+    GLushort x;     /** The column of the tile within the map. */
+    GLushort y;     /** The row of the tile within the map. */
+    GLushort tile;  /** The index of the tile within its tileset. */
+    GLushort flags; /** The TMX flip flags in the lowest three bits, and the index of the tileset in the remaining bits. */
+} RPGtileinstance;
+
+// The states of a chunk of an infinite map, only changed while holding the stream's mutex
+typedef enum
+{
+    RPG_STREAM_IDLE,     /** Not resident, and not requested. */
+    RPG_STREAM_QUEUED,   /** Waiting for the worker to decode it. */
+    RPG_STREAM_DECODING, /** Being decoded by the worker. */
+    RPG_STREAM_DECODED,  /** Decoded, waiting to be uploaded. */
+    RPG_STREAM_RESIDENT  /** Uploaded and ready to be drawn. */
+} RPG_STREAM_STATE;
+
+/**
+ * @brief A chunk of a tile layer of an infinite map, streamed in while it is near the view.
+ */
+typedef struct RPGstreamchunk
+{
+    tmx_chunk *tmx;                /** The chunk, with its tiles still encoded. */
+    struct RPGstreamlayer *layer;  /** The layer the chunk belongs to. */
+    RPGint64 key;                  /** The column and row of the chunk within the chunk grid of the layer. */
+    RPG_STREAM_STATE state;        /** The streaming state of the chunk. */
+    RPGbool wanted;                /** Flag indicating the chunk is within the streaming radius of the view. */
+    RPGint slot;                   /** The index of the chunk within the active chunks of the layer, or -1 when idle. */
+    RPGtileinstance *instances;    /** The decoded instances, passed from the worker to be uploaded. */
+    RPGint count;                  /** The number of instances. */
+    GLuint vao;
+    GLuint vbo;
+    UT_hash_handle hh;
+} RPGstreamchunk;
+
+/**
+ * @brief The chunks of a tile layer of an infinite map.
+ */
+typedef struct RPGstreamlayer
+{
+    RPGstreamchunk *chunks;  /** Every chunk of the layer. */
+    RPGstreamchunk *lookup;  /** Hash of the chunks, keyed by their position within the chunk grid. */
+    RPGint chunkW;           /** The width of a chunk, in tiles. */
+    RPGint chunkH;           /** The height of a chunk, in tiles. */
+    RPGstreamchunk **active; /** The chunks that are not idle. */
+    RPGint activeCount;
+} RPGstreamlayer;
+
 // Tile Layer
 typedef struct
 {
     GLuint vao;
     GLuint vbo;
-    RPGimage *image;
     RPGuint tileCount;
     RPGtile *tiles;
+    RPGint instanceCount; /** The number of non-empty tiles, each one instance in the VBO. */
+    RPGint chunksX;       /** The number of chunks on the x-axis. */
+    RPGint chunksY;       /** The number of chunks on the y-axis. */
+    RPGint *chunks;       /** The first instance of each chunk in row-major order, followed by the total instance count. */
+    RPG_TILEMAP_MODE mode; /** How the layer is drawn. */
+    GLuint indices;        /** Texture with the tile of each cell, created when the layer is first set to be drawn indexed. */
+    RPGbool baked;         /** Flag indicating the layer is static, and drawn from chunk textures shared with adjacent baked layers. */
+    RPGtilebake *bake;     /** The chunk textures of the run of baked layers this layer begins, or NULL. */
+    RPGstreamlayer *stream; /** The streamed chunks of a layer of an infinite map, or NULL. */
+    RPGubyte *edits;        /** The edit flags of each chunk, or NULL until a tile of the layer is first changed. */
 } RPGtilelayer;
 
 // Image Layer
@@ -61,8 +174,34 @@ typedef struct
     } layer;
     tmx_layer *tmx;
     RPGtilemap *parent;
+    RPGint index; /** The index of the layer within the tilemap. */
 } RPGlayer;
 
+/**
+ * @brief The locations of the uniforms and attributes of a tilemap program, where -1 indicates one the program does not use.
+ */
+typedef struct
+{
+    GLuint program;
+    GLint color;
+    GLint tone;
+    GLint flash;
+    GLint alpha;
+    GLint projection;
+    GLint hue;
+    GLint origin;
+    GLint offset;
+    GLint cellSize;
+    GLint tilesets;
+    GLint layouts;
+    GLint imageSize;
+    GLint animated;
+    GLint time;
+    GLint viewSize; /** The size of the view covered by the quad of the indexed program. */
+    GLint position; /** The location of the grid position attribute of the instanced program. */
+    GLint tile;     /** The location of the tile index and flip flags attribute of the instanced program. */
+} RPGtileshader;
+
 typedef struct RPGtilemap
 {
     RPGbasic base;
@@ -70,59 +209,82 @@ typedef struct RPGtilemap
     tmx_map *map;
     RPGfloat pxWidth;
     RPGfloat pxHeight;
+    RPGimage *atlas;     /** Every tileset of the map, packed into a single image. */
+    RPGint tilesetCount; /** The number of tilesets packed into the atlas. */
+    RPGbyte *slots;      /** The index of the tileset of each tile within the atlas by global ID, or -1 for tiles that are not drawn. */
+    tmx_tileset *tilesets[RPG_TILEMAP_MAX_TILESETS - 1]; /** The tilesets packed into the atlas, in the order they are packed. */
+    RPGint extrusion;    /** The width of the border of edge pixels extruded around each tile in the atlas. */
+    RPGbool edited;      /** Flag indicating tiles have changed since the last frame, and are uploaded before it is drawn. */
+    GLuint frames;       /** Buffer texture with the animation frames of every tileset, or 0 when there are no animations. */
+    GLuint frameBuffer;  /** The buffer storing the frame table. */
+    RPGvec4 regions[RPG_TILEMAP_MAX_TILESETS];    /** The location of each tileset within the atlas, and the size of its tiles. */
+    GLint layouts[RPG_TILEMAP_MAX_TILESETS][4];   /** The columns, margin, spacing and first frame table entry of each tileset. */
+    RPGtileshader shader;                         /** The program drawing instanced tile layers and image layers. */
+    RPGtileshader indexed;                        /** The program drawing indexed tile layers, or 0 until one is first used. */
+    RPGsize bakeBudget;                           /** The texture memory each run of baked layers may keep resident, in bytes. */
     struct
     {
-        GLuint program;
-        GLint color;
-        GLint tone;
-        GLint flash;
-        GLint alpha;
-        GLint projection;
-        GLint hue;
-        GLint origin;
-    } shader;
+        thrd_t thread;
+        mtx_t mutex;
+        cnd_t signal;
+        RPGbool running;          /** Flag indicating the worker should continue, cleared to stop it. */
+        RPGstreamchunk **queue;   /** Chunks requested for decoding, taken most recent first. */
+        RPGint queueCount;
+        RPGint queueCapacity;
+        RPGstreamchunk **decoded; /** Chunks decoded by the worker, waiting to be uploaded in the order they were decoded. */
+        RPGint decodedCount;
+        RPGint decodedCapacity;
+        RPGint radius;            /** The distance beyond the view chunks are streamed in, in pixels. */
+    } stream;                     /** The worker decoding the chunks of an infinite map. */
     void *user;
 } RPGtilemap;
 
-typedef struct
-{
-    RPGvec2 vertices[6];
-    RPGmat4 model;
-} RPGvertexdata;
-
 /****************************************************************************************
  * Helper Functions
  ****************************************************************************************/
 
 /**
- * @brief Configures the vertex attributes for the currently bound VBO.
+ * @brief Configures the vertex attributes for a VBO, starting at the specified instance.
  *
- * @param program The tilemap's shader program.
+ * @param tilemap The tilemap that owns the buffer.
  * @param vao The vertex array object to configure.
+ * @param vbo The vertex buffer object containing the instance data.
+ * @param first The index of the instance the attributes will begin reading from.
  */
-static void RPG_Tilemap_SetupVAO(GLuint program, GLuint vao)
+static void RPG_Tilemap_SetupVAO(RPGtilemap *tilemap, GLuint vao, GLuint vbo, RPGint first)
 {
-    // Get the locations for the vertex and model attributes in the vertex shader
-    GLint vLoc = glGetAttribLocation(program, "vertex");
-    GLint mLoc = glGetAttribLocation(program, "model");
+    // OpenGL 3.3 has no base instance for instanced draws, so a range is selected by offsetting the attribute pointers
+    GLintptr offset = sizeof(RPGtileinstance) * (GLintptr) first;
 
     glBindVertexArray(vao);
-    for (int i = 0; i < 6; i++)
-    {
-        glEnableVertexAttribArray(vLoc + i);
-        glVertexAttribPointer(vLoc + i, 4, GL_FLOAT, GL_TRUE, 0, (void *) (sizeof(RPGvec2) * i));
-        glVertexAttribDivisor(vLoc + i, 1);
-    }
-
-    // Set four vec4 attribute locations to store as a 4x4 matrix
-    for (int i = 0; i < 4; i++)
-    {
-        glEnableVertexAttribArray(mLoc + i);
-        glVertexAttribPointer(mLoc + i, 4, GL_FLOAT, GL_TRUE, 0, (void *) ((sizeof(RPGvec2) * 6) + (sizeof(RPGvec4) * i)));
-        glVertexAttribDivisor(mLoc + i, 1);
-    }
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glEnableVertexAttribArray(tilemap->shader.position);
+    glVertexAttribIPointer(tilemap->shader.position, 2, GL_UNSIGNED_SHORT, sizeof(RPGtileinstance), (void *) offset);
+    glVertexAttribDivisor(tilemap->shader.position, 1);
+    glEnableVertexAttribArray(tilemap->shader.tile);
+    glVertexAttribIPointer(tilemap->shader.tile, 2, GL_UNSIGNED_SHORT, sizeof(RPGtileinstance),
+                           (void *) (offset + offsetof(RPGtileinstance, tile)));
+    glVertexAttribDivisor(tilemap->shader.tile, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+/**
+ * @brief The pixels of an image decoded by a thread without a GL context, uploaded once its map is created.
+ */
+typedef struct
+{
+    RPGint width;
+    RPGint height;
+    void *pixels;
+} RPGpendingimage;
+
+// Set on threads loading maps in the background, where images can be decoded but not uploaded
+static _Thread_local RPGbool deferImages;
+
+// The TMX library reports errors through a global and sets up the allocator of libxml2 on each load, so maps are loaded one at a time
+static mtx_t loadMutex;
+static RPGbool loaderReady;
+
 /**
  * @brief Load function for the TMX library to use for laoding resource images.
  *
@@ -131,6 +293,17 @@ static void RPG_Tilemap_SetupVAO(GLuint program, GLuint vao)
  */
 static void *RPG_Tilemap_ImageLoad(const char *path)
 {
+    if (deferImages)
+    {
+        RPG_ALLOC_ZERO(pending, RPGpendingimage);
+        pending->pixels = stbi_load(path, &pending->width, &pending->height, NULL, 4);
+        if (pending->pixels == NULL)
+        {
+            RPG_FREE(pending);
+            return NULL;
+        }
+        return pending;
+    }
     if (RPG_FILE_EXISTS(path))
     {
         RPGimage *image;
@@ -147,56 +320,95 @@ static void *RPG_Tilemap_ImageLoad(const char *path)
  *
  * @param image A pointer to the image to free.
  */
-static void RPG_Tilemap_ImageFree(void *image) { RPG_Image_Free(image); }
+static void RPG_Tilemap_ImageFree(void *image)
+{
+    // Maps that fail to load in the background free the images they have decoded so far
+    if (deferImages)
+    {
+        RPGpendingimage *pending = image;
+        stbi_image_free(pending->pixels);
+        RPG_FREE(pending);
+        return;
+    }
+    RPG_Image_Free(image);
+}
 
 /**
- * @brief Sets up an array of vertex data for a VAO.
+ * @brief Replaces a pending image with an uploaded one, or discards it.
  *
- * @param l The normalized texture coordinate of the left side on the x-axis.
- * @param t The normalized texture coordinate of the right side on the x-axis.
- * @param r The normalized texture coordinate of the top side on the y-axis.
- * @param b The normalized texture coordinate of the bottom side on the y-axis.
- * @param gid The global ID of a tile, or 0 to ignore. Bit-flags for rotation/flipping will be honored.
- * @param vertices The array of vertices the data will be written to.
+ * @param image The TMX image, whose resource image is pending.
+ * @param upload Flag indicating if the image should be uploaded, otherwise it is discarded.
  */
-static void RPG_Tilemap_SetVertices(float l, float t, float r, float b, RPGint gid, RPGvec2 vertices[6])
+static void RPG_Tilemap_ResolveImage(tmx_image *image, RPGbool upload)
 {
-    // Determine placement of vertices based on flag set in GID
-    if ((gid & TMX_FLIPPED_VERTICALLY) != 0 && (gid & TMX_FLIPPED_HORIZONTALLY) != 0)
+    if (image == NULL || image->resource_image == NULL)
     {
-        RPGvec2 v[] = {{r, t}, {l, b}, {r, b}, {r, t}, {l, t}, {l, b}};
-        memcpy(vertices, v, sizeof(v));
+        return;
+    }
+    RPGpendingimage *pending = image->resource_image;
+    RPGimage *result         = NULL;
+    if (upload)
+    {
+        RPG_Image_Create(pending->width, pending->height, pending->pixels, RPG_PIXEL_FORMAT_RGBA, &result);
     }
-    else if ((gid & TMX_FLIPPED_HORIZONTALLY) != 0)
+    image->resource_image = result;
+    stbi_image_free(pending->pixels);
+    RPG_FREE(pending);
+}
+
+/**
+ * @brief Resolves the pending images of the image layers within a list of layers, including those within groups.
+ *
+ * @param layer The first layer of the list.
+ * @param upload Flag indicating if the images should be uploaded, otherwise they are discarded.
+ */
+static void RPG_Tilemap_ResolveLayerImages(tmx_layer *layer, RPGbool upload)
+{
+    for (; layer != NULL; layer = layer->next)
     {
-        if ((gid & TMX_FLIPPED_DIAGONALLY) != 0)
+        if (layer->type == L_IMAGE)
         {
-            RPGvec2 v[] = {{r, b}, {l, t}, {l, b}, {r, b}, {r, t}, {l, t}};
-            memcpy(vertices, v, sizeof(v));
+            RPG_Tilemap_ResolveImage(layer->content.image, upload);
         }
-        else
+        else if (layer->type == L_GROUP)
         {
-            RPGvec2 v[] = {{r, b}, {l, t}, {r, t}, {r, b}, {l, b}, {l, t}};
-            memcpy(vertices, v, sizeof(v));
+            RPG_Tilemap_ResolveLayerImages(layer->content.group_head, upload);
         }
     }
-    else if ((gid & TMX_FLIPPED_VERTICALLY) != 0)
+}
+
+/**
+ * @brief Resolves every pending image of a map loaded in the background.
+ *
+ * @param map The map to resolve the images of.
+ * @param upload Flag indicating if the images should be uploaded, otherwise they are discarded.
+ */
+static void RPG_Tilemap_ResolveImages(tmx_map *map, RPGbool upload)
+{
+    for (tmx_tileset_list *list = map->ts_head; list != NULL; list = list->next)
     {
-        if ((gid & TMX_FLIPPED_DIAGONALLY) != 0)
+        tmx_tileset *ts = list->tileset;
+        RPG_Tilemap_ResolveImage(ts->image, upload);
+        for (RPGuint i = 0; i < ts->tilecount; i++)
         {
-            RPGvec2 v[] = {{l, t}, {r, b}, {r, t}, {l, t}, {l, b}, {r, b}};
-            memcpy(vertices, v, sizeof(v));
-        }
-        else
-        {
-            RPGvec2 v[] = {{l, t}, {r, b}, {l, b}, {l, t}, {r, t}, {r, b}};
-            memcpy(vertices, v, sizeof(v));
+            RPG_Tilemap_ResolveImage(ts->tiles[i].image, upload);
         }
     }
-    else
+    RPG_Tilemap_ResolveLayerImages(map->ly_head, upload);
+}
+
+/**
+ * @brief Uploads the location and layout of each tileset within the atlas to a program.
+ *
+ * @param tilemap The tilemap the atlas belongs to.
+ * @param shader The program to upload to, which must be in use.
+ */
+static void RPG_Tilemap_UploadTilesets(RPGtilemap *tilemap, RPGtileshader *shader)
+{
+    if (tilemap->tilesetCount > 0)
     {
-        RPGvec2 v[] = {{l, b}, {r, t}, {l, t}, {l, b}, {r, b}, {r, t}};
-        memcpy(vertices, v, sizeof(v));
+        glUniform4fv(shader->tilesets, tilemap->tilesetCount, (GLfloat *) tilemap->regions);
+        glUniform4iv(shader->layouts, tilemap->tilesetCount, (GLint *) tilemap->layouts);
     }
 }
 
@@ -204,230 +416,1683 @@ static void RPG_Tilemap_SetVertices(float l, float t, float r, float b, RPGint g
  * @brief Creates and sets up the shader information for this tilemap.
  *
  * @param tilemap A pointer to the tilemap to configure shader for.
+ * @param shader The shader information to populate.
+ * @param vertex The source of the vertex shader.
+ * @param fragment The source of the fragment shader.
  */
-static void RPG_Tilemap_CreateShader(RPGtilemap *tilemap)
+static void RPG_Tilemap_CreateShader(RPGtilemap *tilemap, RPGtileshader *shader, const char *vertex, const char *fragment)
 {
-    RPGshader *shader;
-    size_t s;
-    char *tempv;
-
-    RPG_ReadFile("/home/eric/Desktop/rpg/tilemap.vert", &tempv, &s);  // FIXME: Embed in "assets.c"
-    RPG_Shader_Create(tempv, RPG_FRAGMENT_SHADER, NULL, &shader);
-    RPG_ASSERT(shader);
+    RPGshader *s;
+    RPG_Shader_Create(vertex, fragment, NULL, &s);
+    RPG_ASSERT(s);
+
+    shader->program    = s->program;
+    shader->projection = glGetUniformLocation(s->program, "projection");
+    shader->alpha      = glGetUniformLocation(s->program, "alpha");
+    shader->color      = glGetUniformLocation(s->program, "color");
+    shader->tone       = glGetUniformLocation(s->program, "tone");
+    shader->flash      = glGetUniformLocation(s->program, "flash");
+    shader->hue        = glGetUniformLocation(s->program, "hue");
+    shader->origin     = glGetUniformLocation(s->program, "origin");
+    shader->offset     = glGetUniformLocation(s->program, "offset");
+    shader->cellSize   = glGetUniformLocation(s->program, "cellSize");
+    shader->tilesets   = glGetUniformLocation(s->program, "tilesets");
+    shader->layouts    = glGetUniformLocation(s->program, "layouts");
+    shader->imageSize  = glGetUniformLocation(s->program, "imageSize");
+    shader->animated   = glGetUniformLocation(s->program, "animated");
+    shader->time       = glGetUniformLocation(s->program, "time");
+    shader->viewSize   = glGetUniformLocation(s->program, "viewSize");
+    shader->position   = glGetAttribLocation(s->program, "position");
+    shader->tile       = glGetAttribLocation(s->program, "tile");
+
+    // The frame table is always bound to the second texture unit, and the index texture to the third
+    RPG_Drawing_UseProgram(s->program);
+    glUniform1i(glGetUniformLocation(s->program, "frames"), 1);
+    glUniform1i(glGetUniformLocation(s->program, "indices"), 2);
+
+    // A program created after the tilemap was first rendered would otherwise wait for the next change of origin
+    glUniformMatrix4fv(shader->projection, 1, GL_FALSE, (GLfloat *) &RPG_GAME->projection);
+    glUniform2f(shader->origin, (GLfloat) tilemap->base.ox, (GLfloat) tilemap->base.oy);
+    RPG_Tilemap_UploadTilesets(tilemap, shader);
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+
+    RPG_FREE(s);
+}
 
-    tilemap->shader.program    = shader->program;
-    tilemap->shader.projection = glGetUniformLocation(shader->program, "projection");
-    tilemap->shader.alpha      = glGetUniformLocation(shader->program, "alpha");
-    tilemap->shader.color      = glGetUniformLocation(shader->program, "color");
-    tilemap->shader.tone       = glGetUniformLocation(shader->program, "tone");
-    tilemap->shader.flash      = glGetUniformLocation(shader->program, "flash");
-    tilemap->shader.hue        = glGetUniformLocation(shader->program, "hue");
-    tilemap->shader.origin     = glGetUniformLocation(shader->program, "origin");
+/**
+ * @brief Packs the flip flags of a tile and the index of its tileset into the flags of an instance or index texel.
+ *
+ * @param gid The global tile ID, including its flip flags.
+ * @param tileset The index of the tileset the tile is drawn from.
+ * @return The packed flags.
+ */
+static inline GLushort RPG_Tilemap_TileFlags(RPGint gid, RPGint tileset) { return (GLushort)((((RPGuint) gid) >> 29) | (tileset << 3)); }
 
-    RPG_FREE(shader);
-    if (tempv != NULL)
-        RPG_FREE(tempv);
+/**
+ * @brief Retrieves the index of the tileset a tile is drawn from.
+ *
+ * @param tilemap The tilemap the tile belongs to.
+ * @param gid The global ID of the tile, with or without flip flags.
+ * @return The index of the tileset within the atlas, or -1 if the cell is empty or its tileset could not be packed.
+ */
+static inline RPGint RPG_Tilemap_TilesetIndex(RPGtilemap *tilemap, RPGint gid)
+{
+    RPGuint id = (RPGuint) gid & TMX_FLIP_BITS_REMOVAL;
+    return (id == 0 || id >= tilemap->map->tilecount) ? -1 : tilemap->slots[id];
 }
 
-/****************************************************************************************
- * Render Functions
- ****************************************************************************************/
-
 /**
- * @brief Renders a tile layer.
+ * @brief Chooses the tilesets of a map that are packed into the atlas, and the index of each, mapping every tile to it.
  *
- * @param layer A pointer to the layer, can be cast to an RPGlayer structure.
+ * Tilesets loaded through the resource manager are shared by every map that references them, so the index is stored with
+ * the tilemap rather than in the tileset. The table is only written here, before any worker reads it.
+ *
+ * @param tilemap The tilemap to assign the tilesets of.
  */
-static void RPG_Tilemap_RenderTileLayer(void *layer)
+static void RPG_Tilemap_AssignTilesets(RPGtilemap *tilemap)
 {
-    RPGlayer *l = (RPGlayer *) layer;
+    tmx_map *map = tilemap->map;
+    RPGint count = 0;
+    tmx_tileset *ts;
+    for (tmx_tileset_list *item = map->ts_head; item != NULL; item = item->next)
+    {
+        ts = item->tileset;
+        if (ts->image == NULL || ts->image->resource_image == NULL)
+        {
+            fprintf(stderr, "tilesets of individual images are not supported");
+            continue;
+        }
+        if (count == RPG_TILEMAP_MAX_TILESETS - 1)
+        {
+            fprintf(stderr, "a map may reference at most %d tilesets", RPG_TILEMAP_MAX_TILESETS - 1);
+            continue;
+        }
+        tilemap->tilesets[count++] = ts;
+    }
+    tilemap->tilesetCount = count;
 
-    glUseProgram(l->parent->shader.program);
-    RPG_Drawing_SetBlending(l->parent->base.blend.op, l->parent->base.blend.src, l->parent->base.blend.dst);
+    tilemap->slots = RPG_ALLOC_N(RPGbyte, imax((RPGint) map->tilecount, 1));
+    memset(tilemap->slots, -1, sizeof(RPGbyte) * imax((RPGint) map->tilecount, 1));
+    for (RPGuint gid = 1; gid < map->tilecount; gid++)
+    {
+        if (map->tiles[gid] == NULL)
+        {
+            continue;
+        }
+        for (RPGint i = 0; i < count; i++)
+        {
+            if (tilemap->tilesets[i] == map->tiles[gid]->tileset)
+            {
+                tilemap->slots[gid] = (RPGbyte) i;
+                break;
+            }
+        }
+    }
+}
 
-    glUniform1f(l->parent->shader.alpha, l->parent->base.alpha * (GLfloat) l->tmx->opacity);
+/**
+ * @brief Copies the tiles of a tileset into a new layout with a border of repeated edge pixels around each tile.
+ *
+ * Tiles are placed in the same columns and rows, with the border as the margin and twice the border as the spacing, so
+ * that filtering and sub-pixel rasterization at the edges of a tile sample the tile itself rather than its neighbors.
+ *
+ * @param ts The tileset the pixels belong to.
+ * @param src The pixels of the tileset image.
+ * @param srcWidth The width of the tileset image, in pixels.
+ * @param srcHeight The height of the tileset image, in pixels.
+ * @param columns The number of columns of tiles in the tileset.
+ * @param border The width of the border to extrude around each tile.
+ * @param dst Receives the extruded tiles, with room for the size computed for the packed tileset.
+ * @param dstWidth The width of the extruded tileset, in pixels.
+ */
+static void RPG_Tilemap_ExtrudeTileset(tmx_tileset *ts, const RPGubyte *src, RPGint srcWidth, RPGint srcHeight, RPGint columns,
+                                       RPGint border, RPGubyte *dst, RPGint dstWidth)
+{
+    RPGint tw = (RPGint) ts->tile_width, th = (RPGint) ts->tile_height;
+    RPGint sx, sy, dx, dy;
+    for (RPGuint i = 0; i < ts->tilecount; i++)
+    {
+        sx = ts->margin + (RPGint)(i % columns) * (tw + ts->spacing);
+        sy = ts->margin + (RPGint)(i / columns) * (th + ts->spacing);
+        dx = (RPGint)(i % columns) * (tw + 2 * border);
+        dy = (RPGint)(i / columns) * (th + 2 * border);
 
-    // Bind tileset texture
-    RPG_Drawing_BindTexture(l->layer.tile->image->texture, GL_TEXTURE0);
-    glBindVertexArray(l->layer.tile->vao);
-    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, l->layer.tile->tileCount * 6);
-    glUseProgram(RPG_GAME->shader.program);
+        // Each pixel of the cell takes the nearest pixel of the tile, which repeats the edges into the border
+        for (RPGint y = 0; y < th + 2 * border; y++)
+        {
+            RPGint row = imin(imax(sy + imin(imax(y - border, 0), th - 1), 0), srcHeight - 1);
+            for (RPGint x = 0; x < tw + 2 * border; x++)
+            {
+                RPGint col = imin(imax(sx + imin(imax(x - border, 0), tw - 1), 0), srcWidth - 1);
+                memcpy(&dst[((RPGsize)(dy + y) * dstWidth + dx + x) * 4], &src[((RPGsize) row * srcWidth + col) * 4], 4);
+            }
+        }
+    }
 }
 
 /**
- * @brief Renders an image layer.
+ * @brief Packs every tileset of a map into one atlas, so that tiles from any tileset can be drawn in a single call.
  *
- * @param layer A pointer to the layer, can be cast to an RPGlayer structure.
+ * Tilesets are placed left to right in rows, and the position and layout of each within the atlas is uploaded to the
+ * shader once. The tilesets are packed in the order of their slots, assigned beforehand. When the tilemap extrudes its
+ * tiles, each tileset is re-packed with a border around every tile, otherwise it is copied as is. The tilemap is left
+ * unchanged if the packed tilesets do not fit within the maximum texture size.
+ *
+ * @param tilemap The tilemap to create the atlas for.
+ * @return RPG_NO_ERROR on success, otherwise RPG_ERR_OUT_OF_RANGE if the atlas would exceed the maximum texture size.
  */
-static void RPG_Tilemap_RenderImageLayer(void *layer)
+static RPG_RESULT RPG_Tilemap_CreateAtlas(RPGtilemap *tilemap)
 {
-    RPGlayer *l = (RPGlayer *) layer;
+    GLint maxSize;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+    // Find the size of each tileset once packed, the widest of which the atlas will fit
+    tmx_tileset **sets = tilemap->tilesets;
+    RPGint sizes[RPG_TILEMAP_MAX_TILESETS - 1][2];
+    RPGint count = tilemap->tilesetCount, width = RPG_TILEMAP_ATLAS_WIDTH, border = tilemap->extrusion;
+    GLint layouts[RPG_TILEMAP_MAX_TILESETS][4];
+    RPGint first = 0;
+    tmx_tileset *ts;
+    RPGimage *image;
+    for (RPGint i = 0; i < count; i++)
+    {
+        ts            = sets[i];
+        image         = ts->image->resource_image;
+        layouts[i][0] = imax(1, (image->width - 2 * ts->margin + ts->spacing) / (ts->tile_width + ts->spacing));
+        layouts[i][3] = first;
+        first += ts->tilecount;
+        if (border > 0)
+        {
+            RPGint rows   = imax(1, ((RPGint) ts->tilecount + layouts[i][0] - 1) / layouts[i][0]);
+            layouts[i][1] = border;
+            layouts[i][2] = border * 2;
+            sizes[i][0]   = layouts[i][0] * (ts->tile_width + border * 2);
+            sizes[i][1]   = rows * (ts->tile_height + border * 2);
+        }
+        else
+        {
+            layouts[i][1] = ts->margin;
+            layouts[i][2] = ts->spacing;
+            sizes[i][0]   = image->width;
+            sizes[i][1]   = image->height;
+        }
+        width = imax(width, sizes[i][0]);
+    }
+    width = imin(width, maxSize);
 
-    glUseProgram(l->parent->shader.program);
-    RPG_Drawing_SetBlending(l->parent->base.blend.op, l->parent->base.blend.src, l->parent->base.blend.dst);
+    // Place the tilesets in rows, starting a new row when one will not fit on the current row
+    RPGvec4 regions[RPG_TILEMAP_MAX_TILESETS];
+    RPGint x = 0, y = 0, rowHeight = 0;
+    for (RPGint i = 0; i < count; i++)
+    {
+        ts = sets[i];
+        if (x > 0 && x + sizes[i][0] > width)
+        {
+            x = 0;
+            y += rowHeight;
+            rowHeight = 0;
+        }
+        regions[i] = (RPGvec4){(RPGfloat) x, (RPGfloat) y, (RPGfloat) ts->tile_width, (RPGfloat) ts->tile_height};
+        x += sizes[i][0];
+        rowHeight = imax(rowHeight, sizes[i][1]);
+    }
+    RPGint height = imax(1, y + rowHeight);
+    if (height > maxSize)
+    {
+        fprintf(stderr, "tilesets exceed the maximum texture size when packed\n");
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    memcpy(tilemap->layouts, layouts, sizeof(layouts));
+    memcpy(tilemap->regions, regions, sizeof(regions));
 
-    glUniform1f(l->parent->shader.alpha, l->parent->base.alpha * (GLfloat) l->tmx->opacity);
+    // Copy each tileset into its region of the atlas
+    RPG_Image_Create(width, height, NULL, RPG_PIXEL_FORMAT_RGBA, &tilemap->atlas);
+    RPGubyte *extruded = NULL;
+    for (RPGint i = 0; i < count; i++)
+    {
+        image            = sets[i]->image->resource_image;
+        RPGubyte *pixels = RPG_MALLOC((RPGsize) image->width * image->height * 4);
+        RPG_Drawing_BindTexture(image->texture, GL_TEXTURE0);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        if (border > 0)
+        {
+            extruded = RPG_REALLOC(extruded, (RPGsize) sizes[i][0] * sizes[i][1] * 4);
+            RPG_Tilemap_ExtrudeTileset(sets[i], pixels, image->width, image->height, layouts[i][0], border, extruded, sizes[i][0]);
+        }
+        RPG_Drawing_BindTexture(tilemap->atlas->texture, GL_TEXTURE0);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint) regions[i].x, (GLint) regions[i].y, sizes[i][0], sizes[i][1], GL_RGBA,
+                        GL_UNSIGNED_BYTE, border > 0 ? extruded : pixels);
+        RPG_FREE(pixels);
+    }
+    RPG_FREE(extruded);
 
-    // Bind tileset texture
-    RPG_Drawing_BindTexture(l->layer.image->image->texture, GL_TEXTURE0);
-    glBindVertexArray(l->layer.image->vao);
-    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, 6);
-    glUseProgram(RPG_GAME->shader.program);
+    RPG_Drawing_UseProgram(tilemap->shader.program);
+    RPG_Tilemap_UploadTilesets(tilemap, &tilemap->shader);
+    if (tilemap->indexed.program != 0)
+    {
+        RPG_Drawing_UseProgram(tilemap->indexed.program);
+        RPG_Tilemap_UploadTilesets(tilemap, &tilemap->indexed);
+    }
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+    return RPG_NO_ERROR;
 }
 
 /**
- * @brief Render function for a tilemap. Does not actually render, as layers are independent, only configures shader uniforms.
+ * @brief Uploads the animations of every tileset as a frame table, from which the shader resolves the current frame of each tile.
  *
- * @param tilemap A pointer to the RPGtilemap layer struct to render.
+ * The table begins with the first entry and frame count of every tile in each tileset, in the order the tilesets are packed,
+ * with a count of 0 for tiles that are not animated. It is followed by the frames of each animation, as the tile index and the
+ * time in milliseconds the frame ends, relative to the start of the animation.
+ *
+ * @param tilemap The tilemap to create the frame table for.
  */
-static void RPG_Tilemap_Render(void *tilemap)
+static void RPG_Tilemap_CreateFrames(RPGtilemap *tilemap)
 {
-    RPGtilemap *t = tilemap;
-    // Skip if tilemap is not visible
-    if (!t->base.renderable.visible || t->base.alpha < __FLT_EPSILON__)
+    RPGuint tiles = 0, frames = 0;
+    tmx_tileset *ts;
+    for (RPGint s = 0; s < tilemap->tilesetCount; s++)
+    {
+        ts = tilemap->tilesets[s];
+        tiles += ts->tilecount;
+        for (RPGuint i = 0; i < ts->tilecount; i++)
+        {
+            frames += ts->tiles[i].animation_len;
+        }
+    }
+    if (frames == 0)
     {
         return;
     }
 
-    // Activate the tilemap's shader program
-    glUseProgram(t->shader.program);
-
-    // Update tilemap model matrix and uniforms if changed since last render
-    if (t->base.updated)
+    // Tilesets are enumerated in the same order they were packed, so headers follow the first entry in their layout
+    GLuint *table = RPG_ALLOC_N(GLuint, (tiles + frames) * 2);
+    GLuint header = 0, next = tiles;
+    tmx_tile *tile;
+    for (RPGint s = 0; s < tilemap->tilesetCount; s++)
     {
-        // Set model matrix for tilemap, which is actually a projection matrix for the layers
-        RPG_MAT4_ORTHO(t->base.model, 0.0f, RPG_GAME->resolution.width, RPG_GAME->resolution.height, 0.0f, -1.0f, 1.0f);
-        // RPG_MAT4_ORTHO(t->base.model, 0.0f, w, h, 0.0f, -1.0f, 1.0f);
-        // glUniformMatrix4fv(t->shader.projection, 1, GL_FALSE, (GLfloat *) &t->base.model);
-        glUniformMatrix4fv(t->shader.projection, 1, GL_FALSE, (GLfloat *) &RPG_GAME->projection);  // TODO: Update on resolution change?
+        ts = tilemap->tilesets[s];
+        for (RPGuint i = 0; i < ts->tilecount; i++, header++)
+        {
+            tile                  = &ts->tiles[i];
+            table[header * 2]     = next;
+            table[header * 2 + 1] = tile->animation_len;
 
-        // Update any changes to the origin point and clear "dirty" flag
-        glUniform2f(t->shader.origin, (float) t->base.ox, (float) t->base.oy);
-        t->base.updated = RPG_FALSE;
+            GLuint end = 0;
+            for (RPGuint f = 0; f < tile->animation_len; f++, next++)
+            {
+                // A frame without a duration would leave the animation with no length to wrap the time around
+                end += imax(1, (RPGint) tile->animation[f].duration);
+                table[next * 2]     = tile->animation[f].tile_id;
+                table[next * 2 + 1] = end;
+            }
+        }
     }
 
-    // Setup shared shader uniforms
-    glUniform1f(t->shader.alpha, t->base.alpha);
-    glUniform4f(t->shader.color, t->base.color.x, t->base.color.y, t->base.color.z, t->base.color.w);
-    glUniform4f(t->shader.tone, t->base.tone.x, t->base.tone.y, t->base.tone.z, t->base.tone.w);
-    glUniform1f(t->shader.hue, t->base.hue);
-    glUniform4f(t->shader.flash, t->base.flash.color.x, t->base.flash.color.y, t->base.flash.color.z, t->base.flash.color.w);
-
-    // No actual rendering, just update shader uniforms and ortho if needed
-    glUseProgram(RPG_GAME->shader.program);
+    tilemap->frameBuffer = RPG_Drawing_CreateBuffer(sizeof(GLuint) * (tiles + frames) * 2, table, RPG_FALSE);
+    glGenTextures(1, &tilemap->frames);
+    glBindTexture(GL_TEXTURE_BUFFER, tilemap->frames);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32UI, tilemap->frameBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    RPG_FREE(table);
 }
 
 /****************************************************************************************
- * Initialization
+ * Render Functions
  ****************************************************************************************/
 
-static RPGtilelayer *RPG_Tilemap_CreateTileLayer(RPGtilemap *tilemap, tmx_map *map, tmx_layer *layer)
+/**
+ * @brief Updates the uniforms of a tilemap program that apply to every layer.
+ *
+ * @param t The tilemap being rendered.
+ * @param shader The program to update.
+ * @param updated Flag indicating if the origin has changed since the last render.
+ */
+static void RPG_Tilemap_UpdateShader(RPGtilemap *t, RPGtileshader *shader, RPGbool updated)
 {
-
-    // Initialize tile layer struct and storage for tiles
-    RPGtilelayer *tilelayer = RPG_ALLOC(RPGtilelayer);
-    tilelayer->tileCount    = map->width * map->height;
-    tilelayer->image        = NULL;
-    tilelayer->tiles        = RPG_MALLOC(sizeof(RPGtile) * tilelayer->tileCount);
-    memset(tilelayer->tiles, 0, sizeof(RPGtile) * tilelayer->tileCount);
-
-    RPGvec2 vertices[6];
-
-    glGenVertexArrays(1, &tilelayer->vao);
-    glGenBuffers(1, &tilelayer->vbo);
-
-    glBindBuffer(GL_ARRAY_BUFFER, tilelayer->vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(RPGvertexdata) * tilelayer->tileCount, NULL, GL_DYNAMIC_DRAW);
-    
-    RPGvertexdata *ptr = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-
-    // Enumerate throught each tile coordinate in the map for this layer
-    RPGuint index = 0;
-    RPGint count = 0;
-    for (RPGuint mapY = 0; mapY < map->height; mapY++)
+    RPG_Drawing_UseProgram(shader->program);
+    if (updated)
     {
-        for (RPGuint mapX = 0; mapX < map->width; mapX++)
-        {
-
-            index = mapX + (mapY * map->width);
-
-            // Get the current tile for this location
-            RPGint gid        = layer->content.gids[index];
-            tmx_tile *tmxtile = map->tiles[gid & TMX_FLIP_BITS_REMOVAL];
-
-            if (gid == 0)
-            {
-                memset(&ptr[index], 0, sizeof(RPGvertexdata));
-                // Skip if there is no tile here
-                continue;
-            }
-
-            // Set the image used for this layer (multiple tilesets within one layer not supported)
-            if (tilelayer->image == NULL)
-            {
-                tilelayer->image = tmxtile->tileset->image->resource_image;
-            }
-            else if (tilelayer->image != tmxtile->tileset->image->resource_image)
-            {
-                fprintf(stderr, "only one tileset per layer is supported");
-            }
+        glUniformMatrix4fv(shader->projection, 1, GL_FALSE, (GLfloat *) &RPG_GAME->projection);  // TODO: Update on resolution change?
+        glUniform2f(shader->origin, (float) t->base.ox, (float) t->base.oy);
+    }
+    glUniform1f(shader->alpha, t->base.alpha);
+    glUniform4f(shader->color, t->base.color.x, t->base.color.y, t->base.color.z, t->base.color.w);
+    glUniform4f(shader->tone, t->base.tone.x, t->base.tone.y, t->base.tone.z, t->base.tone.w);
+    glUniform1f(shader->hue, t->base.hue);
+    glUniform4f(shader->flash, t->base.flash.color.x, t->base.flash.color.y, t->base.flash.color.z, t->base.flash.color.w);
+}
 
-            GLfloat tl = RPG_Drawing_GetUV(tmxtile->ul_x, tilelayer->image->width);
-            GLfloat tt = RPG_Drawing_GetUV(tmxtile->ul_y, tilelayer->image->height);
-            GLfloat tr = RPG_Drawing_GetUV(tmxtile->ul_x + tmxtile->tileset->tile_width - 1, tilelayer->image->width);
-            GLfloat tb = RPG_Drawing_GetUV(tmxtile->ul_y + tmxtile->tileset->tile_height - 1, tilelayer->image->height);
-            RPG_Tilemap_SetVertices(tl, tt, tr, tb, gid, vertices);
+/**
+ * @brief Sets the uniforms shared by both tile layer programs, and binds the atlas and frame table.
+ *
+ * @param l The layer being rendered.
+ * @param shader The program rendering the layer, which must be in use.
+ */
+static void RPG_Tilemap_SetupTileLayer(RPGlayer *l, RPGtileshader *shader)
+{
+    RPGtilemap *tilemap = l->parent;
+    RPG_Drawing_SetBlending(tilemap->base.blend.op, tilemap->base.blend.src, tilemap->base.blend.dst);
 
-            memcpy(&ptr[index].vertices, vertices, sizeof(vertices));
-            RPG_MAT4_SET(ptr[index].model, map->tile_width, 0.0f, 0.0f, 0.0f, 0.0f, map->tile_height, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
-                         mapX * map->tile_width, mapY * map->tile_height, 0.0f, 1.0f);
+    glUniform1f(shader->alpha, tilemap->base.alpha * (GLfloat) l->tmx->opacity);
+    glUniform2f(shader->offset, (GLfloat) l->tmx->offsetx, (GLfloat) l->tmx->offsety);
+    glUniform2f(shader->cellSize, (GLfloat) tilemap->map->tile_width, (GLfloat) tilemap->map->tile_height);
+    glUniform2f(shader->imageSize, (GLfloat) tilemap->atlas->width, (GLfloat) tilemap->atlas->height);
 
-            // Store the info in the tile
-            tilelayer->tiles[index].tmx = tmxtile;
-        }
+    // Animated tiles resolve their frame in the shader from the game time in milliseconds
+    glUniform1i(shader->animated, tilemap->frames != 0);
+    if (tilemap->frames != 0)
+    {
+        RPGgame *game = RPG_GAME;
+        glUniform1ui(shader->time, (GLuint)(RPGint64)(game->update.count * game->update.tick * 1000.0));
+        RPG_Drawing_BindTextureBuffer(tilemap->frames, GL_TEXTURE1);
     }
-    glUnmapBuffer(GL_ARRAY_BUFFER);
 
-    RPG_Tilemap_SetupVAO(tilemap->shader.program, tilelayer->vao);
-    return tilelayer;
+    // Bind the atlas of every tileset, each tile selects its tileset from its instance data or index texel
+    RPG_Drawing_BindTexture(tilemap->atlas->texture, GL_TEXTURE0);
 }
 
-static RPGimagelayer *RPG_Tilemap_CreateImageLayer(RPGtilemap *tilemap, tmx_layer *layer)
+/**
+ * @brief Draws the instances of a tile layer within the chunks that overlap an area of the map.
+ *
+ * The instanced program must be in use with the uniforms of the layer set.
+ *
+ * @param l The tile layer to draw.
+ * @param x The left edge of the area on the map, in pixels.
+ * @param y The top edge of the area on the map, in pixels.
+ * @param width The width of the area, in pixels.
+ * @param height The height of the area, in pixels.
+ */
+static void RPG_Tilemap_DrawChunks(RPGlayer *l, RPGint x, RPGint y, RPGint width, RPGint height)
 {
+    // Find the range of chunks within the area, the layer's offset moves its chunks relative to the map
+    RPGtilelayer *tiles = l->layer.tile;
+    tmx_map *map        = l->parent->map;
+    RPGint chunkW       = RPG_TILEMAP_CHUNK_SIZE * (RPGint) map->tile_width;
+    RPGint chunkH       = RPG_TILEMAP_CHUNK_SIZE * (RPGint) map->tile_height;
+    RPGint viewX        = x - l->tmx->offsetx;
+    RPGint viewY        = y - l->tmx->offsety;
+    RPGint left         = imax(0, viewX / chunkW);
+    RPGint top          = imax(0, viewY / chunkH);
+    RPGint right        = imin(tiles->chunksX - 1, (viewX + width - 1) / chunkW);
+    RPGint bottom       = imin(tiles->chunksY - 1, (viewY + height - 1) / chunkH);
+    if (left > right || top > bottom || viewX + width <= 0 || viewY + height <= 0)
+    {
+        return;
+    }
 
-    RPGimagelayer *l = RPG_ALLOC(RPGimagelayer);
-    l->image         = layer->content.image->resource_image;
-    RPG_ASSERT(l->image);
-
-    RPGvertexdata obj;
-    RPG_Tilemap_SetVertices(0.0f, 0.0f, 1.0f, 1.0f, 0, obj.vertices);
-    RPG_MAT4_SET(obj.model, l->image->width, 0, 0, 0, 0, l->image->height, 0, 0, 0, 0, 1.0f, 0, layer->offsetx, layer->offsety, 0, 1.0f);
+    // Chunks are stored in row-major order, so the visible chunks of each row are one contiguous range of instances
+    RPGint first, count;
+    for (RPGint y = top; y <= bottom; y++)
+    {
+        first = tiles->chunks[y * tiles->chunksX + left];
+        count = tiles->chunks[y * tiles->chunksX + right + 1] - first;
+        if (count > 0)
+        {
+            RPG_Tilemap_SetupVAO(l->parent, tiles->vao, tiles->vbo, first);
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+        }
+    }
+}
 
-    glGenVertexArrays(1, &l->vao);
-    glGenBuffers(1, &l->vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, l->vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(RPGvertexdata), &obj, GL_STATIC_DRAW);
+/****************************************************************************************
+ * Baking
+ ****************************************************************************************/
 
-    RPG_Tilemap_SetupVAO(tilemap->shader.program, l->vao);
-    return l;
+/**
+ * @brief Checks if a layer is a baked tile layer.
+ *
+ * @param r The renderable of the layer.
+ * @return RPG_TRUE if the layer is baked, otherwise RPG_FALSE.
+ */
+static inline RPGbool RPG_Tilemap_IsBaked(RPGrenderable *r)
+{
+    RPGlayer *l = (RPGlayer *) r;
+    return l->type == L_LAYER && l->layer.tile->baked;
+}
+
+/**
+ * @brief Retrieves the texture memory used by a baked chunk of a tilemap.
+ *
+ * @param tilemap The tilemap.
+ * @return The size of a chunk texture, in bytes.
+ */
+static inline RPGsize RPG_Tilemap_ChunkBytes(RPGtilemap *tilemap)
+{
+    return (RPGsize)(RPG_TILEMAP_CHUNK_SIZE * tilemap->map->tile_width * RPG_TILEMAP_CHUNK_SIZE * tilemap->map->tile_height * 4);
+}
+
+/**
+ * @brief Checks if a layer and the one after it are both baked and can be drawn together, as nothing else is drawn between them.
+ *
+ * @param tilemap The tilemap the layers belong to.
+ * @param index The index of the first of the two layers.
+ * @return RPG_TRUE if the layers belong to the same run, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_Tilemap_BakedJoin(RPGtilemap *tilemap, RPGint index)
+{
+    RPGrenderable *a = tilemap->layers.items[index];
+    RPGrenderable *b = tilemap->layers.items[index + 1];
+    if (!RPG_Tilemap_IsBaked(a) || !RPG_Tilemap_IsBaked(b))
+    {
+        return RPG_FALSE;
+    }
+    // A layer moved from its default position is drawn on its own, as its order relative to the rest of the map has changed
+    if (a->z != index * RPG_LAYER_OFFSET || b->z != (index + 1) * RPG_LAYER_OFFSET)
+    {
+        return RPG_FALSE;
+    }
+    // Layers are drawn at the z of the first of the run, so anything drawn between them, or tied with either, splits the run
+    RPGrenderable *r;
+    for (RPGint i = 0; i < a->parent->total; i++)
+    {
+        r = a->parent->items[i];
+        if (r != a && r != b && r != &tilemap->base.renderable && r->visible && r->z >= a->z && r->z <= b->z)
+        {
+            return RPG_FALSE;
+        }
+    }
+    return RPG_TRUE;
+}
+
+/**
+ * @brief Finds the run of consecutive baked tile layers a baked layer belongs to.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param index The index of the baked layer.
+ * @param last Receives the index of the last layer of the run.
+ * @return The index of the first layer of the run.
+ */
+static RPGint RPG_Tilemap_BakedRun(RPGtilemap *tilemap, RPGint index, RPGint *last)
+{
+    RPGint first = index;
+    while (first > 0 && RPG_Tilemap_BakedJoin(tilemap, first - 1))
+    {
+        first--;
+    }
+    *last = index;
+    while (*last + 1 < tilemap->layers.total && RPG_Tilemap_BakedJoin(tilemap, *last))
+    {
+        (*last)++;
+    }
+    return first;
+}
+
+/**
+ * @brief Releases the texture of a baked chunk.
+ *
+ * @param tilemap The tilemap the run belongs to.
+ * @param bake The run the chunk belongs to.
+ * @param chunk The chunk to release.
+ */
+static void RPG_Tilemap_ReleaseChunk(RPGtilemap *tilemap, RPGtilebake *bake, RPGbakedchunk *chunk)
+{
+    glDeleteFramebuffers(1, &chunk->fbo);
+    RPG_Drawing_DeleteTexture(chunk->texture);
+    chunk->fbo     = 0;
+    chunk->texture = 0;
+    bake->resident -= RPG_Tilemap_ChunkBytes(tilemap);
+}
+
+/**
+ * @brief Evicts the least recently drawn chunks of a run until the required memory fits within the tilemap's budget.
+ *
+ * Chunks drawn in the current frame are never evicted, so the budget is exceeded when the visible chunks alone need more.
+ *
+ * @param tilemap The tilemap the run belongs to.
+ * @param bake The run to evict chunks from.
+ * @param required The memory about to be used by a new chunk, in bytes.
+ */
+static void RPG_Tilemap_EvictChunks(RPGtilemap *tilemap, RPGtilebake *bake, RPGsize required)
+{
+    RPGbakedchunk *oldest, *chunk;
+    while (bake->resident + required > tilemap->bakeBudget)
+    {
+        oldest = NULL;
+        for (RPGint i = 0; i < bake->count; i++)
+        {
+            chunk = &bake->chunks[i];
+            if (chunk->texture != 0 && chunk->used != bake->frame && (oldest == NULL || chunk->used < oldest->used))
+            {
+                oldest = chunk;
+            }
+        }
+        if (oldest == NULL)
+        {
+            break;
+        }
+        RPG_Tilemap_ReleaseChunk(tilemap, bake, oldest);
+    }
+}
+
+/**
+ * @brief Creates the storage of a run of baked layers, without baking any chunks.
+ *
+ * @param tilemap The tilemap the run belongs to.
+ * @param tiles The first layer of the run, which provides the chunk grid.
+ * @param last The index of the last layer of the run.
+ * @return The created run storage.
+ */
+static RPGtilebake *RPG_Tilemap_CreateBake(RPGtilemap *tilemap, RPGtilelayer *tiles, RPGint last)
+{
+    RPG_ALLOC_ZERO(bake, RPGtilebake);
+    bake->last   = last;
+    bake->count  = tiles->chunksX * tiles->chunksY;
+    bake->chunks = RPG_ALLOC_N(RPGbakedchunk, bake->count);
+    memset(bake->chunks, 0, sizeof(RPGbakedchunk) * bake->count);
+
+    // Each chunk is drawn as one instance, a single tile the size of the chunk
+    RPGtileinstance *instances = RPG_ALLOC_N(RPGtileinstance, bake->count);
+    for (RPGint i = 0; i < bake->count; i++)
+    {
+        instances[i].x     = (GLushort)(i % tiles->chunksX);
+        instances[i].y     = (GLushort)(i / tiles->chunksX);
+        instances[i].tile  = 0;
+        instances[i].flags = (RPG_TILEMAP_MAX_TILESETS - 1) << 3;
+    }
+    bake->vbo = RPG_Drawing_CreateBuffer(sizeof(RPGtileinstance) * bake->count, instances, RPG_FALSE);
+    glGenVertexArrays(1, &bake->vao);
+    RPG_Tilemap_SetupVAO(tilemap, bake->vao, bake->vbo, 0);
+    RPG_FREE(instances);
+    return bake;
+}
+
+/**
+ * @brief Releases every resident chunk of a run, which are baked again as they become visible.
+ *
+ * @param tilemap The tilemap the run belongs to.
+ * @param bake The run to release the chunks of.
+ */
+static void RPG_Tilemap_ReleaseChunks(RPGtilemap *tilemap, RPGtilebake *bake)
+{
+    for (RPGint c = 0; c < bake->count; c++)
+    {
+        if (bake->chunks[c].texture != 0)
+        {
+            RPG_Tilemap_ReleaseChunk(tilemap, bake, &bake->chunks[c]);
+        }
+    }
+}
+
+/**
+ * @brief Frees the storage of a run owned by a tile layer, if any.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param tiles The tile layer owning the run.
+ */
+static void RPG_Tilemap_FreeBake(RPGtilemap *tilemap, RPGtilelayer *tiles)
+{
+    RPGtilebake *bake = tiles->bake;
+    if (bake == NULL)
+    {
+        return;
+    }
+    RPG_Tilemap_ReleaseChunks(tilemap, bake);
+    glDeleteVertexArrays(1, &bake->vao);
+    glDeleteBuffers(1, &bake->vbo);
+    RPG_FREE(bake->chunks);
+    RPG_FREE(bake);
+    tiles->bake = NULL;
+}
+
+/**
+ * @brief Frees the chunk textures of every run of baked layers, which are baked again as they become visible.
+ *
+ * @param tilemap The tilemap to free the baked chunks of.
+ */
+static void RPG_Tilemap_FreeBakes(RPGtilemap *tilemap)
+{
+    RPGlayer *l;
+    for (RPGint i = 0; i < tilemap->layers.total; i++)
+    {
+        l = (RPGlayer *) tilemap->layers.items[i];
+        if (l->type == L_LAYER)
+        {
+            RPG_Tilemap_FreeBake(tilemap, l->layer.tile);
+        }
+    }
+}
+
+/**
+ * @brief Renders the visible layers of a run into the texture of a chunk.
+ *
+ * @param tilemap The tilemap the run belongs to.
+ * @param bake The run being baked.
+ * @param first The index of the first layer of the run.
+ * @param last The index of the last layer of the run.
+ * @param chunk The index of the chunk to bake.
+ */
+static void RPG_Tilemap_BakeChunk(RPGtilemap *tilemap, RPGtilebake *bake, RPGint first, RPGint last, RPGint chunk)
+{
+    RPGtilelayer *tiles  = ((RPGlayer *) tilemap->layers.items[first])->layer.tile;
+    RPGint w             = RPG_TILEMAP_CHUNK_SIZE * (RPGint) tilemap->map->tile_width;
+    RPGint h             = RPG_TILEMAP_CHUNK_SIZE * (RPGint) tilemap->map->tile_height;
+    RPGint x             = (chunk % tiles->chunksX) * w;
+    RPGint y             = (chunk / tiles->chunksX) * h;
+    RPGbakedchunk *baked = &bake->chunks[chunk];
+
+    RPG_Tilemap_EvictChunks(tilemap, bake, RPG_Tilemap_ChunkBytes(tilemap));
+    baked->texture = RPG_Drawing_CreateTexture(w, h, GL_RGBA8, GL_RGBA, NULL, GL_CLAMP_TO_EDGE, GL_NEAREST);
+    baked->fbo     = RPG_Drawing_CreateFramebuffer(baked->texture);
+    bake->resident += RPG_Tilemap_ChunkBytes(tilemap);
+
+    // The tilemap may be within a viewport, so the current render target is restored rather than the game's
+    GLint target, view[4], scissor[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &target);
+    glGetIntegerv(GL_VIEWPORT, view);
+    glGetIntegerv(GL_SCISSOR_BOX, scissor);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, baked->fbo);
+    RPG_VIEWPORT(0, 0, w, h);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // The top row of the chunk is written to the first row of the texture, the same as a loaded image
+    RPGtileshader *shader = &tilemap->shader;
+    RPGmat4 ortho;
+    RPG_MAT4_ORTHO(ortho, 0.0f, w, 0.0f, h, -1.0f, 1.0f);
+    RPG_Drawing_UseProgram(shader->program);
+    glUniformMatrix4fv(shader->projection, 1, GL_FALSE, (GLfloat *) &ortho);
+    glUniform2f(shader->origin, (GLfloat) x, (GLfloat) y);
+
+    // The tilemap's effects are applied when the chunk is drawn, so the layers are baked without them
+    glUniform4f(shader->color, 0.0f, 0.0f, 0.0f, 0.0f);
+    glUniform4f(shader->tone, 0.0f, 0.0f, 0.0f, 0.0f);
+    glUniform4f(shader->flash, 0.0f, 0.0f, 0.0f, 0.0f);
+    glUniform1f(shader->hue, 0.0f);
+
+    RPGlayer *l;
+    for (RPGint i = first; i <= last; i++)
+    {
+        l = (RPGlayer *) tilemap->layers.items[i];
+        if (!l->renderable.visible || l->layer.tile->instanceCount == 0)
+        {
+            continue;
+        }
+        // Layers are static once baked, so animated tiles keep their first frame
+        RPG_Tilemap_SetupTileLayer(l, shader);
+        glUniform1f(shader->alpha, (GLfloat) l->tmx->opacity);
+        glUniform1i(shader->animated, RPG_FALSE);
+        RPG_Drawing_SetBlending(GL_FUNC_ADD, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        RPG_Tilemap_DrawChunks(l, x, y, w, h);
+    }
+
+    // Restore the blending the drawing state expects, and the uniforms and render target of the tilemap
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    RPG_Tilemap_UpdateShader(tilemap, shader, RPG_TRUE);
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint) target);
+    glViewport(view[0], view[1], view[2], view[3]);
+    glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+    RPG_RESET_BACK_COLOR();
+}
+
+/**
+ * @brief Renders a run of baked layers as one textured quad for each visible chunk, baking chunks as they become visible.
+ *
+ * Only the first visible layer of a run draws it, at its position on the z-axis.
+ *
+ * @param l A baked tile layer.
+ */
+static void RPG_Tilemap_RenderBakedLayer(RPGlayer *l)
+{
+    RPGtilemap *tilemap = l->parent;
+    RPGint last;
+    RPGint first = RPG_Tilemap_BakedRun(tilemap, l->index, &last);
+    for (RPGint i = first; i < l->index; i++)
+    {
+        if (tilemap->layers.items[i]->visible)
+        {
+            return;
+        }
+    }
+
+    // Runs change as other objects move between the layers, so chunks baked with different layers are baked again, and the
+    // runs of layers that are no longer the first of one are freed
+    RPGtilelayer *tiles = ((RPGlayer *) tilemap->layers.items[first])->layer.tile;
+    if (tiles->bake == NULL)
+    {
+        tiles->bake = RPG_Tilemap_CreateBake(tilemap, tiles, last);
+    }
+    else if (tiles->bake->last != last)
+    {
+        RPG_Tilemap_ReleaseChunks(tilemap, tiles->bake);
+        tiles->bake->last = last;
+    }
+    for (RPGint i = first + 1; i <= last; i++)
+    {
+        RPG_Tilemap_FreeBake(tilemap, ((RPGlayer *) tilemap->layers.items[i])->layer.tile);
+    }
+    RPGtilebake *bake = tiles->bake;
+    bake->frame++;
+
+    // Offsets of the layers are baked into the chunks, so the chunks are aligned to the map
+    RPGint w      = RPG_TILEMAP_CHUNK_SIZE * (RPGint) tilemap->map->tile_width;
+    RPGint h      = RPG_TILEMAP_CHUNK_SIZE * (RPGint) tilemap->map->tile_height;
+    RPGint viewX  = tilemap->base.ox;
+    RPGint viewY  = tilemap->base.oy;
+    RPGint left   = imax(0, viewX / w);
+    RPGint top    = imax(0, viewY / h);
+    RPGint right  = imin(tiles->chunksX - 1, (viewX + RPG_GAME->resolution.width - 1) / w);
+    RPGint bottom = imin(tiles->chunksY - 1, (viewY + RPG_GAME->resolution.height - 1) / h);
+    if (left > right || top > bottom || viewX + RPG_GAME->resolution.width <= 0 || viewY + RPG_GAME->resolution.height <= 0)
+    {
+        return;
+    }
+
+    // Mark the visible chunks before baking any, so baking one never evicts another about to be drawn
+    for (RPGint y = top; y <= bottom; y++)
+    {
+        for (RPGint x = left; x <= right; x++)
+        {
+            bake->chunks[y * tiles->chunksX + x].used = bake->frame;
+        }
+    }
+    RPGint chunk;
+    for (RPGint y = top; y <= bottom; y++)
+    {
+        for (RPGint x = left; x <= right; x++)
+        {
+            chunk = y * tiles->chunksX + x;
+            if (bake->chunks[chunk].texture == 0)
+            {
+                RPG_Tilemap_BakeChunk(tilemap, bake, first, last, chunk);
+            }
+        }
+    }
+
+    // Each chunk is a single tile, its region widened by half a texel so texels map to pixels without the inset used for tiles
+    RPGtileshader *shader = &tilemap->shader;
+    GLint slot            = RPG_TILEMAP_MAX_TILESETS - 1;
+    RPG_Drawing_UseProgram(shader->program);
+    RPG_Drawing_SetBlending(tilemap->base.blend.op, tilemap->base.blend.src, tilemap->base.blend.dst);
+    glUniform1f(shader->alpha, tilemap->base.alpha);
+    glUniform2f(shader->offset, 0.0f, 0.0f);
+    glUniform2f(shader->cellSize, (GLfloat) w, (GLfloat) h);
+    glUniform2f(shader->imageSize, (GLfloat) w, (GLfloat) h);
+    glUniform4f(shader->tilesets + slot, -0.5f, -0.5f, (GLfloat)(w + 1), (GLfloat)(h + 1));
+    glUniform4i(shader->layouts + slot, 1, 0, 0, 0);
+    glUniform1i(shader->animated, RPG_FALSE);
+
+    for (RPGint y = top; y <= bottom; y++)
+    {
+        for (RPGint x = left; x <= right; x++)
+        {
+            chunk = y * tiles->chunksX + x;
+            RPG_Drawing_BindTexture(bake->chunks[chunk].texture, GL_TEXTURE0);
+            RPG_Tilemap_SetupVAO(tilemap, bake->vao, bake->vbo, chunk);
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, 1);
+        }
+    }
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+
+    // Chunks scrolled out of view are kept until the budget requires their memory
+    RPG_Tilemap_EvictChunks(tilemap, bake, 0);
+}
+
+/****************************************************************************************
+ * Editing
+ ****************************************************************************************/
+
+/**
+ * @brief Retrieves the number of instances a chunk of a tile layer needs.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param tiles The tile layer.
+ * @param layer The TMX layer with the tiles of each cell.
+ * @param chunk The index of the chunk.
+ * @return The number of non-empty cells, or every cell of the chunk once it has been opened for editing.
+ */
+static RPGint RPG_Tilemap_ChunkInstances(RPGtilemap *tilemap, RPGtilelayer *tiles, tmx_layer *layer, RPGint chunk)
+{
+    tmx_map *map  = tilemap->map;
+    RPGint left   = (chunk % tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+    RPGint top    = (chunk / tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+    RPGint right  = imin(left + RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->width);
+    RPGint bottom = imin(top + RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->height);
+    if (tiles->edits != NULL && (tiles->edits[chunk] & RPG_TILEMAP_CHUNK_OPEN))
+    {
+        return (right - left) * (bottom - top);
+    }
+    RPGint count = 0;
+    for (RPGint y = top; y < bottom; y++)
+    {
+        for (RPGint x = left; x < right; x++)
+        {
+            if (RPG_Tilemap_TilesetIndex(tilemap, layer->content.gids[x + y * map->width]) >= 0)
+            {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Writes the instances of a chunk of a tile layer, and stores the instance of each of its cells.
+ *
+ * Cells are written in row-major order from the first instance of the chunk. Empty cells of an opened chunk, and any
+ * instances remaining once every cell has been written, are marked empty and are not drawn.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param tiles The tile layer.
+ * @param layer The TMX layer with the tiles of each cell.
+ * @param chunk The index of the chunk.
+ * @param dst Receives the instances of the chunk.
+ */
+static void RPG_Tilemap_WriteChunk(RPGtilemap *tilemap, RPGtilelayer *tiles, tmx_layer *layer, RPGint chunk, RPGtileinstance *dst)
+{
+    tmx_map *map    = tilemap->map;
+    RPGint left     = (chunk % tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+    RPGint top      = (chunk / tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+    RPGint right    = imin(left + RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->width);
+    RPGint bottom   = imin(top + RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->height);
+    RPGint first    = tiles->chunks[chunk];
+    RPGint capacity = tiles->chunks[chunk + 1] - first;
+    RPGbool open    = tiles->edits != NULL && (tiles->edits[chunk] & RPG_TILEMAP_CHUNK_OPEN);
+
+    RPGint n = 0, index, gid, tileset;
+    for (RPGint y = top; y < bottom; y++)
+    {
+        for (RPGint x = left; x < right; x++)
+        {
+            index                   = x + y * (RPGint) map->width;
+            gid                     = layer->content.gids[index];
+            tileset                 = RPG_Tilemap_TilesetIndex(tilemap, gid);
+            tiles->tiles[index].tmx = tileset < 0 ? NULL : map->tiles[gid & TMX_FLIP_BITS_REMOVAL];
+            if (tileset < 0 && !open)
+            {
+                // Skip if there is no tile here, or its tileset could not be packed
+                tiles->tiles[index].instance = -1;
+                continue;
+            }
+
+            // Placement and texture coordinates are derived in the shader from the cell, tile index and tileset uniforms
+            dst[n].x                     = (GLushort) x;
+            dst[n].y                     = (GLushort) y;
+            dst[n].tile                  = tileset < 0 ? 0 : (GLushort) tiles->tiles[index].tmx->id;
+            dst[n].flags                 = tileset < 0 ? RPG_TILEMAP_EMPTY : RPG_Tilemap_TileFlags(gid, tileset);
+            tiles->tiles[index].instance = first + n++;
+        }
+    }
+    for (; n < capacity; n++)
+    {
+        dst[n] = (RPGtileinstance){0, 0, 0, RPG_TILEMAP_EMPTY};
+    }
+}
+
+/**
+ * @brief Assigns the instances of a tile layer to its chunks, and fills a new VBO with them, replacing any previous one.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param tiles The tile layer to lay out.
+ * @param layer The TMX layer with the tiles of each cell.
+ */
+static void RPG_Tilemap_LayoutTileLayer(RPGtilemap *tilemap, RPGtilelayer *tiles, tmx_layer *layer)
+{
+    // Count the instances of each chunk, and convert the counts to the first instance of each chunk
+    RPGint chunkCount = tiles->chunksX * tiles->chunksY;
+    tiles->chunks[0]  = 0;
+    for (RPGint i = 0; i < chunkCount; i++)
+    {
+        tiles->chunks[i + 1] = tiles->chunks[i] + RPG_Tilemap_ChunkInstances(tilemap, tiles, layer, i);
+    }
+    tiles->instanceCount = tiles->chunks[chunkCount];
+
+    if (tiles->vbo != 0)
+    {
+        glDeleteBuffers(1, &tiles->vbo);
+    }
+    // The buffer is new, so it can be mapped and filled without waiting on frames still in flight. Later edits are uploaded
+    // with BufferSubData instead, which the driver orders against the draws that precede it.
+    GLsizeiptr size      = sizeof(RPGtileinstance) * imax(tiles->instanceCount, 1);
+    tiles->vbo           = RPG_Drawing_CreateBuffer(size, NULL, RPG_TRUE);
+    RPGtileinstance *ptr = RPG_Drawing_MapBuffer(tiles->vbo, 0, size);
+    for (RPGint i = 0; i < chunkCount; i++)
+    {
+        RPG_Tilemap_WriteChunk(tilemap, tiles, layer, i, &ptr[tiles->chunks[i]]);
+    }
+    RPG_Drawing_UnmapBuffer(tiles->vbo);
+}
+
+/**
+ * @brief Writes the texel of a cell of an index texture.
+ *
+ * @param tilemap The tilemap the cell belongs to.
+ * @param gid The global ID of the cell's tile, with its flip flags.
+ * @param texel Receives the tile index and the flags of the cell.
+ */
+static inline void RPG_Tilemap_CellTexel(RPGtilemap *tilemap, RPGint gid, GLushort *texel)
+{
+    RPGint tileset = RPG_Tilemap_TilesetIndex(tilemap, gid);
+    if (tileset < 0)
+    {
+        // Empty cells, and those whose tileset could not be packed, are marked with flags no tile can have
+        texel[0] = 0;
+        texel[1] = RPG_TILEMAP_EMPTY;
+        return;
+    }
+    texel[0] = (GLushort) tilemap->map->tiles[gid & TMX_FLIP_BITS_REMOVAL]->id;
+    texel[1] = RPG_Tilemap_TileFlags(gid, tileset);
+}
+
+/**
+ * @brief Uploads the chunks of a tile layer that have been edited since the last frame.
+ *
+ * Each edited chunk is rewritten in place when its instances can hold its tiles, and only its range of the VBO is uploaded.
+ * When a chunk needs more instances, it is opened so every cell has its own instance, and the layer is laid out again. The
+ * chunks of an index texture are uploaded as sub-images, and baked chunks are released so that they are baked again.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param l The edited tile layer.
+ */
+static void RPG_Tilemap_FlushLayer(RPGtilemap *tilemap, RPGlayer *l)
+{
+    tmx_map *map        = tilemap->map;
+    RPGtilelayer *tiles = l->layer.tile;
+    RPGint chunkCount   = tiles->chunksX * tiles->chunksY;
+
+    RPGbool layout = RPG_FALSE;
+    for (RPGint i = 0; i < chunkCount; i++)
+    {
+        if ((tiles->edits[i] & RPG_TILEMAP_CHUNK_DIRTY) &&
+            RPG_Tilemap_ChunkInstances(tilemap, tiles, l->tmx, i) > tiles->chunks[i + 1] - tiles->chunks[i])
+        {
+            tiles->edits[i] |= RPG_TILEMAP_CHUNK_OPEN;
+            layout = RPG_TRUE;
+        }
+    }
+    if (layout)
+    {
+        RPG_Tilemap_LayoutTileLayer(tilemap, tiles, l->tmx);
+    }
+
+    RPGtileinstance *instances = NULL;
+    GLushort *texels           = NULL;
+    RPGint left, top, width, height;
+    for (RPGint i = 0; i < chunkCount; i++)
+    {
+        if (!(tiles->edits[i] & RPG_TILEMAP_CHUNK_DIRTY))
+        {
+            continue;
+        }
+        tiles->edits[i] &= ~RPG_TILEMAP_CHUNK_DIRTY;
+        if (!layout)
+        {
+            // Only the range of the chunk is uploaded, never written through a mapping the previous frame may still be reading
+            RPGint first = tiles->chunks[i], count = tiles->chunks[i + 1] - first;
+            instances    = RPG_REALLOC(instances, sizeof(RPGtileinstance) * imax(count, 1));
+            RPG_Tilemap_WriteChunk(tilemap, tiles, l->tmx, i, instances);
+            if (count > 0)
+            {
+                RPG_Drawing_BufferSubData(tiles->vbo, sizeof(RPGtileinstance) * first, sizeof(RPGtileinstance) * count, instances);
+            }
+        }
+        if (tiles->indices != 0)
+        {
+            left   = (i % tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+            top    = (i / tiles->chunksX) * RPG_TILEMAP_CHUNK_SIZE;
+            width  = imin(RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->width - left);
+            height = imin(RPG_TILEMAP_CHUNK_SIZE, (RPGint) map->height - top);
+            texels = RPG_REALLOC(texels, sizeof(GLushort) * 2 * RPG_TILEMAP_CHUNK_SIZE * RPG_TILEMAP_CHUNK_SIZE);
+            for (RPGint y = 0; y < height; y++)
+            {
+                for (RPGint x = 0; x < width; x++)
+                {
+                    RPG_Tilemap_CellTexel(tilemap, l->tmx->content.gids[left + x + (top + y) * map->width], &texels[(x + y * width) * 2]);
+                }
+            }
+            RPG_Drawing_BindTexture(tiles->indices, GL_TEXTURE0);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, left, top, width, height, GL_RG_INTEGER, GL_UNSIGNED_SHORT, texels);
+        }
+        if (!tiles->baked)
+        {
+            continue;
+        }
+        // The run this layer belongs to changes as objects move between layers, so the chunk is released from every run
+        for (RPGint j = 0; j < tilemap->layers.total; j++)
+        {
+            RPGlayer *owner = (RPGlayer *) tilemap->layers.items[j];
+            if (owner->type == L_LAYER && owner->layer.tile->bake != NULL && owner->layer.tile->bake->chunks[i].texture != 0)
+            {
+                RPG_Tilemap_ReleaseChunk(tilemap, owner->layer.tile->bake, &owner->layer.tile->bake->chunks[i]);
+            }
+        }
+    }
+    RPG_FREE(instances);
+    RPG_FREE(texels);
+}
+
+/**
+ * @brief Uploads the tiles edited since the last frame, coalescing every edit to a chunk into a single upload.
+ *
+ * @param tilemap The tilemap to upload the edits of.
+ */
+static void RPG_Tilemap_FlushEdits(RPGtilemap *tilemap)
+{
+    RPGlayer *l;
+    for (RPGint i = 0; i < tilemap->layers.total; i++)
+    {
+        l = (RPGlayer *) tilemap->layers.items[i];
+        if (l->type == L_LAYER && l->layer.tile->edits != NULL)
+        {
+            RPG_Tilemap_FlushLayer(tilemap, l);
+        }
+    }
+    tilemap->edited = RPG_FALSE;
+}
+
+/****************************************************************************************
+ * Streaming
+ ****************************************************************************************/
+
+/**
+ * @brief Divides two integers, rounding towards negative infinity so that negative positions fall into the correct chunk.
+ *
+ * @param a The dividend.
+ * @param b The divisor, which must be positive.
+ * @return The quotient.
+ */
+static inline RPGint RPG_Tilemap_FloorDiv(RPGint a, RPGint b) { return a >= 0 ? a / b : -((-a + b - 1) / b); }
+
+/**
+ * @brief Combines the column and row of a chunk into a key for the chunk lookup.
+ *
+ * @param x The column of the chunk.
+ * @param y The row of the chunk.
+ * @return The key.
+ */
+static inline RPGint64 RPG_Tilemap_ChunkKey(RPGint x, RPGint y) { return (RPGint64)(((RPGuint64)(RPGuint) x << 32) | (RPGuint) y); }
+
+/**
+ * @brief Appends a chunk to a growable list of chunks.
+ *
+ * @param list A pointer to the list.
+ * @param count A pointer to the number of chunks in the list.
+ * @param capacity A pointer to the capacity of the list.
+ * @param chunk The chunk to append.
+ */
+static void RPG_Tilemap_PushChunk(RPGstreamchunk ***list, RPGint *count, RPGint *capacity, RPGstreamchunk *chunk)
+{
+    if (*count == *capacity)
+    {
+        *capacity = imax(16, *capacity * 2);
+        *list     = RPG_REALLOC(*list, sizeof(RPGstreamchunk *) * *capacity);
+    }
+    (*list)[(*count)++] = chunk;
+}
+
+/**
+ * @brief Decodes the tiles of a chunk into the instances that draw it. Called by the worker thread.
+ *
+ * @param tilemap The tilemap the chunk belongs to, which is only read.
+ * @param chunk The chunk to decode.
+ */
+static void RPG_Tilemap_DecodeChunk(RPGtilemap *tilemap, RPGstreamchunk *chunk)
+{
+    tmx_map *map     = tilemap->map;
+    chunk->count     = 0;
+    chunk->instances = NULL;
+    int32_t *gids    = tmx_chunk_decode(chunk->tmx);
+    if (gids == NULL)
+    {
+        fprintf(stderr, "failed to decode tilemap chunk at %d, %d\n", chunk->tmx->x, chunk->tmx->y);
+        return;
+    }
+
+    RPGint size = chunk->tmx->width * chunk->tmx->height;
+    RPGint gid, tileset;
+    for (RPGint i = 0; i < size; i++)
+    {
+        if (RPG_Tilemap_TilesetIndex(tilemap, gids[i]) >= 0)
+        {
+            chunk->count++;
+        }
+    }
+    if (chunk->count > 0)
+    {
+        // Instances are positioned within the chunk, the chunk's position is applied as the layer offset when drawn
+        chunk->instances = RPG_ALLOC_N(RPGtileinstance, chunk->count);
+        RPGtileinstance *instance = chunk->instances;
+        for (RPGint i = 0; i < size; i++)
+        {
+            gid = gids[i];
+            if ((tileset = RPG_Tilemap_TilesetIndex(tilemap, gid)) < 0)
+            {
+                continue;
+            }
+            instance->x     = (GLushort)(i % chunk->tmx->width);
+            instance->y     = (GLushort)(i / chunk->tmx->width);
+            instance->tile  = (GLushort) map->tiles[gid & TMX_FLIP_BITS_REMOVAL]->id;
+            instance->flags = RPG_Tilemap_TileFlags(gid, tileset);
+            instance++;
+        }
+    }
+    tmx_free_func(gids);
+}
+
+/**
+ * @brief The worker thread of an infinite map, decoding requested chunks until stopped.
+ *
+ * @param tilemap The tilemap to decode chunks for.
+ * @return Always 0.
+ */
+static int RPG_Tilemap_Stream(void *tilemap)
+{
+    RPGtilemap *t = tilemap;
+    RPGstreamchunk *chunk;
+    mtx_lock(&t->stream.mutex);
+    while (t->stream.running)
+    {
+        if (t->stream.queueCount == 0)
+        {
+            cnd_wait(&t->stream.signal, &t->stream.mutex);
+            continue;
+        }
+        chunk        = t->stream.queue[--t->stream.queueCount];
+        chunk->state = RPG_STREAM_DECODING;
+        mtx_unlock(&t->stream.mutex);
+
+        RPG_Tilemap_DecodeChunk(t, chunk);
+
+        mtx_lock(&t->stream.mutex);
+        chunk->state = RPG_STREAM_DECODED;
+        RPG_Tilemap_PushChunk(&t->stream.decoded, &t->stream.decodedCount, &t->stream.decodedCapacity, chunk);
+    }
+    mtx_unlock(&t->stream.mutex);
+    return 0;
+}
+
+/**
+ * @brief Removes a chunk from the active chunks of its layer, returning it to the idle state.
+ *
+ * @param chunk The chunk to deactivate.
+ */
+static void RPG_Tilemap_DeactivateChunk(RPGstreamchunk *chunk)
+{
+    RPGstreamlayer *layer = chunk->layer;
+    RPGstreamchunk *moved = layer->active[--layer->activeCount];
+    layer->active[chunk->slot] = moved;
+    moved->slot                = chunk->slot;
+    chunk->slot                = -1;
+    chunk->state               = RPG_STREAM_IDLE;
+    chunk->wanted              = RPG_FALSE;
+}
+
+/**
+ * @brief Updates the chunks of a streamed layer to those within the streaming radius of the view.
+ *
+ * Chunks that move out of range are released, or withdrawn from the worker if they have not been started, and chunks that
+ * move into range are requested from the worker. Must be called while holding the stream's mutex.
+ *
+ * @param l The streamed layer.
+ */
+static void RPG_Tilemap_StreamLayer(RPGlayer *l)
+{
+    RPGtilemap *tilemap    = l->parent;
+    RPGstreamlayer *stream = l->layer.tile->stream;
+    RPGint w               = stream->chunkW * (RPGint) tilemap->map->tile_width;
+    RPGint h               = stream->chunkH * (RPGint) tilemap->map->tile_height;
+    RPGint viewX           = tilemap->base.ox - l->tmx->offsetx - tilemap->stream.radius;
+    RPGint viewY           = tilemap->base.oy - l->tmx->offsety - tilemap->stream.radius;
+    RPGint left            = RPG_Tilemap_FloorDiv(viewX, w);
+    RPGint top             = RPG_Tilemap_FloorDiv(viewY, h);
+    RPGint right           = RPG_Tilemap_FloorDiv(viewX + RPG_GAME->resolution.width + tilemap->stream.radius * 2 - 1, w);
+    RPGint bottom          = RPG_Tilemap_FloorDiv(viewY + RPG_GAME->resolution.height + tilemap->stream.radius * 2 - 1, h);
+
+    // Release the active chunks that are no longer in range, those being decoded are discarded once they are done
+    RPGstreamchunk *chunk;
+    RPGint x, y;
+    for (RPGint i = stream->activeCount - 1; i >= 0; i--)
+    {
+        chunk         = stream->active[i];
+        x             = RPG_Tilemap_FloorDiv(chunk->tmx->x, stream->chunkW);
+        y             = RPG_Tilemap_FloorDiv(chunk->tmx->y, stream->chunkH);
+        chunk->wanted = x >= left && x <= right && y >= top && y <= bottom;
+        if (chunk->wanted)
+        {
+            continue;
+        }
+        if (chunk->state == RPG_STREAM_RESIDENT)
+        {
+            if (chunk->count > 0)
+            {
+                glDeleteVertexArrays(1, &chunk->vao);
+                glDeleteBuffers(1, &chunk->vbo);
+            }
+            RPG_Tilemap_DeactivateChunk(chunk);
+        }
+        else if (chunk->state == RPG_STREAM_QUEUED)
+        {
+            for (RPGint q = 0; q < tilemap->stream.queueCount; q++)
+            {
+                if (tilemap->stream.queue[q] == chunk)
+                {
+                    memmove(&tilemap->stream.queue[q], &tilemap->stream.queue[q + 1],
+                            sizeof(RPGstreamchunk *) * (tilemap->stream.queueCount - q - 1));
+                    tilemap->stream.queueCount--;
+                    break;
+                }
+            }
+            RPG_Tilemap_DeactivateChunk(chunk);
+        }
+    }
+
+    // Request the idle chunks that have come into range
+    RPGint64 key;
+    RPGbool requested = RPG_FALSE;
+    for (y = top; y <= bottom; y++)
+    {
+        for (x = left; x <= right; x++)
+        {
+            key = RPG_Tilemap_ChunkKey(x, y);
+            HASH_FIND(hh, stream->lookup, &key, sizeof(RPGint64), chunk);
+            if (chunk == NULL || chunk->state != RPG_STREAM_IDLE)
+            {
+                continue;
+            }
+            chunk->state  = RPG_STREAM_QUEUED;
+            chunk->wanted = RPG_TRUE;
+            chunk->slot   = stream->activeCount;
+            stream->active[stream->activeCount++] = chunk;
+            RPG_Tilemap_PushChunk(&tilemap->stream.queue, &tilemap->stream.queueCount, &tilemap->stream.queueCapacity, chunk);
+            requested = RPG_TRUE;
+        }
+    }
+    if (requested)
+    {
+        cnd_signal(&tilemap->stream.signal);
+    }
+}
+
+/**
+ * @brief Uploads the chunks decoded by the worker, a few each frame, discarding those no longer in range.
+ *
+ * @param tilemap The tilemap to upload the chunks of.
+ */
+static void RPG_Tilemap_UploadChunks(RPGtilemap *tilemap)
+{
+    mtx_lock(&tilemap->stream.mutex);
+    RPGint count = imin(tilemap->stream.decodedCount, RPG_TILEMAP_STREAM_UPLOADS);
+    RPGstreamchunk *chunk;
+    for (RPGint i = 0; i < count; i++)
+    {
+        chunk = tilemap->stream.decoded[i];
+        if (!chunk->wanted)
+        {
+            RPG_Tilemap_DeactivateChunk(chunk);
+        }
+        else
+        {
+            if (chunk->count > 0)
+            {
+                chunk->vbo = RPG_Drawing_CreateBuffer(sizeof(RPGtileinstance) * chunk->count, chunk->instances, RPG_FALSE);
+                glGenVertexArrays(1, &chunk->vao);
+                RPG_Tilemap_SetupVAO(tilemap, chunk->vao, chunk->vbo, 0);
+            }
+            chunk->state = RPG_STREAM_RESIDENT;
+        }
+        RPG_FREE(chunk->instances);
+        chunk->instances = NULL;
+    }
+    tilemap->stream.decodedCount -= count;
+    memmove(tilemap->stream.decoded, &tilemap->stream.decoded[count], sizeof(RPGstreamchunk *) * tilemap->stream.decodedCount);
+    mtx_unlock(&tilemap->stream.mutex);
+}
+
+/**
+ * @brief Renders a tile layer of an infinite map, drawing each resident chunk within the view.
+ *
+ * @param l The streamed layer to render.
+ */
+static void RPG_Tilemap_RenderStreamLayer(RPGlayer *l)
+{
+    RPGtilemap *tilemap    = l->parent;
+    RPGstreamlayer *stream = l->layer.tile->stream;
+    mtx_lock(&tilemap->stream.mutex);
+    RPG_Tilemap_StreamLayer(l);
+    mtx_unlock(&tilemap->stream.mutex);
+
+    // Chunks in range but outside of the view are only kept ready, the active chunks are only changed by this thread
+    RPGint tw    = (RPGint) tilemap->map->tile_width;
+    RPGint th    = (RPGint) tilemap->map->tile_height;
+    RPGint viewX = tilemap->base.ox - l->tmx->offsetx;
+    RPGint viewY = tilemap->base.oy - l->tmx->offsety;
+    RPG_Drawing_UseProgram(tilemap->shader.program);
+    RPG_Tilemap_SetupTileLayer(l, &tilemap->shader);
+
+    RPGstreamchunk *chunk;
+    RPGint x, y;
+    for (RPGint i = 0; i < stream->activeCount; i++)
+    {
+        chunk = stream->active[i];
+        if (chunk->state != RPG_STREAM_RESIDENT || chunk->count == 0)
+        {
+            continue;
+        }
+        x = chunk->tmx->x * tw;
+        y = chunk->tmx->y * th;
+        if (x >= viewX + RPG_GAME->resolution.width || y >= viewY + RPG_GAME->resolution.height || x + chunk->tmx->width * tw <= viewX ||
+            y + chunk->tmx->height * th <= viewY)
+        {
+            continue;
+        }
+        glUniform2f(tilemap->shader.offset, (GLfloat)(x + l->tmx->offsetx), (GLfloat)(y + l->tmx->offsety));
+        glBindVertexArray(chunk->vao);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, chunk->count);
+    }
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+}
+
+/**
+ * @brief Renders a tile layer with a single quad covering the view, looking up the tile of each pixel from the index texture.
+ *
+ * @param l The layer to render.
+ */
+static void RPG_Tilemap_RenderIndexedLayer(RPGlayer *l)
+{
+    RPGtilemap *tilemap = l->parent;
+    RPGtilelayer *tiles = l->layer.tile;
+
+    // Skip the layer when it lies entirely outside of the view
+    RPGint viewX = tilemap->base.ox - l->tmx->offsetx;
+    RPGint viewY = tilemap->base.oy - l->tmx->offsety;
+    if (viewX >= (RPGint) tilemap->pxWidth || viewY >= (RPGint) tilemap->pxHeight || viewX + RPG_GAME->resolution.width <= 0 ||
+        viewY + RPG_GAME->resolution.height <= 0)
+    {
+        return;
+    }
+
+    RPG_Drawing_UseProgram(tilemap->indexed.program);
+    RPG_Tilemap_SetupTileLayer(l, &tilemap->indexed);
+    glUniform2f(tilemap->indexed.viewSize, (GLfloat) RPG_GAME->resolution.width, (GLfloat) RPG_GAME->resolution.height);
+    RPG_Drawing_BindTexture(tiles->indices, GL_TEXTURE2);
+
+    // The quad is generated from the vertex index, so any vertex array will do
+    glBindVertexArray(tiles->vao);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+}
+
+/**
+ * @brief Renders a tile layer.
+ *
+ * @param layer A pointer to the layer, can be cast to an RPGlayer structure.
+ */
+static void RPG_Tilemap_RenderTileLayer(void *layer)
+{
+    RPGlayer *l         = (RPGlayer *) layer;
+    RPGtilelayer *tiles = l->layer.tile;
+    RPGtilemap *tilemap = l->parent;
+    if (tiles->stream != NULL)
+    {
+        RPG_Tilemap_RenderStreamLayer(l);
+        return;
+    }
+    if (tiles->baked)
+    {
+        RPG_Tilemap_RenderBakedLayer(l);
+        return;
+    }
+    if (tiles->instanceCount == 0)
+    {
+        return;
+    }
+    if (tiles->mode == RPG_TILEMAP_MODE_INDEXED)
+    {
+        RPG_Tilemap_RenderIndexedLayer(l);
+        return;
+    }
+
+    RPG_Drawing_UseProgram(tilemap->shader.program);
+    RPG_Tilemap_SetupTileLayer(l, &tilemap->shader);
+    RPG_Tilemap_DrawChunks(l, tilemap->base.ox, tilemap->base.oy, RPG_GAME->resolution.width, RPG_GAME->resolution.height);
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+}
+
+/**
+ * @brief Renders an image layer.
+ *
+ * @param layer A pointer to the layer, can be cast to an RPGlayer structure.
+ */
+static void RPG_Tilemap_RenderImageLayer(void *layer)
+{
+    RPGlayer *l = (RPGlayer *) layer;
+
+    RPG_Drawing_UseProgram(l->parent->shader.program);
+    RPG_Drawing_SetBlending(l->parent->base.blend.op, l->parent->base.blend.src, l->parent->base.blend.dst);
+
+    glUniform1f(l->parent->shader.alpha, l->parent->base.alpha * (GLfloat) l->tmx->opacity);
+
+    // Drawn as a single tile the size of the image at the layer's offset, using the tileset slot reserved for image layers
+    RPGimage *image = l->layer.image->image;
+    GLint slot      = RPG_TILEMAP_MAX_TILESETS - 1;
+    glUniform2f(l->parent->shader.offset, (GLfloat) l->tmx->offsetx, (GLfloat) l->tmx->offsety);
+    glUniform2f(l->parent->shader.cellSize, (GLfloat) image->width, (GLfloat) image->height);
+    glUniform2f(l->parent->shader.imageSize, (GLfloat) image->width, (GLfloat) image->height);
+    glUniform4f(l->parent->shader.tilesets + slot, 0.0f, 0.0f, (GLfloat) image->width, (GLfloat) image->height);
+    glUniform4i(l->parent->shader.layouts + slot, 1, 0, 0, 0);
+
+    // Bind tileset texture
+    glUniform1i(l->parent->shader.animated, RPG_FALSE);
+    RPG_Drawing_BindTexture(image->texture, GL_TEXTURE0);
+    glBindVertexArray(l->layer.image->vao);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, 1);
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+}
+
+/**
+ * @brief Render function for a tilemap. Does not actually render, as layers are independent, only configures shader uniforms.
+ *
+ * @param tilemap A pointer to the RPGtilemap layer struct to render.
+ */
+static void RPG_Tilemap_Render(void *tilemap)
+{
+    RPGtilemap *t = tilemap;
+    // Skip if tilemap is not visible
+    if (!t->base.renderable.visible || t->base.alpha < __FLT_EPSILON__)
+    {
+        return;
+    }
+
+    // Update tilemap model matrix if changed since last render
+    if (t->base.updated)
+    {
+        // Set model matrix for tilemap, which is actually a projection matrix for the layers
+        RPG_MAT4_ORTHO(t->base.model, 0.0f, RPG_GAME->resolution.width, RPG_GAME->resolution.height, 0.0f, -1.0f, 1.0f);
+    }
+
+    // Setup shared shader uniforms of each program, the indexed program is only created once a layer uses it
+    RPG_Tilemap_UpdateShader(t, &t->shader, t->base.updated);
+    if (t->indexed.program != 0)
+    {
+        RPG_Tilemap_UpdateShader(t, &t->indexed, t->base.updated);
+    }
+    t->base.updated = RPG_FALSE;
+
+    // Upload the chunks of infinite maps decoded since the last frame
+    if (t->map->infinite)
+    {
+        RPG_Tilemap_UploadChunks(t);
+    }
+
+    // Upload the tiles changed since the last frame
+    if (t->edited)
+    {
+        RPG_Tilemap_FlushEdits(t);
+    }
+
+    // No actual rendering, just update shader uniforms and ortho if needed
+    RPG_Drawing_UseProgram(RPG_GAME->shader.program);
+}
+
+/****************************************************************************************
+ * Initialization
+ ****************************************************************************************/
+
+/**
+ * @brief Creates the index texture of a tile layer, storing the tile index and flags of each cell in a texel.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param l The tile layer to create the index texture for.
+ */
+static void RPG_Tilemap_CreateIndices(RPGtilemap *tilemap, RPGlayer *l)
+{
+    tmx_map *map     = tilemap->map;
+    RPGuint count    = map->width * map->height;
+    GLushort *texels = RPG_ALLOC_N(GLushort, count * 2);
+
+    for (RPGuint i = 0; i < count; i++)
+    {
+        RPG_Tilemap_CellTexel(tilemap, l->tmx->content.gids[i], &texels[i * 2]);
+    }
+
+    GLuint texture = RPG_Drawing_CreateTexture(map->width, map->height, GL_RG16UI, GL_RG_INTEGER, NULL, GL_CLAMP_TO_EDGE, GL_NEAREST);
+    RPG_Drawing_BindTexture(texture, GL_TEXTURE0);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, map->width, map->height, GL_RG_INTEGER, GL_UNSIGNED_SHORT, texels);
+    l->layer.tile->indices = texture;
+    RPG_FREE(texels);
+}
+
+static RPGtilelayer *RPG_Tilemap_CreateTileLayer(RPGtilemap *tilemap, tmx_map *map, tmx_layer *layer)
+{
+    // Initialize tile layer struct and storage for tiles
+    RPG_ALLOC_ZERO(tilelayer, RPGtilelayer);
+    tilelayer->tileCount = map->width * map->height;
+    tilelayer->tiles     = RPG_MALLOC(sizeof(RPGtile) * tilelayer->tileCount);
+    memset(tilelayer->tiles, 0, sizeof(RPGtile) * tilelayer->tileCount);
+
+    // Only the non-empty tiles within each chunk are given an instance, and chunks are stored in row-major order
+    tilelayer->chunksX = ((RPGint) map->width + RPG_TILEMAP_CHUNK_SIZE - 1) / RPG_TILEMAP_CHUNK_SIZE;
+    tilelayer->chunksY = ((RPGint) map->height + RPG_TILEMAP_CHUNK_SIZE - 1) / RPG_TILEMAP_CHUNK_SIZE;
+    tilelayer->chunks  = RPG_ALLOC_N(RPGint, tilelayer->chunksX * tilelayer->chunksY + 1);
+    RPG_Tilemap_LayoutTileLayer(tilemap, tilelayer, layer);
+
+    glGenVertexArrays(1, &tilelayer->vao);
+    RPG_Tilemap_SetupVAO(tilemap, tilelayer->vao, tilelayer->vbo, 0);
+    return tilelayer;
+}
+
+/**
+ * @brief Creates a tile layer of an infinite map, whose chunks are streamed in as they near the view.
+ *
+ * @param layer The TMX layer, with its chunks still encoded.
+ * @return The created tile layer.
+ */
+static RPGtilelayer *RPG_Tilemap_CreateStreamLayer(tmx_layer *layer)
+{
+    RPG_ALLOC_ZERO(tilelayer, RPGtilelayer);
+    RPG_ALLOC_ZERO(stream, RPGstreamlayer);
+    tilelayer->stream = stream;
+
+    // Tiled gives every chunk of a map the same size, aligned to a grid of that size
+    RPGint count = 0;
+    for (tmx_chunk *c = layer->chunk_head; c != NULL; c = c->next)
+    {
+        count++;
+    }
+    stream->chunkW = layer->chunk_head ? imax(1, layer->chunk_head->width) : 16;
+    stream->chunkH = layer->chunk_head ? imax(1, layer->chunk_head->height) : 16;
+    stream->chunks = RPG_ALLOC_N(RPGstreamchunk, imax(count, 1));
+    stream->active = RPG_ALLOC_N(RPGstreamchunk *, imax(count, 1));
+    memset(stream->chunks, 0, sizeof(RPGstreamchunk) * imax(count, 1));
+
+    RPGstreamchunk *chunk = stream->chunks;
+    for (tmx_chunk *c = layer->chunk_head; c != NULL; c = c->next, chunk++)
+    {
+        chunk->tmx   = c;
+        chunk->layer = stream;
+        chunk->slot  = -1;
+        chunk->key   = RPG_Tilemap_ChunkKey(RPG_Tilemap_FloorDiv(c->x, stream->chunkW), RPG_Tilemap_FloorDiv(c->y, stream->chunkH));
+        HASH_ADD(hh, stream->lookup, key, sizeof(RPGint64), chunk);
+    }
+    return tilelayer;
+}
+
+static RPGimagelayer *RPG_Tilemap_CreateImageLayer(RPGtilemap *tilemap, tmx_layer *layer)
+{
+
+    RPGimagelayer *l = RPG_ALLOC(RPGimagelayer);
+    l->image         = layer->content.image->resource_image;
+    RPG_ASSERT(l->image);
+
+    // The image is a single tile covering the first cell, sized and offset by uniforms when rendered
+    RPGtileinstance obj = {0, 0, 0, (RPG_TILEMAP_MAX_TILESETS - 1) << 3};
+    l->vbo              = RPG_Drawing_CreateBuffer(sizeof(RPGtileinstance), &obj, RPG_FALSE);
+    glGenVertexArrays(1, &l->vao);
+    RPG_Tilemap_SetupVAO(tilemap, l->vao, l->vbo, 0);
+    return l;
 }
 
 static RPGobjectlayer *RPG_Tilemap_CreateObjectLayer(tmx_map *map, tmx_layer *layer) { return NULL; }
 
 static RPGgrouplayer *RPG_Tilemap_CreateGroupLayer(tmx_map *map, tmx_layer *layer) { return NULL; }
 
-static void RPG_Tilemap_Initialize(tmx_map *map, RPGviewport *viewport, RPGtilemap **tilemap)
+/**
+ * @brief Deletes a tilemap program, clearing it from the program cache.
+ *
+ * @param shader The program to delete.
+ */
+static void RPG_Tilemap_DeleteShader(RPGtileshader *shader)
+{
+    if (shader->program != 0)
+    {
+        if (_program == shader->program)
+        {
+            _program = 0;
+        }
+        glDeleteProgram(shader->program);
+    }
+}
+
+/**
+ * @brief Creates a tilemap from a loaded map.
+ *
+ * @param map The map to create the tilemap from, which is owned by the tilemap on success and left to the caller otherwise.
+ * @param viewport The viewport the tilemap is rendered within, or NULL.
+ * @param tilemap Receives the created tilemap.
+ * @return RPG_NO_ERROR on success, otherwise RPG_ERR_OUT_OF_RANGE if the tilesets do not fit within a single texture.
+ */
+static RPG_RESULT RPG_Tilemap_Initialize(tmx_map *map, RPGviewport *viewport, RPGtilemap **tilemap)
 {
     RPG_ALLOC_ZERO(tm, RPGtilemap);
     RPGbatch *batch = viewport ? &viewport->batch : &RPG_GAME->batch;
     RPG_BasicSprite_Init(&tm->base, RPG_Tilemap_Render, batch);
-    RPG_Tilemap_CreateShader(tm);
+    RPG_Tilemap_CreateShader(tm, &tm->shader, RPG_TILEMAP_VERTEX, RPG_TILEMAP_FRAGMENT);
 
     // Store the map, count the layers, and allocate memory for them
     tm->map      = map;
     tm->pxWidth  = map->width * map->tile_width;
     tm->pxHeight = map->height * map->tile_height;
     RPG_Batch_Init(&tm->layers);
+    tm->bakeBudget = RPG_TILEMAP_BAKE_BUDGET;
+
+    // Pack the tilesets before the layers, and the worker, which read the index of each tile's tileset
+    RPG_Tilemap_AssignTilesets(tm);
+    RPG_RESULT result = RPG_Tilemap_CreateAtlas(tm);
+    if (result)
+    {
+        RPG_Renderable_Free(&tm->base.renderable);
+        RPG_Tilemap_DeleteShader(&tm->shader);
+        RPG_Batch_Free(&tm->layers);
+        RPG_FREE(tm->slots);
+        RPG_FREE(tm);
+        return result;
+    }
+    RPG_Tilemap_CreateFrames(tm);
+
+    // The chunks of infinite maps are decoded on a worker thread as they near the view
+    tm->stream.radius = RPG_TILEMAP_STREAM_RADIUS;
+    if (map->infinite)
+    {
+        mtx_init(&tm->stream.mutex, mtx_plain);
+        cnd_init(&tm->stream.signal);
+        tm->stream.running = RPG_TRUE;
+        if (thrd_create(&tm->stream.thread, RPG_Tilemap_Stream, tm) != thrd_success)
+        {
+            fprintf(stderr, "failed to create tilemap streaming thread\n");
+            tm->stream.running = RPG_FALSE;
+        }
+    }
 
     // Enumerate each layer
     int index = 0;
@@ -440,7 +2105,7 @@ static void RPG_Tilemap_Initialize(tmx_map *map, RPGviewport *viewport, RPGtilem
         {
             case L_LAYER:
             {
-                base->layer.tile = RPG_Tilemap_CreateTileLayer(tm, map, layer);
+                base->layer.tile = map->infinite ? RPG_Tilemap_CreateStreamLayer(layer) : RPG_Tilemap_CreateTileLayer(tm, map, layer);
                 RPG_Renderable_Init(&base->renderable, RPG_Tilemap_RenderTileLayer, batch);
                 break;
             }
@@ -467,63 +2132,204 @@ static void RPG_Tilemap_Initialize(tmx_map *map, RPGviewport *viewport, RPGtilem
             }
         }
         base->parent             = tm;
+        base->index              = index;
         base->renderable.visible = (RPGbool) layer->visible;
         base->renderable.z       = index * RPG_LAYER_OFFSET;
         RPG_Batch_Add(&tm->layers, &base->renderable);
     }
     *tilemap = tm;
+    return RPG_NO_ERROR;
 }
 
 tmx_resource_manager *TEST;  // FIXME:
 
 RPG_RESULT RPG_Tilemap_Create(const void *buffer, RPGsize size, RPGviewport *viewport, RPGtilemap **tilemap)
 {
-
-    if (tmx_alloc_func == NULL)
-    {
-        tmx_alloc_func    = RPG_REALLOC;
-        tmx_free_func     = RPG_FREE;
-        tmx_img_load_func = RPG_Tilemap_ImageLoad;
-        tmx_img_free_func = RPG_Tilemap_ImageFree;
-    }
+    RPG_Tilemap_SetupLoader();
+    mtx_lock(&loadMutex);
     tmx_map *map = tmx_rcmgr_load_buffer(TEST, buffer, (int) size);
+    mtx_unlock(&loadMutex);
     // tmx_map *map = tmx_load_buffer(buffer, (int) size);
     if (map == NULL)
     {
         return RPG_ERR_UNKNOWN;
     }
-    RPG_Tilemap_Initialize(map, viewport, tilemap);
-    return RPG_NO_ERROR;
+    RPG_RESULT result = RPG_Tilemap_Initialize(map, viewport, tilemap);
+    if (result)
+    {
+        tmx_map_free(map);
+    }
+    return result;
 }
 
 RPG_RESULT RPG_Tilemap_CreateFromFile(const char *path, RPGviewport *viewport, RPGtilemap **tilemap)
 {
-    RPG_ENSURE_FILE(path);
-
-    if (TEST == NULL)
+    RPG_ENSURE_FILE(path);
+
+    RPG_Tilemap_SetupLoader();
+    if (TEST == NULL)
+    {
+        TEST = tmx_make_resource_manager();
+    }
+    mtx_lock(&loadMutex);
+    tmx_map *map = tmx_rcmgr_load(TEST, path);
+    mtx_unlock(&loadMutex);
+    // tmx_map *map = tmx_load(path);
+    if (map == NULL)
+    {
+        return RPG_ERR_UNKNOWN;
+    }
+    RPG_RESULT result = RPG_Tilemap_Initialize(map, viewport, tilemap);
+    if (result)
+    {
+        tmx_map_free(map);
+    }
+    return result;
+}
+
+void RPG_Tilemap_SetupLoader(void)
+{
+    if (loaderReady)
+    {
+        return;
+    }
+    loaderReady       = RPG_TRUE;
+    tmx_alloc_func    = RPG_REALLOC;
+    tmx_free_func     = RPG_FREE;
+    tmx_img_load_func = RPG_Tilemap_ImageLoad;
+    tmx_img_free_func = RPG_Tilemap_ImageFree;
+
+    // libxml2 must be initialized once before parsing on more than one thread
+    xmlInitParser();
+    mtx_init(&loadMutex, mtx_plain);
+}
+
+struct _tmx_map *RPG_Tilemap_LoadMap(const char *path)
+{
+    // The resource manager is not safe to use from a worker, so maps loaded in the background do not share tilesets
+    deferImages = RPG_TRUE;
+    mtx_lock(&loadMutex);
+    tmx_map *map = tmx_load(path);
+    mtx_unlock(&loadMutex);
+    deferImages = RPG_FALSE;
+    return map;
+}
+
+RPG_RESULT RPG_Tilemap_CreateFromMap(struct _tmx_map *map, RPGviewport *viewport, RPGtilemap **tilemap)
+{
+    RPG_RETURN_IF_NULL(map);
+    RPG_Tilemap_ResolveImages(map, RPG_TRUE);
+    return RPG_Tilemap_Initialize(map, viewport, tilemap);
+}
+
+void RPG_Tilemap_DiscardMap(struct _tmx_map *map)
+{
+    if (map != NULL)
+    {
+        RPG_Tilemap_ResolveImages(map, RPG_FALSE);
+        tmx_map_free(map);
+    }
+}
+
+/**
+ * @brief Frees the GPU resources and storage of a tile layer.
+ *
+ * @param tiles The layer to free.
+ */
+static void RPG_Tilemap_FreeTileLayer(RPGtilelayer *tiles)
+{
+    RPGstreamlayer *stream = tiles->stream;
+    if (stream != NULL)
     {
-        TEST              = tmx_make_resource_manager();
-        tmx_alloc_func    = RPG_REALLOC;
-        tmx_free_func     = RPG_FREE;
-        tmx_img_load_func = RPG_Tilemap_ImageLoad;
-        tmx_img_free_func = RPG_Tilemap_ImageFree;
+        // The worker has been stopped, so every active chunk is either resident or waiting to be uploaded
+        RPGstreamchunk *chunk;
+        for (RPGint i = 0; i < stream->activeCount; i++)
+        {
+            chunk = stream->active[i];
+            if (chunk->state == RPG_STREAM_RESIDENT && chunk->count > 0)
+            {
+                glDeleteVertexArrays(1, &chunk->vao);
+                glDeleteBuffers(1, &chunk->vbo);
+            }
+            RPG_FREE(chunk->instances);
+        }
+        HASH_CLEAR(hh, stream->lookup);
+        RPG_FREE(stream->chunks);
+        RPG_FREE(stream->active);
+        RPG_FREE(stream);
     }
-    tmx_map *map = tmx_rcmgr_load(TEST, path);
-    // tmx_map *map = tmx_load(path);
-    if (map == NULL)
+    else
     {
-        return RPG_ERR_UNKNOWN;
+        glDeleteVertexArrays(1, &tiles->vao);
+        glDeleteBuffers(1, &tiles->vbo);
+        if (tiles->indices != 0)
+        {
+            RPG_Drawing_DeleteTexture(tiles->indices);
+        }
+        RPG_FREE(tiles->tiles);
+        RPG_FREE(tiles->chunks);
+        RPG_FREE(tiles->edits);
     }
-    RPG_Tilemap_Initialize(map, viewport, tilemap);
-    return RPG_NO_ERROR;
+    RPG_FREE(tiles);
 }
 
 RPG_RESULT RPG_Tilemap_Free(RPGtilemap *tilemap)
 {
     if (tilemap != NULL)
     {
+        // Stop the worker before anything it may be decoding is freed
+        if (tilemap->map->infinite)
+        {
+            mtx_lock(&tilemap->stream.mutex);
+            RPGbool running         = tilemap->stream.running;
+            tilemap->stream.running = RPG_FALSE;
+            cnd_signal(&tilemap->stream.signal);
+            mtx_unlock(&tilemap->stream.mutex);
+            if (running)
+            {
+                thrd_join(tilemap->stream.thread, NULL);
+            }
+            mtx_destroy(&tilemap->stream.mutex);
+            cnd_destroy(&tilemap->stream.signal);
+            RPG_FREE(tilemap->stream.queue);
+            RPG_FREE(tilemap->stream.decoded);
+        }
+
+        // Remove each layer from the batch it is rendered in, and free its resources
+        RPG_Tilemap_FreeBakes(tilemap);
+        RPGlayer *l;
+        for (RPGint i = 0; i < tilemap->layers.total; i++)
+        {
+            l = (RPGlayer *) tilemap->layers.items[i];
+            RPG_Renderable_Free(&l->renderable);
+            if (l->type == L_LAYER)
+            {
+                RPG_Tilemap_FreeTileLayer(l->layer.tile);
+            }
+            else if (l->type == L_IMAGE)
+            {
+                glDeleteVertexArrays(1, &l->layer.image->vao);
+                glDeleteBuffers(1, &l->layer.image->vbo);
+                RPG_FREE(l->layer.image);
+            }
+            RPG_FREE(l);
+        }
+        RPG_Batch_Free(&tilemap->layers);
+
+        RPG_BasicSprite_Detach(&tilemap->base);
+        RPG_Renderable_Free(&tilemap->base.renderable);
+        RPG_Tilemap_DeleteShader(&tilemap->shader);
+        RPG_Tilemap_DeleteShader(&tilemap->indexed);
+        if (tilemap->frames != 0)
+        {
+            glDeleteTextures(1, &tilemap->frames);
+            glDeleteBuffers(1, &tilemap->frameBuffer);
+        }
+        RPG_Image_Free(tilemap->atlas);
+        RPG_FREE(tilemap->slots);
 
-        // TODO:
+        // Maps loaded through the shared resource manager keep their tilesets, which are owned by the manager
+        tmx_map_free(tilemap->map);
         RPG_FREE(tilemap);
     }
     return RPG_NO_ERROR;
@@ -533,82 +2339,97 @@ RPG_RESULT RPG_Tilemap_Free(RPGtilemap *tilemap)
  * Updating
  ****************************************************************************************/
 
-static void RPG_Tilemap_UpdateTileLayer(RPGtilemap *map, RPGtilelayer *layer, tmx_layer *tmx)
+RPG_RESULT RPG_Tilemap_Update(RPGtilemap *tilemap)
 {
+    RPG_RETURN_IF_NULL(tilemap);
+    RPG_BasicSprite_Update(&tilemap->base);
 
-    // Declare variable storage;
-    tmx_tile *next;
-    tmx_anim_frame *frame;
-    RPGtile *tile;
-    RPGvertexdata *ptr;
-    RPGbool bound = RPG_FALSE;
+    // Tile animations are resolved by the shader, and require no updating
+    return RPG_NO_ERROR;
+}
 
-    // Get the current time
-    RPGdouble time = glfwGetTime();
+/****************************************************************************************
+ * Public Getters/Setters
+ ****************************************************************************************/
 
-    // Enumerate through tiles of layer
-    for (RPGuint i = 0; i < layer->tileCount; i++)
+/**
+ * @brief Tests if a tile has a property that evaluates as true.
+ *
+ * @param tile The tile to test, or NULL.
+ * @param property The name of the property.
+ * @return RPGbool RPG_TRUE if the property exists and is non-zero, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_Tilemap_HasFlag(tmx_tile *tile, const char *property)
+{
+    if (tile == NULL || tile->properties == NULL)
     {
-        tile = &layer->tiles[i];
-
-        // If tile is defined and is time has been reached for a tile change
-        if (tile->tmx && tile->tmx->animation_len > 0 && tile->anime.delta < time)
-        {
-
-            // Increment the current index, and get the next frame
-            tile->anime.index = (tile->anime.index + 1) % tile->tmx->animation_len;
-            frame             = &tile->tmx->animation[tile->anime.index];
-            next              = &tile->tmx->tileset->tiles[frame->tile_id];
-
-            // left/top/right/bottom in normalized texture coordinates
-            GLfloat l = RPG_Drawing_GetUV(next->ul_x, layer->image->width);
-            GLfloat t = RPG_Drawing_GetUV(next->ul_y, layer->image->height);
-            GLfloat r = RPG_Drawing_GetUV(next->ul_x + next->tileset->tile_width - 1, layer->image->width);
-            GLfloat b = RPG_Drawing_GetUV(next->ul_y + next->tileset->tile_height - 1, layer->image->height);
-
-            // Buffer the new data, and set the next target time for an animation
-            tile->anime.delta = time + (frame->duration * 0.001);
-            if (!bound)
-            {
-                // Lazy-bind the buffer only if needed
-                glBindBuffer(GL_ARRAY_BUFFER, layer->vbo);
-                ptr   = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-                bound = RPG_TRUE;
-            }
-
-            // Update the vertices directly in the VBO
-            RPG_Tilemap_SetVertices(l, t, r, b, next->id, ptr[i].vertices);
-        }
+        return RPG_FALSE;
+    }
+    tmx_property *prop = tmx_get_property(tile->properties, property);
+    if (prop == NULL)
+    {
+        return RPG_FALSE;
     }
-    if (bound)
+    switch (prop->type)
     {
-        // Unmap our pointer if buffer was bound
-        glUnmapBuffer(GL_ARRAY_BUFFER);
+        case PT_INT:
+        case PT_BOOL: return prop->value.integer != 0;
+        case PT_FLOAT: return prop->value.decimal != 0.0f;
+        default: return RPG_TRUE;
     }
 }
 
-RPG_RESULT RPG_Tilemap_Update(RPGtilemap *tilemap)
+RPGint RPG_Tilemap_FindTiles(RPGtilemap *tilemap, const char *property, RPGvec4 **rects)
 {
-    RPG_RETURN_IF_NULL(tilemap);
-    RPG_BasicSprite_Update(&tilemap->base);
+    tmx_map *map    = tilemap->map;
+    RPGint count    = 0;
+    RPGint capacity = 16;
+    RPGvec4 *result = RPG_ALLOC_N(RPGvec4, capacity);
 
-    RPGlayer *layer;
-    for (RPGuint i = 0; i < tilemap->layers.total; i++)
+    for (tmx_layer *layer = map->ly_head; layer != NULL; layer = layer->next)
     {
-        layer = (RPGlayer *) tilemap->layers.items[i];
-        if (layer->type == L_LAYER)
+        // The chunks of infinite maps are only decoded while near the view, so they cannot be searched
+        if (layer->type != L_LAYER || layer->content.gids == NULL)
         {
-            RPG_Tilemap_UpdateTileLayer(tilemap, layer->layer.tile, layer->tmx);
+            continue;
+        }
+        for (RPGuint mapY = 0; mapY < map->height; mapY++)
+        {
+            // Merge horizontal runs of flagged tiles into a single rectangle
+            RPGint start = -1;
+            for (RPGuint mapX = 0; mapX <= map->width; mapX++)
+            {
+                RPGbool flagged = RPG_FALSE;
+                if (mapX < map->width)
+                {
+                    RPGint gid = layer->content.gids[mapX + (mapY * map->width)] & TMX_FLIP_BITS_REMOVAL;
+                    flagged    = gid != 0 && RPG_Tilemap_HasFlag(map->tiles[gid], property);
+                }
+                if (flagged && start < 0)
+                {
+                    start = (RPGint) mapX;
+                }
+                else if (!flagged && start >= 0)
+                {
+                    if (count == capacity)
+                    {
+                        capacity *= 2;
+                        result = RPG_REALLOC(result, sizeof(RPGvec4) * capacity);
+                    }
+                    result[count].x = (RPGfloat)(start * (RPGint) map->tile_width + layer->offsetx);
+                    result[count].y = (RPGfloat)((RPGint)(mapY * map->tile_height) + layer->offsety);
+                    result[count].z = (RPGfloat)((mapX - start) * map->tile_width);
+                    result[count].w = (RPGfloat) map->tile_height;
+                    count++;
+                    start = -1;
+                }
+            }
         }
     }
-
-    return RPG_NO_ERROR;
+    *rects = result;
+    return count;
 }
 
-/****************************************************************************************
- * Public Getters/Setters
- ****************************************************************************************/
-
 RPG_RESULT RPG_Tilemap_GetSize(RPGtilemap *tilemap, RPGint *width, RPGint *height)
 {
     RPG_RETURN_IF_NULL(tilemap);
@@ -707,6 +2528,330 @@ RPG_RESULT RPG_Tilemap_SetLayerAlpha(RPGtilemap *tilemap, RPGint layer, RPGfloat
     }
     RPGlayer *l     = (RPGlayer *) tilemap->layers.items[layer];
     l->tmx->opacity = RPG_CLAMPF(alpha, 0.0f, 1.0f);
+    if (RPG_Tilemap_IsBaked(&l->renderable))
+    {
+        RPG_Tilemap_FreeBakes(tilemap);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetLayerMode(RPGtilemap *tilemap, RPGint layer, RPG_TILEMAP_MODE *mode)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (layer < 0 || layer >= tilemap->layers.total)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGlayer *l = (RPGlayer *) tilemap->layers.items[layer];
+    if (l->type != L_LAYER)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (mode != NULL)
+    {
+        *mode = l->layer.tile->mode;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetLayerMode(RPGtilemap *tilemap, RPGint layer, RPG_TILEMAP_MODE mode)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (layer < 0 || layer >= tilemap->layers.total)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGlayer *l = (RPGlayer *) tilemap->layers.items[layer];
+    if (l->type != L_LAYER || l->layer.tile->stream != NULL || mode < RPG_TILEMAP_MODE_INSTANCED || mode > RPG_TILEMAP_MODE_INDEXED)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (mode == RPG_TILEMAP_MODE_INDEXED)
+    {
+        // The program and index texture are only created once needed, and kept for switching back and forth
+        if (tilemap->indexed.program == 0)
+        {
+            RPG_Tilemap_CreateShader(tilemap, &tilemap->indexed, RPG_TILEMAP_INDEXED_VERTEX, RPG_TILEMAP_INDEXED_FRAGMENT);
+        }
+        if (l->layer.tile->indices == 0)
+        {
+            RPG_Tilemap_CreateIndices(tilemap, l);
+        }
+    }
+    l->layer.tile->mode = mode;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetLayerBaked(RPGtilemap *tilemap, RPGint layer, RPGbool *baked)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (layer < 0 || layer >= tilemap->layers.total)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (baked != NULL)
+    {
+        *baked = RPG_Tilemap_IsBaked(tilemap->layers.items[layer]);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetLayerBaked(RPGtilemap *tilemap, RPGint layer, RPGbool baked)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (layer < 0 || layer >= tilemap->layers.total)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGlayer *l = (RPGlayer *) tilemap->layers.items[layer];
+    if (l->type != L_LAYER || l->layer.tile->stream != NULL)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (l->layer.tile->baked != (baked != RPG_FALSE))
+    {
+        // Runs are formed from adjacent baked layers, so changing one may split or join the runs around it
+        RPG_Tilemap_FreeBakes(tilemap);
+        l->layer.tile->baked = baked != RPG_FALSE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetBakeBudget(RPGtilemap *tilemap, RPGsize *bytes)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (bytes != NULL)
+    {
+        *bytes = tilemap->bakeBudget;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetBakeBudget(RPGtilemap *tilemap, RPGsize bytes)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    tilemap->bakeBudget = bytes;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetStreamRadius(RPGtilemap *tilemap, RPGint *radius)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (radius != NULL)
+    {
+        *radius = tilemap->stream.radius;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetStreamRadius(RPGtilemap *tilemap, RPGint radius)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (radius < 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    tilemap->stream.radius = radius;
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Retrieves a tile layer whose tiles can be read and changed.
+ *
+ * @param tilemap The tilemap the layer belongs to.
+ * @param layer The index of the layer.
+ * @param l Receives the layer.
+ * @return RPG_NO_ERROR on success, RPG_ERR_OUT_OF_RANGE for an invalid index, or RPG_ERR_INVALID_VALUE if the layer is not a
+ * tile layer, or is streamed.
+ */
+static RPG_RESULT RPG_Tilemap_GetTileLayer(RPGtilemap *tilemap, RPGint layer, RPGlayer **l)
+{
+    if (layer < 0 || layer >= tilemap->layers.total)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    *l = (RPGlayer *) tilemap->layers.items[layer];
+    if ((*l)->type != L_LAYER || (*l)->layer.tile->stream != NULL)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+/**
+ * @brief Checks if a global tile ID refers to a tile of the map, or is empty.
+ *
+ * @param map The map.
+ * @param gid The global ID of the tile, with or without flip flags.
+ * @return RPG_TRUE if the ID can be placed in a cell, otherwise RPG_FALSE.
+ */
+static inline RPGbool RPG_Tilemap_ValidTile(tmx_map *map, RPGint gid)
+{
+    RPGuint id = (RPGuint) gid & TMX_FLIP_BITS_REMOVAL;
+    return id == 0 || (id < map->tilecount && map->tiles[id] != NULL);
+}
+
+/**
+ * @brief Changes the tile of a cell, flagging its chunk to be uploaded before the next frame.
+ *
+ * The TMX layer is changed as well, so that searches of tile properties find the new tile.
+ *
+ * @param l The tile layer.
+ * @param x The column of the cell.
+ * @param y The row of the cell.
+ * @param gid The global ID of the tile with its flip flags, or 0 to clear the cell.
+ */
+static void RPG_Tilemap_WriteTile(RPGlayer *l, RPGint x, RPGint y, RPGint gid)
+{
+    RPGtilemap *tilemap = l->parent;
+    RPGtilelayer *tiles = l->layer.tile;
+    RPGint index        = x + y * (RPGint) tilemap->map->width;
+    if (l->tmx->content.gids[index] == gid)
+    {
+        return;
+    }
+    l->tmx->content.gids[index] = gid;
+    if (tiles->edits == NULL)
+    {
+        tiles->edits = RPG_ALLOC_N(RPGubyte, tiles->chunksX * tiles->chunksY);
+        memset(tiles->edits, 0, sizeof(RPGubyte) * tiles->chunksX * tiles->chunksY);
+    }
+    tiles->edits[(y / RPG_TILEMAP_CHUNK_SIZE) * tiles->chunksX + (x / RPG_TILEMAP_CHUNK_SIZE)] |= RPG_TILEMAP_CHUNK_DIRTY;
+    tilemap->edited = RPG_TRUE;
+}
+
+RPG_RESULT RPG_Tilemap_GetTile(RPGtilemap *tilemap, RPGint layer, RPGint x, RPGint y, RPGint *gid)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    RPGlayer *l;
+    RPG_RESULT result = RPG_Tilemap_GetTileLayer(tilemap, layer, &l);
+    if (result != RPG_NO_ERROR)
+    {
+        return result;
+    }
+    if (x < 0 || y < 0 || x >= (RPGint) tilemap->map->width || y >= (RPGint) tilemap->map->height)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (gid != NULL)
+    {
+        *gid = l->tmx->content.gids[x + y * (RPGint) tilemap->map->width];
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetTile(RPGtilemap *tilemap, RPGint layer, RPGint x, RPGint y, RPGint gid)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    RPGlayer *l;
+    RPG_RESULT result = RPG_Tilemap_GetTileLayer(tilemap, layer, &l);
+    if (result != RPG_NO_ERROR)
+    {
+        return result;
+    }
+    if (x < 0 || y < 0 || x >= (RPGint) tilemap->map->width || y >= (RPGint) tilemap->map->height)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (!RPG_Tilemap_ValidTile(tilemap->map, gid))
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    RPG_Tilemap_WriteTile(l, x, y, gid);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetTiles(RPGtilemap *tilemap, RPGint layer, RPGrect *rect, RPGint *gids)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    RPG_RETURN_IF_NULL(rect);
+    RPGlayer *l;
+    RPG_RESULT result = RPG_Tilemap_GetTileLayer(tilemap, layer, &l);
+    if (result != RPG_NO_ERROR)
+    {
+        return result;
+    }
+    if (rect->x < 0 || rect->y < 0 || rect->w < 0 || rect->h < 0 || rect->x + rect->w > (RPGint) tilemap->map->width ||
+        rect->y + rect->h > (RPGint) tilemap->map->height)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (gids != NULL)
+    {
+        for (RPGint y = 0; y < rect->h; y++)
+        {
+            memcpy(&gids[y * rect->w], &l->tmx->content.gids[rect->x + (rect->y + y) * (RPGint) tilemap->map->width],
+                   sizeof(RPGint) * rect->w);
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetTiles(RPGtilemap *tilemap, RPGint layer, RPGrect *rect, const RPGint *gids)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    RPG_RETURN_IF_NULL(rect);
+    RPG_RETURN_IF_NULL(gids);
+    RPGlayer *l;
+    RPG_RESULT result = RPG_Tilemap_GetTileLayer(tilemap, layer, &l);
+    if (result != RPG_NO_ERROR)
+    {
+        return result;
+    }
+    if (rect->x < 0 || rect->y < 0 || rect->w < 0 || rect->h < 0 || rect->x + rect->w > (RPGint) tilemap->map->width ||
+        rect->y + rect->h > (RPGint) tilemap->map->height)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+
+    // Every tile is validated first, so that the layer is left unchanged by an invalid tile
+    RPGint count = rect->w * rect->h;
+    for (RPGint i = 0; i < count; i++)
+    {
+        if (!RPG_Tilemap_ValidTile(tilemap->map, gids[i]))
+        {
+            return RPG_ERR_INVALID_VALUE;
+        }
+    }
+    for (RPGint i = 0; i < count; i++)
+    {
+        RPG_Tilemap_WriteTile(l, rect->x + i % rect->w, rect->y + i / rect->w, gids[i]);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_GetExtrusion(RPGtilemap *tilemap, RPGint *pixels)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (pixels != NULL)
+    {
+        *pixels = tilemap->extrusion;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tilemap_SetExtrusion(RPGtilemap *tilemap, RPGint pixels)
+{
+    RPG_RETURN_IF_NULL(tilemap);
+    if (pixels < 0 || pixels > RPG_TILEMAP_MAX_EXTRUSION)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (pixels != tilemap->extrusion)
+    {
+        // Tilesets are re-packed from their images, the layout of each is changed but its index and frames are not
+        RPGint previous    = tilemap->extrusion;
+        RPGimage *atlas    = tilemap->atlas;
+        tilemap->extrusion = pixels;
+        RPG_RESULT result  = RPG_Tilemap_CreateAtlas(tilemap);
+        if (result)
+        {
+            // The wider tiles no longer fit, the current atlas is kept
+            tilemap->extrusion = previous;
+            return result;
+        }
+        RPG_Image_Free(atlas);
+    }
     return RPG_NO_ERROR;
 }
 
@@ -731,6 +2876,10 @@ RPG_RESULT RPG_Tilemap_SetLayerVisible(RPGtilemap *tilemap, RPGint layer, RPGboo
     {
         return RPG_ERR_OUT_OF_RANGE;
     }
+    if (tilemap->layers.items[layer]->visible != visible && RPG_Tilemap_IsBaked(tilemap->layers.items[layer]))
+    {
+        RPG_Tilemap_FreeBakes(tilemap);
+    }
     tilemap->layers.items[layer]->visible = visible;
     return RPG_NO_ERROR;
 }
@@ -0,0 +1,609 @@
+#include "internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <threads.h>
+
+#define RPG_TILEWORLD_PREFETCH 512
+#define RPG_TILEWORLD_MAX_PATH 1024
+
+typedef enum
+{
+    RPG_WORLDMAP_UNLOADED, /** The map is not loaded, nor requested. */
+    RPG_WORLDMAP_QUEUED,   /** The map is waiting to be loaded by the worker. */
+    RPG_WORLDMAP_LOADING,  /** The map is being parsed by the worker. */
+    RPG_WORLDMAP_LOADED,   /** The map has been parsed, and is waiting to be uploaded on the main thread. */
+    RPG_WORLDMAP_RESIDENT, /** The map is uploaded, and rendered. */
+    RPG_WORLDMAP_FAILED    /** The map could not be loaded, and is not requested again. */
+} RPG_WORLDMAP_STATE;
+
+/**
+ * @brief A map of a world, and its placement within it.
+ */
+typedef struct RPGworldmap
+{
+    char *path;               /** The path to the TMX file, resolved relative to the world file. */
+    RPGint x;                 /** The location of the map within the world on the x-axis, in pixels. */
+    RPGint y;                 /** The location of the map within the world on the y-axis, in pixels. */
+    RPGint width;             /** The width of the map, in pixels. */
+    RPGint height;            /** The height of the map, in pixels. */
+    RPG_WORLDMAP_STATE state; /** The loading state, shared with the worker. */
+    RPGint64 distance;        /** The squared distance from the center of the view, loaded nearest first. */
+    struct _tmx_map *pending; /** The map parsed by the worker, waiting to be uploaded. */
+    RPGtilemap *tilemap;      /** The tilemap while the map is resident, otherwise NULL. */
+} RPGworldmap;
+
+typedef struct RPGtileworld
+{
+    RPGworldmap *maps;     /** The maps of the world. */
+    RPGint count;          /** The number of maps. */
+    RPGviewport *viewport; /** The viewport the maps are rendered in, or NULL. */
+    RPGint ox;             /** The location of the view within the world on the x-axis, in pixels. */
+    RPGint oy;             /** The location of the view within the world on the y-axis, in pixels. */
+    RPGint radius;         /** The distance around the view within which maps are kept resident, in pixels. */
+    struct
+    {
+        thrd_t thread;  /** The thread loading requested maps. */
+        mtx_t mutex;    /** Guards the state of each map. */
+        cnd_t signal;   /** Signaled when maps are requested, or the worker is stopped. */
+        cnd_t done;     /** Signaled by the worker when it finishes loading a map. */
+        RPGbool running;
+    } worker;
+} RPGtileworld;
+
+/****************************************************************************************
+ * Parsing
+ ****************************************************************************************/
+
+/**
+ * @brief Advances past whitespace.
+ *
+ * @param str The current location within the JSON text.
+ * @return The first character that is not whitespace.
+ */
+static const char *RPG_TileWorld_SkipSpace(const char *str)
+{
+    while (*str == ' ' || *str == '\t' || *str == '\r' || *str == '\n')
+    {
+        str++;
+    }
+    return str;
+}
+
+/**
+ * @brief Reads a JSON string into a buffer, truncating it if it does not fit.
+ *
+ * @param str The location of the opening quote.
+ * @param buffer The buffer to receive the string.
+ * @param size The size of the buffer, in bytes.
+ * @return The location after the closing quote, or NULL if the string is not terminated.
+ */
+static const char *RPG_TileWorld_ParseString(const char *str, char *buffer, size_t size)
+{
+    size_t n = 0;
+    for (str++; *str != '"'; str++)
+    {
+        if (*str == '\0')
+        {
+            return NULL;
+        }
+        if (*str == '\\')
+        {
+            // Tiled only escapes separators and quotes within paths
+            str++;
+            if (*str == '\0')
+            {
+                return NULL;
+            }
+        }
+        if (n + 1 < size)
+        {
+            buffer[n++] = *str;
+        }
+    }
+    buffer[n] = '\0';
+    return str + 1;
+}
+
+/**
+ * @brief Reads the object describing a single map of the "maps" array.
+ *
+ * @param str The location of the opening brace.
+ * @param dir The directory of the world file, which map paths are relative to.
+ * @param map The map to receive the values.
+ * @return The location after the closing brace, or NULL if the object is malformed.
+ */
+static const char *RPG_TileWorld_ParseMap(const char *str, const char *dir, RPGworldmap *map)
+{
+    char key[32], value[RPG_TILEWORLD_MAX_PATH];
+    str = RPG_TileWorld_SkipSpace(str + 1);
+    while (*str == '"')
+    {
+        str = RPG_TileWorld_ParseString(str, key, sizeof(key));
+        if (str == NULL || *(str = RPG_TileWorld_SkipSpace(str)) != ':')
+        {
+            return NULL;
+        }
+        str = RPG_TileWorld_SkipSpace(str + 1);
+        if (*str == '"')
+        {
+            if ((str = RPG_TileWorld_ParseString(str, value, sizeof(value))) == NULL)
+            {
+                return NULL;
+            }
+            if (strcmp(key, "fileName") == 0)
+            {
+                size_t len = strlen(dir) + strlen(value) + 1;
+                map->path  = RPG_MALLOC(len);
+                snprintf(map->path, len, "%s%s", dir, value);
+            }
+        }
+        else
+        {
+            char *end;
+            long number = strtol(str, &end, 10);
+            if (end == str)
+            {
+                return NULL;
+            }
+            // Fractions are not written by Tiled, but are skipped should they be present
+            str = end;
+            while (*str == '.' || *str == 'e' || *str == 'E' || *str == '+' || *str == '-' || (*str >= '0' && *str <= '9'))
+            {
+                str++;
+            }
+            if (strcmp(key, "x") == 0)
+            {
+                map->x = (RPGint) number;
+            }
+            else if (strcmp(key, "y") == 0)
+            {
+                map->y = (RPGint) number;
+            }
+            else if (strcmp(key, "width") == 0)
+            {
+                map->width = (RPGint) number;
+            }
+            else if (strcmp(key, "height") == 0)
+            {
+                map->height = (RPGint) number;
+            }
+        }
+        str = RPG_TileWorld_SkipSpace(str);
+        if (*str == ',')
+        {
+            str = RPG_TileWorld_SkipSpace(str + 1);
+        }
+    }
+    return *str == '}' ? str + 1 : NULL;
+}
+
+/**
+ * @brief Reads the maps of a world file.
+ *
+ * Only the "maps" array is read, as Tiled writes it. Maps placed by "patterns" are not supported.
+ *
+ * @param world The world to receive the maps.
+ * @param json The contents of the world file.
+ * @param dir The directory of the world file, which map paths are relative to.
+ * @return RPG_NO_ERROR on success, otherwise RPG_ERR_MALFORMED.
+ */
+static RPG_RESULT RPG_TileWorld_Parse(RPGtileworld *world, const char *json, const char *dir)
+{
+    const char *str = strstr(json, "\"maps\"");
+    if (str == NULL)
+    {
+        return RPG_ERR_MALFORMED;
+    }
+    str = RPG_TileWorld_SkipSpace(str + 6);
+    if (*str != ':' || *(str = RPG_TileWorld_SkipSpace(str + 1)) != '[')
+    {
+        return RPG_ERR_MALFORMED;
+    }
+
+    RPGint capacity = 0;
+    str             = RPG_TileWorld_SkipSpace(str + 1);
+    while (*str == '{')
+    {
+        if (world->count == capacity)
+        {
+            capacity    = capacity ? capacity * 2 : 8;
+            world->maps = RPG_REALLOC(world->maps, sizeof(RPGworldmap) * capacity);
+        }
+        RPGworldmap *map = &world->maps[world->count++];
+        memset(map, 0, sizeof(RPGworldmap));
+        if ((str = RPG_TileWorld_ParseMap(str, dir, map)) == NULL || map->path == NULL)
+        {
+            return RPG_ERR_MALFORMED;
+        }
+        str = RPG_TileWorld_SkipSpace(str);
+        if (*str == ',')
+        {
+            str = RPG_TileWorld_SkipSpace(str + 1);
+        }
+    }
+    return *str == ']' ? RPG_NO_ERROR : RPG_ERR_MALFORMED;
+}
+
+/****************************************************************************************
+ * Loading
+ ****************************************************************************************/
+
+/**
+ * @brief The worker thread of a world, parsing the requested maps nearest the view first until stopped.
+ *
+ * @param tileworld The world to load maps for.
+ * @return Always 0.
+ */
+static int RPG_TileWorld_Load(void *tileworld)
+{
+    RPGtileworld *world = tileworld;
+    RPGworldmap *next;
+    mtx_lock(&world->worker.mutex);
+    while (world->worker.running)
+    {
+        next = NULL;
+        for (RPGint i = 0; i < world->count; i++)
+        {
+            if (world->maps[i].state == RPG_WORLDMAP_QUEUED && (next == NULL || world->maps[i].distance < next->distance))
+            {
+                next = &world->maps[i];
+            }
+        }
+        if (next == NULL)
+        {
+            cnd_wait(&world->worker.signal, &world->worker.mutex);
+            continue;
+        }
+
+        // The path and state of the map are not changed by the main thread while it is loading
+        next->state = RPG_WORLDMAP_LOADING;
+        mtx_unlock(&world->worker.mutex);
+        struct _tmx_map *map = RPG_Tilemap_LoadMap(next->path);
+        mtx_lock(&world->worker.mutex);
+
+        if (map == NULL)
+        {
+            fprintf(stderr, "failed to load world map \"%s\"\n", next->path);
+        }
+        next->pending = map;
+        next->state   = map ? RPG_WORLDMAP_LOADED : RPG_WORLDMAP_FAILED;
+        cnd_broadcast(&world->worker.done);
+    }
+    mtx_unlock(&world->worker.mutex);
+    return 0;
+}
+
+/**
+ * @brief Uploads a map that has been parsed, making it resident.
+ *
+ * @param world The world the map belongs to.
+ * @param map The map to upload, which must be in the loaded state.
+ */
+static void RPG_TileWorld_Upload(RPGtileworld *world, RPGworldmap *map)
+{
+    if (RPG_Tilemap_CreateFromMap(map->pending, world->viewport, &map->tilemap) == RPG_NO_ERROR)
+    {
+        map->state = RPG_WORLDMAP_RESIDENT;
+        RPG_Tilemap_SetOrigin(map->tilemap, world->ox - map->x, world->oy - map->y);
+    }
+    else
+    {
+        RPG_Tilemap_DiscardMap(map->pending);
+        map->state = RPG_WORLDMAP_FAILED;
+    }
+    map->pending = NULL;
+}
+
+/**
+ * @brief Ensures the map beneath the center of the view is resident, waiting for it or loading it immediately if the
+ * prefetch has not reached it in time.
+ *
+ * Must be called while holding the worker's mutex.
+ *
+ * @param world The world to load the map of.
+ * @param map The map beneath the center of the view.
+ */
+static void RPG_TileWorld_LoadCurrent(RPGtileworld *world, RPGworldmap *map)
+{
+    while (map->state == RPG_WORLDMAP_LOADING)
+    {
+        cnd_wait(&world->worker.done, &world->worker.mutex);
+    }
+    if (map->state == RPG_WORLDMAP_UNLOADED || map->state == RPG_WORLDMAP_QUEUED)
+    {
+        map->pending = RPG_Tilemap_LoadMap(map->path);
+        map->state   = map->pending ? RPG_WORLDMAP_LOADED : RPG_WORLDMAP_FAILED;
+    }
+    if (map->state == RPG_WORLDMAP_LOADED)
+    {
+        RPG_TileWorld_Upload(world, map);
+    }
+}
+
+/****************************************************************************************
+ * Tile World
+ ****************************************************************************************/
+
+RPG_RESULT RPG_TileWorld_CreateFromFile(const char *path, RPGviewport *viewport, RPGtileworld **world)
+{
+    RPG_RETURN_IF_NULL(path);
+    RPG_RETURN_IF_NULL(world);
+    char *json;
+    RPG_RESULT result = RPG_ReadFile(path, &json, NULL);
+    if (result != RPG_NO_ERROR)
+    {
+        return result;
+    }
+
+    // Maps are relative to the directory of the world file
+    char dir[RPG_TILEWORLD_MAX_PATH];
+    const char *slash = strrchr(path, '/');
+#ifdef _WIN32
+    const char *backslash = strrchr(path, '\\');
+    if (backslash != NULL && (slash == NULL || backslash > slash))
+    {
+        slash = backslash;
+    }
+#endif
+    size_t len = slash ? imin((RPGint)(slash - path) + 1, RPG_TILEWORLD_MAX_PATH - 1) : 0;
+    memcpy(dir, path, len);
+    dir[len] = '\0';
+
+    RPG_ALLOC_ZERO(w, RPGtileworld);
+    result = RPG_TileWorld_Parse(w, json, dir);
+    RPG_FREE(json);
+    if (result != RPG_NO_ERROR)
+    {
+        for (RPGint i = 0; i < w->count; i++)
+        {
+            RPG_FREE(w->maps[i].path);
+        }
+        RPG_FREE(w->maps);
+        RPG_FREE(w);
+        return result;
+    }
+
+    w->viewport = viewport;
+    w->radius   = RPG_TILEWORLD_PREFETCH;
+    RPG_Tilemap_SetupLoader();
+    mtx_init(&w->worker.mutex, mtx_plain);
+    cnd_init(&w->worker.signal);
+    cnd_init(&w->worker.done);
+    w->worker.running = RPG_TRUE;
+    if (thrd_create(&w->worker.thread, RPG_TileWorld_Load, w) != thrd_success)
+    {
+        mtx_destroy(&w->worker.mutex);
+        cnd_destroy(&w->worker.signal);
+        cnd_destroy(&w->worker.done);
+        w->worker.running = RPG_FALSE;
+        RPG_TileWorld_Free(w);
+        return RPG_ERR_THREAD_FAILURE;
+    }
+    *world = w;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_Free(RPGtileworld *world)
+{
+    if (world != NULL)
+    {
+        if (world->worker.running)
+        {
+            mtx_lock(&world->worker.mutex);
+            world->worker.running = RPG_FALSE;
+            cnd_signal(&world->worker.signal);
+            mtx_unlock(&world->worker.mutex);
+            thrd_join(world->worker.thread, NULL);
+            mtx_destroy(&world->worker.mutex);
+            cnd_destroy(&world->worker.signal);
+            cnd_destroy(&world->worker.done);
+        }
+        for (RPGint i = 0; i < world->count; i++)
+        {
+            RPG_Tilemap_Free(world->maps[i].tilemap);
+            RPG_Tilemap_DiscardMap(world->maps[i].pending);
+            RPG_FREE(world->maps[i].path);
+        }
+        RPG_FREE(world->maps);
+        RPG_FREE(world);
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_Update(RPGtileworld *world)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGint w       = world->viewport ? world->viewport->width : RPG_GAME->resolution.width;
+    RPGint h       = world->viewport ? world->viewport->height : RPG_GAME->resolution.height;
+    RPGint left    = world->ox - world->radius;
+    RPGint top     = world->oy - world->radius;
+    RPGint right   = world->ox + w + world->radius;
+    RPGint bottom  = world->oy + h + world->radius;
+    RPGint centerX = world->ox + w / 2;
+    RPGint centerY = world->oy + h / 2;
+
+    mtx_lock(&world->worker.mutex);
+    RPGbool requested    = RPG_FALSE;
+    RPGworldmap *current = NULL;
+    RPGworldmap *upload  = NULL;
+    RPGworldmap *map;
+    RPGint64 dx, dy;
+    for (RPGint i = 0; i < world->count; i++)
+    {
+        map           = &world->maps[i];
+        dx            = (RPGint64)(map->x + map->width / 2 - centerX);
+        dy            = (RPGint64)(map->y + map->height / 2 - centerY);
+        map->distance = dx * dx + dy * dy;
+        if (centerX >= map->x && centerX < map->x + map->width && centerY >= map->y && centerY < map->y + map->height)
+        {
+            current = map;
+        }
+
+        if (map->x < right && map->x + map->width > left && map->y < bottom && map->y + map->height > top)
+        {
+            if (map->state == RPG_WORLDMAP_UNLOADED)
+            {
+                map->state = RPG_WORLDMAP_QUEUED;
+                requested  = RPG_TRUE;
+            }
+            else if (map->state == RPG_WORLDMAP_LOADED && (upload == NULL || map->distance < upload->distance))
+            {
+                upload = map;
+            }
+            continue;
+        }
+
+        // Release the maps that have moved out of range, those being loaded are discarded once they are done
+        if (map->state == RPG_WORLDMAP_QUEUED)
+        {
+            map->state = RPG_WORLDMAP_UNLOADED;
+        }
+        else if (map->state == RPG_WORLDMAP_LOADED)
+        {
+            RPG_Tilemap_DiscardMap(map->pending);
+            map->pending = NULL;
+            map->state   = RPG_WORLDMAP_UNLOADED;
+        }
+        else if (map->state == RPG_WORLDMAP_RESIDENT)
+        {
+            RPG_Tilemap_Free(map->tilemap);
+            map->tilemap = NULL;
+            map->state   = RPG_WORLDMAP_UNLOADED;
+        }
+    }
+    if (requested)
+    {
+        cnd_signal(&world->worker.signal);
+    }
+
+    // Uploading is limited to a single map per update to spread the cost over frames, unless the view is over a map
+    // that is not yet resident, which is made resident immediately
+    if (current != NULL && current->state != RPG_WORLDMAP_RESIDENT && current->state != RPG_WORLDMAP_FAILED)
+    {
+        RPG_TileWorld_LoadCurrent(world, current);
+    }
+    else if (upload != NULL)
+    {
+        RPG_TileWorld_Upload(world, upload);
+    }
+    mtx_unlock(&world->worker.mutex);
+
+    // Each map is offset by its location within the world, so they meet seamlessly at their edges
+    for (RPGint i = 0; i < world->count; i++)
+    {
+        map = &world->maps[i];
+        if (map->state == RPG_WORLDMAP_RESIDENT)
+        {
+            RPG_Tilemap_SetOrigin(map->tilemap, world->ox - map->x, world->oy - map->y);
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetOrigin(RPGtileworld *world, RPGint *x, RPGint *y)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (x != NULL)
+    {
+        *x = world->ox;
+    }
+    if (y != NULL)
+    {
+        *y = world->oy;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_SetOrigin(RPGtileworld *world, RPGint x, RPGint y)
+{
+    RPG_RETURN_IF_NULL(world);
+    world->ox = x;
+    world->oy = y;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetPrefetchRadius(RPGtileworld *world, RPGint *radius)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (radius != NULL)
+    {
+        *radius = world->radius;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_SetPrefetchRadius(RPGtileworld *world, RPGint radius)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (radius < 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    world->radius = radius;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetMapCount(RPGtileworld *world, RPGint *count)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (count != NULL)
+    {
+        *count = world->count;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetMapBounds(RPGtileworld *world, RPGint index, RPGrect *bounds)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (index < 0 || index >= world->count)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (bounds != NULL)
+    {
+        RPGworldmap *map = &world->maps[index];
+        bounds->x        = map->x;
+        bounds->y        = map->y;
+        bounds->w        = map->width;
+        bounds->h        = map->height;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetMap(RPGtileworld *world, RPGint index, RPGtilemap **tilemap)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (index < 0 || index >= world->count)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (tilemap != NULL)
+    {
+        *tilemap = world->maps[index].tilemap;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_TileWorld_GetCurrentMap(RPGtileworld *world, RPGint *index)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (index != NULL)
+    {
+        RPGint w       = world->viewport ? world->viewport->width : RPG_GAME->resolution.width;
+        RPGint h       = world->viewport ? world->viewport->height : RPG_GAME->resolution.height;
+        RPGint centerX = world->ox + w / 2;
+        RPGint centerY = world->oy + h / 2;
+        *index         = -1;
+        for (RPGint i = 0; i < world->count; i++)
+        {
+            RPGworldmap *map = &world->maps[i];
+            if (centerX >= map->x && centerX < map->x + map->width && centerY >= map->y && centerY < map->y + map->height)
+            {
+                *index = i;
+                break;
+            }
+        }
+    }
+    return RPG_NO_ERROR;
+}
@@ -62,6 +62,19 @@ void tmx_map_free(tmx_map *map) {
 	}
 }
 
+int32_t* tmx_chunk_decode(const tmx_chunk *chunk) {
+	int32_t *gids = NULL;
+	if (!chunk) {
+		tmx_err(E_INVAL, "tmx_chunk_decode: invalid argument: chunk is NULL");
+		return NULL;
+	}
+	if (!data_decode(chunk->data, (enum enccmp_t)chunk->encoding, (size_t)chunk->width * chunk->height, &gids)) {
+		tmx_free_func(gids);
+		return NULL;
+	}
+	return gids;
+}
+
 tmx_tile* tmx_get_tile(tmx_map *map, unsigned int gid) {
 	if (!map) {
 		tmx_err(E_INVAL, "tmx_get_tile: invalid argument: map is NULL");
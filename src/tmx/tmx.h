@@ -69,6 +69,7 @@ typedef struct _tmx_text tmx_text;
 typedef struct _tmx_obj tmx_object;
 typedef struct _tmx_objgr tmx_object_group;
 typedef struct _tmx_templ tmx_template;
+typedef struct _tmx_chunk tmx_chunk;
 typedef struct _tmx_layer tmx_layer;
 typedef struct _tmx_map tmx_map;
 typedef void tmx_properties; /* hashtable, use function tmx_get_property(...) */
@@ -203,6 +204,14 @@ struct _tmx_templ { /* <template> */
 	tmx_object *object; /* never null */
 };
 
+struct _tmx_chunk { /* <chunk> (infinite maps only) */
+	int x, y; /* position of the top-left tile of the chunk, in tiles, may be negative */
+	int width, height; /* in tiles */
+	int encoding; /* private, how `data` is encoded */
+	char *data; /* encoded tiles, decode them with tmx_chunk_decode(...) */
+	tmx_chunk *next;
+};
+
 struct _tmx_layer { /* <layer> or <imagelayer> or <objectgroup> */
 	char *name;
 	double opacity;
@@ -216,6 +225,7 @@ struct _tmx_layer { /* <layer> or <imagelayer> or <objectgroup> */
 		tmx_image *image;
 		tmx_layer *group_head;
 	} content;
+	tmx_chunk *chunk_head; /* tiles of a layer of an infinite map, in which case content.gids is NULL */
 
 	tmx_user_data user_data;
 	tmx_properties *properties;
@@ -224,6 +234,7 @@ struct _tmx_layer { /* <layer> or <imagelayer> or <objectgroup> */
 
 struct _tmx_map { /* <map> (Head of the data structure) */
 	enum tmx_map_orient orient;
+	int infinite; /* 0 == false, tile layers store their tiles in chunks */
 
 	unsigned int width, height;
 	unsigned int tile_width, tile_height;
@@ -274,6 +285,10 @@ TMXEXPORT tmx_map* tmx_load_callback(tmx_read_functor callback, void *userdata);
 /* Frees the map data structure */
 TMXEXPORT void tmx_map_free(tmx_map *map);
 
+/* Decodes the tiles of a chunk, returns an array of width*height gids to free with tmx_free_func,
+   returns NULL if an error occurred and set tmx_errno. The map is not accessed, so chunks may be decoded on any thread */
+TMXEXPORT int32_t* tmx_chunk_decode(const tmx_chunk *chunk);
+
 /* Returns the tile associated with this gid, returns NULL if it fails */
 TMXEXPORT tmx_tile* tmx_get_tile(tmx_map *map, unsigned int gid);
 
@@ -76,6 +76,10 @@ tmx_layer* alloc_layer(void) {
 	return res;
 }
 
+tmx_chunk* alloc_chunk(void) {
+	return (tmx_chunk*)node_alloc(sizeof(tmx_chunk));
+}
+
 tmx_tile* alloc_tiles(int count) {
 	return (tmx_tile*)node_alloc(count * sizeof(tmx_tile));
 }
@@ -186,6 +190,7 @@ void free_layers(tmx_layer *l) {
 		tmx_free_func(l->name);
 		if (l->type == L_LAYER) {
 			tmx_free_func(l->content.gids);
+			free_chunks(l->chunk_head);
 		}
 		else if (l->type == L_OBJGR) {
 			free_objgr(l->content.objgr);
@@ -201,6 +206,16 @@ void free_layers(tmx_layer *l) {
 	}
 }
 
+void free_chunks(tmx_chunk *c) {
+	tmx_chunk *next;
+	while (c) {
+		next = c->next;
+		tmx_free_func(c->data);
+		tmx_free_func(c);
+		c = next;
+	}
+}
+
 void free_tiles(tmx_tile *t, int tilecount) {
 	int i;
 	if (t) {
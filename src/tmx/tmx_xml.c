@@ -416,6 +416,107 @@ cleanup:
 	return 0;
 }
 
+/* parse the <chunk> elements of the <data> element of an infinite map, their tiles are kept encoded until needed */
+static int parse_chunks(xmlTextReaderPtr reader, tmx_chunk **chunk_headadr) {
+	tmx_chunk *res;
+	int curr_depth;
+	enum enccmp_t encoding;
+	const char *name;
+	char *value, *inner_xml, *trimmed;
+
+	curr_depth = xmlTextReaderDepth(reader);
+
+	if (!(value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"encoding"))) { /* encoding */
+		tmx_err(E_MISSEL, "xml parser: missing 'encoding' attribute in the 'data' element");
+		return 0;
+	}
+
+	if (!strcmp(value, "base64")) {
+		tmx_free_func(value);
+		value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"compression"); /* compression */
+
+		if (value && strcmp(value, "zlib") && strcmp(value, "gzip")) {
+			tmx_err(E_ENCCMP, "xml parser: unsupported data compression: '%s'", value); /* unsupported compression */
+			tmx_free_func(value);
+			return 0;
+		}
+		encoding = value ? B64Z : B64;
+	} else if (!strcmp(value, "csv")) {
+		encoding = CSV;
+	} else {
+		tmx_err(E_ENCCMP, "xml parser: unsupported chunk data encoding: %s", value);
+		tmx_free_func(value);
+		return 0;
+	}
+	tmx_free_func(value);
+
+	if (xmlTextReaderIsEmptyElement(reader)) {
+		return 1;
+	}
+
+	do {
+		if (xmlTextReaderRead(reader) != 1) return 0; /* error_handler has been called */
+
+		if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT) {
+			name = (char*)xmlTextReaderConstName(reader);
+			if (strcmp(name, "chunk")) {
+				/* Unknow element, skip its tree */
+				if (xmlTextReaderNext(reader) != 1) return 0;
+				continue;
+			}
+
+			if (!(res = alloc_chunk())) return 0;
+			res->next = *chunk_headadr;
+			*chunk_headadr = res;
+			res->encoding = (int)encoding;
+
+			if ((value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"x"))) { /* x */
+				res->x = atoi(value);
+				tmx_free_func(value);
+			} else {
+				tmx_err(E_MISSEL, "xml parser: missing 'x' attribute in the 'chunk' element");
+				return 0;
+			}
+
+			if ((value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"y"))) { /* y */
+				res->y = atoi(value);
+				tmx_free_func(value);
+			} else {
+				tmx_err(E_MISSEL, "xml parser: missing 'y' attribute in the 'chunk' element");
+				return 0;
+			}
+
+			if ((value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"width"))) { /* width */
+				res->width = atoi(value);
+				tmx_free_func(value);
+			} else {
+				tmx_err(E_MISSEL, "xml parser: missing 'width' attribute in the 'chunk' element");
+				return 0;
+			}
+
+			if ((value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"height"))) { /* height */
+				res->height = atoi(value);
+				tmx_free_func(value);
+			} else {
+				tmx_err(E_MISSEL, "xml parser: missing 'height' attribute in the 'chunk' element");
+				return 0;
+			}
+
+			if (!(inner_xml = (char*)xmlTextReaderReadInnerXml(reader))) {
+				tmx_err(E_XDATA, "xml parser: missing content in the 'chunk' element");
+				return 0;
+			}
+			/* keep the trimmed content at the start of its allocation, so it can be freed */
+			trimmed = str_trim(inner_xml);
+			memmove(inner_xml, trimmed, strlen(trimmed) + 1);
+			res->data = inner_xml;
+		}
+	} while (xmlTextReaderNodeType(reader) != XML_READER_TYPE_END_ELEMENT ||
+	         xmlTextReaderDepth(reader) != curr_depth);
+
+	return 1;
+}
+
 static int parse_image(xmlTextReaderPtr reader, tmx_image **img_adr, short strict, const char *filename) {
 	tmx_image *res;
 	char *value;
@@ -460,7 +561,7 @@ static int parse_image(xmlTextReaderPtr reader, tmx_image **img_adr, short stric
 }
 
 /* parse layers and objectgroups */
-static int parse_layer(xmlTextReaderPtr reader, tmx_layer **layer_headadr, int map_h, int map_w, enum tmx_layer_type type, tmx_resource_manager *rc_mgr, const char *filename) {
+static int parse_layer(xmlTextReaderPtr reader, tmx_layer **layer_headadr, int map_h, int map_w, int infinite, enum tmx_layer_type type, tmx_resource_manager *rc_mgr, const char *filename) {
 	tmx_layer *res;
 	tmx_object *obj;
 	int curr_depth;
@@ -531,6 +632,8 @@ static int parse_layer(xmlTextReaderPtr reader, tmx_layer **layer_headadr, int m
 			name = (char*)xmlTextReaderConstName(reader);
 			if (!strcmp(name, "properties")) {
 				if (!parse_properties(reader, &(res->properties))) return 0;
+			} else if (!strcmp(name, "data") && infinite) {
+				if (!parse_chunks(reader, &(res->chunk_head))) return 0;
 			} else if (!strcmp(name, "data")) {
 				if (!parse_data(reader, &(res->content.gids), map_h * map_w)) return 0;
 			} else if (!strcmp(name, "image")) {
@@ -543,7 +646,7 @@ static int parse_layer(xmlTextReaderPtr reader, tmx_layer **layer_headadr, int m
 
 				if (!parse_object(reader, obj, 1, rc_mgr, filename)) return 0;
 			} else if (type == L_GROUP && (child_type = parse_layer_type(name)) != L_NONE) {
-				if (!parse_layer(reader, &(res->content.group_head), map_h, map_w, child_type, rc_mgr, filename)) return 0;
+				if (!parse_layer(reader, &(res->content.group_head), map_h, map_w, infinite, child_type, rc_mgr, filename)) return 0;
 			} else {
 				/* Unknow element, skip its tree */
 				if (xmlTextReaderNext(reader) != 1) return 0;
@@ -920,14 +1023,11 @@ static int parse_map(xmlTextReaderPtr reader, tmx_map *map, tmx_resource_manager
 
 	curr_depth = xmlTextReaderDepth(reader);
 
-	/* infinite maps not supported */
+	/* infinite maps store the tiles of their layers in chunks */
 	if ((value = (char*)xmlTextReaderGetAttribute(reader, (xmlChar*)"infinite"))) {
 		flag = atoi(value);
 		tmx_free_func(value);
-		if (flag == 1) {
-			tmx_err(E_XDATA, "xml parser: chunked layer data is not supported, edit this map to remove the infinite flag");
-			return 0;
-		}
+		map->infinite = (flag == 1);
 	}
 
 	/* parses each attribute */
@@ -1016,7 +1116,7 @@ static int parse_map(xmlTextReaderPtr reader, tmx_map *map, tmx_resource_manager
 			} else if (!strcmp(name, "properties")) {
 				if (!parse_properties(reader, &(map->properties))) return 0;
 			} else if ((type = parse_layer_type(name)) != L_NONE) {
-				if (!parse_layer(reader, &(map->ly_head), map->height, map->width, type, rc_mgr, filename)) return 0;
+				if (!parse_layer(reader, &(map->ly_head), map->height, map->width, map->infinite, type, rc_mgr, filename)) return 0;
 			} else {
 				/* Unknow element, skip its tree */
 				if (xmlTextReaderNext(reader) != 1) return 0;
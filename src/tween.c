@@ -0,0 +1,581 @@
+#include "internal.h"
+
+#define RPG_TWEEN_INIT_CAPACITY 4
+
+/****************************************************************************************
+ * Easing
+ ****************************************************************************************/
+
+static inline RPGfloat RPG_Tween_BounceOut(RPGfloat t)
+{
+    const RPGfloat n = 7.5625f, d = 2.75f;
+    if (t < 1.0f / d)
+    {
+        return n * t * t;
+    }
+    if (t < 2.0f / d)
+    {
+        t -= 1.5f / d;
+        return n * t * t + 0.75f;
+    }
+    if (t < 2.5f / d)
+    {
+        t -= 2.25f / d;
+        return n * t * t + 0.9375f;
+    }
+    t -= 2.625f / d;
+    return n * t * t + 0.984375f;
+}
+
+/**
+ * @brief Applies an easing curve to a linear progress value.
+ *
+ * @param easing The easing curve to apply.
+ * @param t The progress, in the range of 0.0 to 1.0.
+ * @return RPGfloat The eased progress, which may overshoot the range for some curves.
+ */
+static RPGfloat RPG_Tween_Ease(RPG_EASING easing, RPGfloat t)
+{
+    const RPGfloat c1 = 1.70158f, c2 = c1 * 1.525f, c3 = c1 + 1.0f;
+    switch (easing)
+    {
+        case RPG_EASING_QUAD_IN: return t * t;
+        case RPG_EASING_QUAD_OUT: return 1.0f - (1.0f - t) * (1.0f - t);
+        case RPG_EASING_QUAD_IN_OUT: return t < 0.5f ? 2.0f * t * t : 1.0f - powf(-2.0f * t + 2.0f, 2.0f) / 2.0f;
+        case RPG_EASING_CUBIC_IN: return t * t * t;
+        case RPG_EASING_CUBIC_OUT: return 1.0f - powf(1.0f - t, 3.0f);
+        case RPG_EASING_CUBIC_IN_OUT: return t < 0.5f ? 4.0f * t * t * t : 1.0f - powf(-2.0f * t + 2.0f, 3.0f) / 2.0f;
+        case RPG_EASING_SINE_IN: return 1.0f - cosf(t * RPG_PI / 2.0f);
+        case RPG_EASING_SINE_OUT: return sinf(t * RPG_PI / 2.0f);
+        case RPG_EASING_SINE_IN_OUT: return -(cosf(RPG_PI * t) - 1.0f) / 2.0f;
+        case RPG_EASING_EXPO_IN: return t <= 0.0f ? 0.0f : powf(2.0f, 10.0f * t - 10.0f);
+        case RPG_EASING_EXPO_OUT: return t >= 1.0f ? 1.0f : 1.0f - powf(2.0f, -10.0f * t);
+        case RPG_EASING_EXPO_IN_OUT:
+        {
+            if (t <= 0.0f || t >= 1.0f)
+            {
+                return t;
+            }
+            return t < 0.5f ? powf(2.0f, 20.0f * t - 10.0f) / 2.0f : (2.0f - powf(2.0f, -20.0f * t + 10.0f)) / 2.0f;
+        }
+        case RPG_EASING_BACK_IN: return c3 * t * t * t - c1 * t * t;
+        case RPG_EASING_BACK_OUT: return 1.0f + c3 * powf(t - 1.0f, 3.0f) + c1 * powf(t - 1.0f, 2.0f);
+        case RPG_EASING_BACK_IN_OUT:
+        {
+            return t < 0.5f ? (powf(2.0f * t, 2.0f) * ((c2 + 1.0f) * 2.0f * t - c2)) / 2.0f
+                            : (powf(2.0f * t - 2.0f, 2.0f) * ((c2 + 1.0f) * (t * 2.0f - 2.0f) + c2) + 2.0f) / 2.0f;
+        }
+        case RPG_EASING_ELASTIC_OUT:
+        {
+            if (t <= 0.0f || t >= 1.0f)
+            {
+                return t;
+            }
+            return powf(2.0f, -10.0f * t) * sinf((t * 10.0f - 0.75f) * (2.0f * RPG_PI / 3.0f)) + 1.0f;
+        }
+        case RPG_EASING_BOUNCE_OUT: return RPG_Tween_BounceOut(t);
+        default: return t;
+    }
+}
+
+/****************************************************************************************
+ * Properties
+ ****************************************************************************************/
+
+/**
+ * @brief Retrieves the number of components in a property.
+ *
+ * @param property The property to query.
+ * @return RPGint The number of components, or 0 if the property is invalid.
+ */
+static RPGint RPG_Tween_Components(RPG_TWEEN_PROPERTY property)
+{
+    switch (property)
+    {
+        case RPG_TWEEN_X:
+        case RPG_TWEEN_Y:
+        case RPG_TWEEN_ALPHA:
+        case RPG_TWEEN_HUE:
+        case RPG_TWEEN_ROTATION: return 1;
+        case RPG_TWEEN_LOCATION:
+        case RPG_TWEEN_SCALE: return 2;
+        case RPG_TWEEN_COLOR:
+        case RPG_TWEEN_TONE: return 4;
+        default: return 0;
+    }
+}
+
+static void RPG_Tween_Read(RPGbasic *b, RPG_TWEEN_PROPERTY property, RPGfloat *v)
+{
+    switch (property)
+    {
+        case RPG_TWEEN_X: v[0] = (RPGfloat) b->x; break;
+        case RPG_TWEEN_Y: v[0] = (RPGfloat) b->y; break;
+        case RPG_TWEEN_LOCATION:
+            v[0] = (RPGfloat) b->x;
+            v[1] = (RPGfloat) b->y;
+            break;
+        case RPG_TWEEN_ALPHA: v[0] = b->alpha; break;
+        case RPG_TWEEN_HUE: v[0] = b->hue; break;
+        case RPG_TWEEN_SCALE:
+            v[0] = b->scale.x;
+            v[1] = b->scale.y;
+            break;
+        case RPG_TWEEN_ROTATION: v[0] = b->rotation.radians * (180.0f / RPG_PI); break;
+        case RPG_TWEEN_COLOR: memcpy(v, &b->color, sizeof(RPGcolor)); break;
+        case RPG_TWEEN_TONE: memcpy(v, &b->tone, sizeof(RPGtone)); break;
+    }
+}
+
+static void RPG_Tween_Write(RPGbasic *b, RPG_TWEEN_PROPERTY property, const RPGfloat *v)
+{
+    // Only properties that contribute to the model matrix flag the object as updated
+    switch (property)
+    {
+        case RPG_TWEEN_X:
+            b->x       = (RPGint) roundf(v[0]);
+            b->updated = RPG_TRUE;
+            break;
+        case RPG_TWEEN_Y:
+            b->y       = (RPGint) roundf(v[0]);
+            b->updated = RPG_TRUE;
+            break;
+        case RPG_TWEEN_LOCATION:
+            b->x       = (RPGint) roundf(v[0]);
+            b->y       = (RPGint) roundf(v[1]);
+            b->updated = RPG_TRUE;
+            break;
+        case RPG_TWEEN_ALPHA: b->alpha = RPG_CLAMPF(v[0], 0.0f, 1.0f); break;
+        case RPG_TWEEN_HUE: b->hue = v[0]; break;
+        case RPG_TWEEN_SCALE:
+            b->scale.x = v[0];
+            b->scale.y = v[1];
+            b->updated = RPG_TRUE;
+            break;
+        case RPG_TWEEN_ROTATION:
+            b->rotation.radians = v[0] * (RPG_PI / 180.0f);
+            b->updated          = RPG_TRUE;
+            break;
+        case RPG_TWEEN_COLOR: memcpy(&b->color, v, sizeof(RPGcolor)); break;
+        case RPG_TWEEN_TONE: memcpy(&b->tone, v, sizeof(RPGtone)); break;
+    }
+}
+
+/****************************************************************************************
+ * Simulation
+ ****************************************************************************************/
+
+/**
+ * @brief Returns a tween and all of its children to their initial state, ready to be played again.
+ *
+ * @param tween The tween to reset.
+ * @param rewind RPG_TRUE when starting from the beginning, otherwise RPG_FALSE when repeating, which keeps the captured starting
+ * values, repetition count, and direction.
+ */
+static void RPG_Tween_Reset(RPGtween *tween, RPGbool rewind)
+{
+    tween->elapsed  = 0;
+    tween->current  = 0;
+    tween->finished = RPG_FALSE;
+    if (rewind)
+    {
+        tween->started   = RPG_FALSE;
+        tween->iteration = 0;
+        tween->reverse   = RPG_FALSE;
+    }
+    for (RPGint i = 0; i < tween->count; i++)
+    {
+        RPG_Tween_Reset(tween->children[i], rewind);
+    }
+}
+
+/**
+ * @brief Invokes the completion callback of a tween, if any.
+ *
+ * @param tween The tween that has completed.
+ */
+static inline void RPG_Tween_Notify(RPGtween *tween)
+{
+    if (tween->callback != NULL)
+    {
+        tween->callback(tween, tween->user);
+    }
+}
+
+/**
+ * @brief Handles the completion of a single play-through of a tween, repeating it if required.
+ *
+ * @param tween The tween that has reached its end.
+ * @return RPGbool RPG_TRUE if the tween has completed, otherwise RPG_FALSE if it will repeat.
+ */
+static RPGbool RPG_Tween_Complete(RPGtween *tween)
+{
+    if (tween->repeat == 0 || (tween->repeat > 0 && tween->iteration >= tween->repeat))
+    {
+        return RPG_TRUE;
+    }
+    tween->iteration++;
+    RPG_Tween_Reset(tween, RPG_FALSE);
+    if (tween->yoyo)
+    {
+        tween->reverse = !tween->reverse;
+    }
+    return RPG_FALSE;
+}
+
+/**
+ * @brief Advances a tween by a single update.
+ *
+ * @param tween The tween to advance.
+ * @return RPGbool RPG_TRUE if the tween completed during this update.
+ */
+static RPGbool RPG_Tween_Step(RPGtween *tween)
+{
+    RPGbool done = RPG_FALSE;
+    switch (tween->type)
+    {
+        case RPG_TWEEN_TYPE_PROPERTY:
+        {
+            if (tween->target == NULL)
+            {
+                // The object was freed, the tween keeps its schedule but has nothing to write to
+                done = ++tween->elapsed >= tween->duration;
+                break;
+            }
+            if (!tween->started)
+            {
+                // The starting value is read when the tween begins, not when created, so tweens chain naturally in a sequence
+                if (!tween->explicitFrom)
+                {
+                    RPG_Tween_Read(tween->target, tween->property, tween->from);
+                }
+                tween->started = RPG_TRUE;
+            }
+            tween->elapsed++;
+            RPGfloat t = tween->elapsed >= tween->duration ? 1.0f : (RPGfloat) tween->elapsed / tween->duration;
+            RPGfloat e = RPG_Tween_Ease(tween->easing, tween->reverse ? 1.0f - t : t);
+            RPGfloat value[4];
+            for (int i = 0; i < 4; i++)
+            {
+                value[i] = tween->from[i] + (tween->to[i] - tween->from[i]) * e;
+            }
+            RPG_Tween_Write(tween->target, tween->property, value);
+            done = tween->elapsed >= tween->duration;
+            break;
+        }
+        case RPG_TWEEN_TYPE_DELAY:
+        {
+            done = ++tween->elapsed >= tween->duration;
+            break;
+        }
+        case RPG_TWEEN_TYPE_SEQUENCE:
+        {
+            if (tween->current < tween->count && RPG_Tween_Step(tween->children[tween->current]))
+            {
+                RPG_Tween_Notify(tween->children[tween->current++]);
+            }
+            done = tween->current >= tween->count;
+            break;
+        }
+        case RPG_TWEEN_TYPE_PARALLEL:
+        {
+            done = RPG_TRUE;
+            for (RPGint i = 0; i < tween->count; i++)
+            {
+                if (tween->children[i]->finished)
+                {
+                    continue;
+                }
+                if (RPG_Tween_Step(tween->children[i]))
+                {
+                    RPG_Tween_Notify(tween->children[i]);
+                }
+                else
+                {
+                    done = RPG_FALSE;
+                }
+            }
+            break;
+        }
+    }
+    if (!done || !RPG_Tween_Complete(tween))
+    {
+        return RPG_FALSE;
+    }
+    tween->finished = RPG_TRUE;
+    return RPG_TRUE;
+}
+
+/**
+ * @brief Removes a tween from the list of running tweens.
+ *
+ * @param index The index of the tween within the list.
+ */
+static void RPG_Tween_RemoveAt(RPGint index)
+{
+    RPGgame *game                      = RPG_GAME;
+    game->tweens.items[index]->running = RPG_FALSE;
+    game->tweens.items[index]          = game->tweens.items[--game->tweens.count];
+}
+
+void RPG_Tween_UpdateAll(RPGgame *game)
+{
+    // Iterate backwards so completed tweens can be removed in place
+    RPGtween *tween;
+    for (RPGint i = game->tweens.count - 1; i >= 0; i--)
+    {
+        tween = game->tweens.items[i];
+        if (RPG_Tween_Step(tween))
+        {
+            // Removed before notifying, as the callback is free to restart or free the tween
+            RPG_Tween_RemoveAt(i);
+            RPG_Tween_Notify(tween);
+        }
+    }
+}
+
+void RPG_Tween_Detach(RPGbasic *target)
+{
+    // Tweens on a freed object are not removed, so that groups and callbacks continue on schedule. Every allocated tween is
+    // searched, as idle and stopped tweens may still be started later.
+    for (RPGtween *tween = RPG_GAME->tweens.first; tween != NULL; tween = tween->next)
+    {
+        if (tween->target == target)
+        {
+            tween->target = NULL;
+        }
+    }
+}
+
+/****************************************************************************************
+ * Tween
+ ****************************************************************************************/
+
+static RPGtween *RPG_Tween_Alloc(RPG_TWEEN_TYPE type)
+{
+    RPG_ALLOC_ZERO(tween, RPGtween);
+    tween->type = type;
+    if (type == RPG_TWEEN_TYPE_SEQUENCE || type == RPG_TWEEN_TYPE_PARALLEL)
+    {
+        tween->capacity = RPG_TWEEN_INIT_CAPACITY;
+        tween->children = RPG_ALLOC_N(RPGtween *, RPG_TWEEN_INIT_CAPACITY);
+    }
+    RPGgame *game = RPG_GAME;
+    tween->next   = game->tweens.first;
+    if (tween->next != NULL)
+    {
+        tween->next->prev = tween;
+    }
+    game->tweens.first = tween;
+    return tween;
+}
+
+RPG_RESULT RPG_Tween_Create(RPGbasic *target, RPG_TWEEN_PROPERTY property, RPGfloat *values, RPGint duration, RPG_EASING easing,
+                            RPGtween **tween)
+{
+    RPG_RETURN_IF_NULL(target);
+    RPG_RETURN_IF_NULL(values);
+    RPG_RETURN_IF_NULL(tween);
+    RPGint components = RPG_Tween_Components(property);
+    if (components == 0)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    RPGtween *t = RPG_Tween_Alloc(RPG_TWEEN_TYPE_PROPERTY);
+    t->target   = target;
+    t->property = property;
+    t->easing   = easing;
+    t->duration = imax(duration, 1);
+    memcpy(t->to, values, sizeof(RPGfloat) * components);
+    *tween = t;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_CreateDelay(RPGint duration, RPGtween **tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    RPGtween *t = RPG_Tween_Alloc(RPG_TWEEN_TYPE_DELAY);
+    t->duration = imax(duration, 1);
+    *tween      = t;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_CreateSequence(RPGtween **tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    *tween = RPG_Tween_Alloc(RPG_TWEEN_TYPE_SEQUENCE);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_CreateParallel(RPGtween **tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    *tween = RPG_Tween_Alloc(RPG_TWEEN_TYPE_PARALLEL);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_Free(RPGtween *tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    RPG_Tween_Stop(tween);
+
+    // Groups own their children
+    for (RPGint i = 0; i < tween->count; i++)
+    {
+        tween->children[i]->parent = NULL;
+        RPG_Tween_Free(tween->children[i]);
+    }
+    if (tween->parent != NULL)
+    {
+        RPGtween *parent = tween->parent;
+        for (RPGint i = 0; i < parent->count; i++)
+        {
+            if (parent->children[i] == tween)
+            {
+                memmove(&parent->children[i], &parent->children[i + 1], sizeof(RPGtween *) * (parent->count - i - 1));
+                parent->count--;
+                break;
+            }
+        }
+    }
+    if (tween->prev != NULL)
+    {
+        tween->prev->next = tween->next;
+    }
+    else if (RPG_GAME != NULL)
+    {
+        RPG_GAME->tweens.first = tween->next;
+    }
+    if (tween->next != NULL)
+    {
+        tween->next->prev = tween->prev;
+    }
+    RPG_FREE(tween->children);
+    RPG_FREE(tween);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_Add(RPGtween *group, RPGtween *tween)
+{
+    RPG_RETURN_IF_NULL(group);
+    RPG_RETURN_IF_NULL(tween);
+    if (group->type != RPG_TWEEN_TYPE_SEQUENCE && group->type != RPG_TWEEN_TYPE_PARALLEL)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (tween->parent != NULL || tween->running || tween == group)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (group->count == group->capacity)
+    {
+        group->capacity *= 2;
+        group->children = RPG_REALLOC(group->children, sizeof(RPGtween *) * group->capacity);
+    }
+    group->children[group->count++] = tween;
+    tween->parent                    = group;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_SetFrom(RPGtween *tween, RPGfloat *values)
+{
+    RPG_RETURN_IF_NULL(tween);
+    if (tween->type != RPG_TWEEN_TYPE_PROPERTY)
+    {
+        return RPG_ERR_INVALID_VALUE;
+    }
+    if (values == NULL)
+    {
+        // Revert to reading the starting value when the tween begins
+        tween->explicitFrom = RPG_FALSE;
+    }
+    else
+    {
+        memcpy(tween->from, values, sizeof(RPGfloat) * RPG_Tween_Components(tween->property));
+        tween->explicitFrom = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_SetRepeat(RPGtween *tween, RPGint count, RPGbool yoyo)
+{
+    RPG_RETURN_IF_NULL(tween);
+    tween->repeat = imax(count, -1);
+    tween->yoyo   = yoyo;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_SetCallback(RPGtween *tween, RPGtweenfunc func, void *user)
+{
+    RPG_RETURN_IF_NULL(tween);
+    tween->callback = func;
+    tween->user     = user;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_Start(RPGtween *tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    if (tween->parent != NULL)
+    {
+        // Children are advanced by their group
+        return RPG_ERR_INVALID_VALUE;
+    }
+    RPG_Tween_Reset(tween, RPG_TRUE);
+    if (tween->running)
+    {
+        return RPG_NO_ERROR;
+    }
+
+    RPGgame *game = RPG_GAME;
+    if (game->tweens.count == game->tweens.capacity)
+    {
+        game->tweens.capacity = imax(RPG_TWEEN_INIT_CAPACITY, game->tweens.capacity * 2);
+        game->tweens.items    = RPG_REALLOC(game->tweens.items, sizeof(RPGtween *) * game->tweens.capacity);
+    }
+    game->tweens.items[game->tweens.count++] = tween;
+    tween->running                           = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_Stop(RPGtween *tween)
+{
+    RPG_RETURN_IF_NULL(tween);
+    if (!tween->running)
+    {
+        return RPG_NO_ERROR;
+    }
+    for (RPGint i = 0; i < RPG_GAME->tweens.count; i++)
+    {
+        if (RPG_GAME->tweens.items[i] == tween)
+        {
+            RPG_Tween_RemoveAt(i);
+            break;
+        }
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_IsRunning(RPGtween *tween, RPGbool *running)
+{
+    RPG_RETURN_IF_NULL(tween);
+    if (running != NULL)
+    {
+        *running = tween->running;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Tween_StopAll(RPGbasic *target)
+{
+    RPG_RETURN_IF_NULL(target);
+    for (RPGint i = RPG_GAME->tweens.count - 1; i >= 0; i--)
+    {
+        RPGtween *tween = RPG_GAME->tweens.items[i];
+        if (tween->type == RPG_TWEEN_TYPE_PROPERTY && tween->target == target)
+        {
+            RPG_Tween_RemoveAt(i);
+        }
+    }
+    return RPG_NO_ERROR;
+}
@@ -12,7 +12,7 @@ static void RPG_Viewport_Render(void *viewport)
 
     // Bind the viewport's FBO as the current render target
     glBindFramebuffer(GL_FRAMEBUFFER, v->fbo);
-    glUniformMatrix4fv(RPG_GAME->shader.projection, 1, GL_FALSE, (GLfloat *) &v->projection);
+    RPG_Drawing_SetProjection(&v->projection);
     RPG_VIEWPORT(0, 0, v->width, v->height);
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -24,40 +24,41 @@ static void RPG_Viewport_Render(void *viewport)
         r = v->batch.items[i];
         r->render(r);
     }
+    // Apply any post-processing to the rendered contents
+    RPGrendertarget *post = RPG_PostFX_Apply(&v->postfx, v->texture, v->width, v->height);
+
     // Unbind the viewport's FBO, changing the render target back to the screen
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RPG_BIND_TARGET();
     RPG_RESET_VIEWPORT();
     RPG_RESET_BACK_COLOR();
 
     // Update Model (if required)
     if (v->base.updated)
     {
-        GLfloat sx = v->base.scale.x * v->width;
-        GLfloat sy = v->base.scale.y * v->height;
-
-        GLfloat cos = cosf(v->base.rotation.radians);
-        GLfloat sin = sinf(v->base.rotation.radians);
-        RPG_MAT4_SET(v->base.model, sx * cos, sx * sin, 0.0f, 0.0f, sy * -sin, sy * cos, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f,
-                     (v->base.rotation.ox * (1.0f - cos) + v->base.rotation.oy * sin) + v->base.x,
-                     (v->base.rotation.oy * (1.0f - cos) - v->base.rotation.ox * sin) + v->base.y, 0.0f, 1.0f);
+        RPG_BasicSprite_UpdateModel(&v->base, v->base.x, v->base.y, v->width, v->height, 0, 0);
         v->base.updated = RPG_FALSE;
     }
 
-    // Set shader uniforms, restore projection, and render the viewport to the screen
-    RPG_BASE_UNIFORMS(v->base);
+    // Restore projection, set shader uniforms, and render the viewport to the screen
     RPG_RESET_PROJECTION();
-    RPG_RENDER_TEXTURE(v->texture, v->vao);
+    RPG_BasicSprite_BindUniforms(&v->base);
+    RPG_RENDER_TEXTURE(post ? post->texture : v->texture, v->vao);
+    RPG_PostFX_Release(post);
 }
 
-RPG_RESULT RPG_Viewport_Create(RPGint x, RPGint y, RPGint width, RPGint height, RPGviewport **viewport)
+/**
+ * @brief Initializes the fields and GPU resources of a viewport, used by the viewport itself and types derived from it.
+ *
+ * @param v The viewport to initialize.
+ * @param x The location of the viewport on the x-axis.
+ * @param y The location of the viewport on the y-axis.
+ * @param width The width of the viewport's render target.
+ * @param height The height of the viewport's render target.
+ * @param renderfunc The function used to render the viewport.
+ */
+void RPG_Viewport_Init(RPGviewport *v, RPGint x, RPGint y, RPGint width, RPGint height, RPGrenderfunc renderfunc)
 {
-    // Obligatory argument checking
-    RPG_RETURN_IF_NULL(viewport);
-    RPG_CHECK_DIMENSIONS(width, height);
-
-    // Allocate a new viewport object, and initialize fields
-    RPG_ALLOC_ZERO(v, RPGviewport);
-    RPG_BasicSprite_Init(&v->base, RPG_Viewport_Render, &RPG_GAME->batch);
+    RPG_BasicSprite_Init(&v->base, renderfunc, &RPG_GAME->batch);
     RPG_Batch_Init(&v->batch);
 
     // Set dimensions
@@ -67,33 +68,47 @@ RPG_RESULT RPG_Viewport_Create(RPGint x, RPGint y, RPGint width, RPGint height,
     v->height = height;
 
     // Create a static VBO/VAO
-    glGenVertexArrays(1, &v->vao);
-    glGenBuffers(1, &v->vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, v->vbo);
     RPGfloat vertices[VERTICES_COUNT] = {0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
                                          0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f};
-    glBufferData(GL_ARRAY_BUFFER, VERTICES_SIZE, vertices, GL_STATIC_DRAW);
-    glBindVertexArray(v->vao);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, VERTICES_STRIDE, NULL);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
-    // Framebuffer
-    glGenFramebuffers(1, &v->fbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, v->fbo);
-
-    // Texture
-    glGenTextures(1, &v->texture);
-    RPG_Drawing_BindTexture(v->texture, GL_TEXTURE0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    v->vbo = RPG_Drawing_CreateBuffer(VERTICES_SIZE, vertices, RPG_FALSE);
+    v->vao = RPG_Drawing_CreateVertexArray(v->vbo);
 
-    // Bind texture to FBO and creat a projection matrix for this viewport
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, v->texture, 0);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    // Create the texture, attach it to an FBO, and create a projection matrix for this viewport
+    v->texture = RPG_Drawing_CreateTexture(width, height, GL_RGBA8, GL_RGBA, NULL, GL_CLAMP_TO_EDGE, GL_NEAREST);
+    v->fbo     = RPG_Drawing_CreateFramebuffer(v->texture);
     RPG_MAT4_ORTHO(v->projection, 0.0f, width, height, 0.0f, -1.0f, 1.0f);
+}
+
+/**
+ * @brief Releases the resources of a viewport without freeing the structure itself.
+ *
+ * @param viewport The viewport to destroy.
+ */
+void RPG_Viewport_Destroy(RPGviewport *viewport)
+{
+    RPG_BasicSprite_Detach(&viewport->base);
+    RPG_Renderable_Free(&viewport->base.renderable);
+    // Free batch
+    RPG_Batch_Free(&viewport->batch);
+    RPG_PostFX_ClearChain(&viewport->postfx);
+    // Delete VAO/VBO
+    glDeleteVertexArrays(1, &viewport->vao);
+    glDeleteBuffers(1, &viewport->vbo);
+    // Delete texture and FBO
+    glDeleteFramebuffers(1, &viewport->fbo);
+    RPG_Drawing_DeleteTexture(viewport->texture);
+}
+
+RPG_RESULT RPG_Viewport_Create(RPGint x, RPGint y, RPGint width, RPGint height, RPGviewport **viewport)
+{
+    // Obligatory argument checking
+    RPG_RETURN_IF_NULL(viewport);
+    RPG_CHECK_DIMENSIONS(width, height);
+
+    // Allocate a new viewport object, and initialize fields
+    RPG_ALLOC_ZERO(v, RPGviewport);
+    RPG_Viewport_Init(v, x, y, width, height, RPG_Viewport_Render);
+    v->base.renderable.pick = RPG_PICK_VIEWPORT;
 
     *viewport = v;
     return RPG_NO_ERROR;
@@ -179,15 +194,7 @@ RPG_RESULT RPG_Viewport_SetOrigin(RPGviewport *viewport, RPGint x, RPGint y)
 RPG_RESULT RPG_Viewport_Free(RPGviewport *viewport)
 {
     RPG_RETURN_IF_NULL(viewport);
-    RPG_Renderable_Free(&viewport->base.renderable);
-    // Free batch
-    RPG_Batch_Free(&viewport->batch);
-    // Delete VAO/VBO
-    glDeleteVertexArrays(1, &viewport->vao);
-    glDeleteBuffers(1, &viewport->vbo);
-    // Delete texture and FBO
-    glDeleteFramebuffers(1, &viewport->fbo);
-    glDeleteTextures(1, &viewport->texture);
+    RPG_Viewport_Destroy(viewport);
     // Free pointer
     RPG_FREE(viewport);
     return RPG_NO_ERROR;
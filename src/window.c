@@ -0,0 +1,508 @@
+#include "internal.h"
+
+// The number of floats in a single quad
+#define RPG_WINDOW_QUAD_SIZE VERTICES_COUNT
+
+/****************************************************************************************
+ * Geometry
+ ****************************************************************************************/
+
+/**
+ * @brief Writes a quad to the vertex array.
+ *
+ * @param v The position in the vertex array to write to.
+ * @param x The location of the quad on the x-axis, relative to the window.
+ * @param y The location of the quad on the y-axis, relative to the window.
+ * @param w The width of the quad.
+ * @param h The height of the quad.
+ * @param src The source rectangle, in pixels.
+ * @param image The image the source rectangle is within.
+ * @return RPGfloat* The position in the vertex array following the quad.
+ */
+static RPGfloat *RPG_Window_PushQuad(RPGfloat *v, RPGfloat x, RPGfloat y, RPGfloat w, RPGfloat h, RPGrect *src, RPGimage *image)
+{
+    GLfloat l = (GLfloat) src->x / image->width;
+    GLfloat t = (GLfloat) src->y / image->height;
+    GLfloat r = l + ((GLfloat) src->w / image->width);
+    GLfloat b = t + ((GLfloat) src->h / image->height);
+    GLfloat quad[RPG_WINDOW_QUAD_SIZE] = {x, y + h, l, b, x + w, y,     r, t, x,     y, l, t,
+                                          x, y + h, l, b, x + w, y + h, r, b, x + w, y, r, t};
+    memcpy(v, quad, sizeof(quad));
+    return v + RPG_WINDOW_QUAD_SIZE;
+}
+
+/**
+ * @brief Writes a rectangle split into nine slices, with fixed-size corners and stretched edges.
+ *
+ * @param v The position in the vertex array to write to.
+ * @param x The location of the rectangle on the x-axis, relative to the window.
+ * @param y The location of the rectangle on the y-axis, relative to the window.
+ * @param w The width of the rectangle.
+ * @param h The height of the rectangle.
+ * @param src The source rectangle, in pixels.
+ * @param border The size of the corners and edges within the source rectangle.
+ * @param center Flag indicating if the center slice is included.
+ * @param image The image the source rectangle is within.
+ * @param count Incremented by the number of quads written.
+ * @return RPGfloat* The position in the vertex array following the slices.
+ */
+static RPGfloat *RPG_Window_PushSlices(RPGfloat *v, RPGint x, RPGint y, RPGint w, RPGint h, RPGrect *src, RPGint border, RPGbool center,
+                                       RPGimage *image, RPGint *count)
+{
+    // Corners shrink when the rectangle is too small to fit them, such as while the window is opening
+    RPGint bx    = imin(border, w / 2);
+    RPGint by    = imin(border, h / 2);
+    RPGint dx[4] = {x, x + bx, x + w - bx, x + w};
+    RPGint dy[4] = {y, y + by, y + h - by, y + h};
+    RPGint sx[4] = {src->x, src->x + bx, src->x + src->w - bx, src->x + src->w};
+    RPGint sy[4] = {src->y, src->y + by, src->y + src->h - by, src->y + src->h};
+    RPGrect slice;
+    for (int row = 0; row < 3; row++)
+    {
+        for (int col = 0; col < 3; col++)
+        {
+            if ((row == 1 && col == 1 && !center) || dx[col + 1] <= dx[col] || dy[row + 1] <= dy[row])
+            {
+                continue;
+            }
+            slice = (RPGrect){sx[col], sy[row], sx[col + 1] - sx[col], sy[row + 1] - sy[row]};
+            v     = RPG_Window_PushQuad(v, dx[col], dy[row], dx[col + 1] - dx[col], dy[row + 1] - dy[row], &slice, image);
+            (*count)++;
+        }
+    }
+    return v;
+}
+
+/**
+ * @brief Rebuilds the cached geometry of the window, only performed when its size, skin, or contents change.
+ *
+ * @param w The window.
+ */
+static void RPG_Window_Build(RPGwindow *w)
+{
+    RPGint height  = (RPGint)(w->height * w->openness.value);
+    RPGint top     = (w->height - height) / 2;
+    RPGint margin  = w->layout.margin;
+    RPGrect *back  = &w->layout.background;
+    RPGint columns = 1, rows = 1;
+    if (w->tiled && back->w > 0 && back->h > 0)
+    {
+        columns = (w->width - margin * 2 + back->w - 1) / back->w;
+        rows    = (height - margin * 2 + back->h - 1) / back->h;
+    }
+
+    // Background, frame, cursor, and contents
+    RPGint required = imax(columns, 0) * imax(rows, 0) + 8 + 9 + 1;
+    if (required > w->capacity)
+    {
+        w->capacity = required;
+        w->vertices = RPG_REALLOC(w->vertices, sizeof(RPGfloat) * RPG_WINDOW_QUAD_SIZE * required);
+        glDeleteBuffers(1, &w->vbo);
+        glDeleteVertexArrays(1, &w->vao);
+        w->vbo = RPG_Drawing_CreateBuffer(sizeof(RPGfloat) * RPG_WINDOW_QUAD_SIZE * required, NULL, RPG_TRUE);
+        w->vao = RPG_Drawing_CreateVertexArray(w->vbo);
+    }
+
+    RPGfloat *v  = w->vertices;
+    w->quadCount = 0;
+    if (w->skin != NULL && height > 0)
+    {
+        RPGint bw = w->width - margin * 2, bh = height - margin * 2;
+        if (!w->tiled)
+        {
+            if (bw > 0 && bh > 0)
+            {
+                v = RPG_Window_PushQuad(v, margin, top + margin, bw, bh, back, w->skin);
+                w->quadCount++;
+            }
+        }
+        else if (back->w > 0 && back->h > 0)
+        {
+            // Tiles along the right and bottom edges are cropped rather than scaled
+            RPGrect src;
+            for (RPGint ty = 0; ty < bh; ty += back->h)
+            {
+                for (RPGint tx = 0; tx < bw; tx += back->w)
+                {
+                    src = (RPGrect){back->x, back->y, imin(back->w, bw - tx), imin(back->h, bh - ty)};
+                    v   = RPG_Window_PushQuad(v, margin + tx, top + margin + ty, src.w, src.h, &src, w->skin);
+                    w->quadCount++;
+                }
+            }
+        }
+        v = RPG_Window_PushSlices(v, 0, top, w->width, height, &w->layout.frame, w->layout.frameBorder, RPG_FALSE, w->skin,
+                                  &w->quadCount);
+
+        // The cursor is only shown once fully open, and is clipped by nothing but the window itself
+        if (w->openness.value >= 1.0f && w->cursor.w > 0 && w->cursor.h > 0)
+        {
+            v = RPG_Window_PushSlices(v, w->padding + w->cursor.x - w->ox, w->padding + w->cursor.y - w->oy, w->cursor.w, w->cursor.h,
+                                      &w->layout.cursor, w->layout.cursorBorder, RPG_TRUE, w->skin, &w->quadCount);
+        }
+    }
+    if (w->contents != NULL)
+    {
+        // Only the visible region of the contents is drawn, so scrolling is just a change of texture coordinates
+        RPGint cw   = imin(w->width - w->padding * 2, w->contents->width - w->ox);
+        RPGint ch   = imin(w->height - w->padding * 2, w->contents->height - w->oy);
+        RPGrect src = {w->ox, w->oy, imax(cw, 0), imax(ch, 0)};
+        v           = RPG_Window_PushQuad(v, w->padding, w->padding, src.w, src.h, &src, w->contents);
+    }
+    RPG_Drawing_BufferSubData(w->vbo, 0, (GLsizeiptr)((v - w->vertices) * sizeof(RPGfloat)), w->vertices);
+    w->updateVAO = RPG_FALSE;
+}
+
+/****************************************************************************************
+ * Rendering
+ ****************************************************************************************/
+
+static void RPG_Window_Render(void *window)
+{
+    RPGwindow *w = window;
+    if (!w->base.renderable.visible || w->base.alpha < __FLT_EPSILON__ || w->openness.value <= 0.0f)
+    {
+        return;
+    }
+    if (w->updateVAO)
+    {
+        RPG_Window_Build(w);
+    }
+    if (w->base.updated)
+    {
+        RPGint ox = 0, oy = 0;
+        if (w->viewport != NULL)
+        {
+            ox = w->viewport->base.ox;
+            oy = w->viewport->base.oy;
+        }
+        RPG_BasicSprite_UpdateModel(&w->base, w->base.x, w->base.y, 1.0f, 1.0f, ox, oy);
+        w->base.updated = RPG_FALSE;
+    }
+
+    // The frame, background, and cursor are all drawn from the skin in a single call, followed by the contents
+    RPG_BasicSprite_BindUniforms(&w->base);
+    glBindVertexArray(w->vao);
+    if (w->quadCount > 0)
+    {
+        RPG_Drawing_BindTexture(w->skin->texture, GL_TEXTURE0);
+        glDrawArrays(GL_TRIANGLES, 0, w->quadCount * 6);
+    }
+    if (w->contents != NULL && w->openness.value >= 1.0f)
+    {
+        RPG_Drawing_BindTexture(w->contents->texture, GL_TEXTURE0);
+        glDrawArrays(GL_TRIANGLES, w->quadCount * 6, 6);
+    }
+}
+
+/****************************************************************************************
+ * Openness
+ ****************************************************************************************/
+
+/**
+ * @brief Starts animating the openness of a window towards fully open or closed.
+ *
+ * @param w The window.
+ * @param speed The change in openness per update, negative when closing.
+ */
+static void RPG_Window_Animate(RPGwindow *w, RPGfloat speed)
+{
+    w->openness.speed = speed;
+    if (!w->openness.active)
+    {
+        RPG_Batch_Add(&RPG_GAME->windows, &w->base.renderable);
+        w->openness.active = RPG_TRUE;
+    }
+}
+
+void RPG_Window_UpdateAll(RPGgame *game)
+{
+    RPGbatch *list = &game->windows;
+    RPGwindow *w;
+    for (int i = list->total - 1; i >= 0; i--)
+    {
+        w                 = (RPGwindow *) list->items[i];
+        w->openness.value = RPG_CLAMPF(w->openness.value + w->openness.speed, 0.0f, 1.0f);
+        w->updateVAO      = RPG_TRUE;
+        if (w->openness.value <= 0.0f || w->openness.value >= 1.0f)
+        {
+            w->openness.active = RPG_FALSE;
+            list->items[i]     = list->items[--list->total];
+        }
+    }
+}
+
+/****************************************************************************************
+ * Window
+ ****************************************************************************************/
+
+RPG_RESULT RPG_Window_Create(RPGviewport *viewport, RPGint x, RPGint y, RPGint width, RPGint height, RPGwindow **window)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (width < 1 || height < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_ALLOC_ZERO(w, RPGwindow);
+    RPGbatch *batch = viewport ? &viewport->batch : &RPG_GAME->batch;
+    RPG_BasicSprite_Init(&w->base, RPG_Window_Render, batch);
+    w->base.renderable.pick = RPG_PICK_WINDOW;
+    w->base.x               = x;
+    w->base.y               = y;
+    w->viewport             = viewport;
+    w->width                = width;
+    w->height               = height;
+    w->padding              = 12;
+    w->openness.value       = 1.0f;
+    w->updateVAO            = RPG_TRUE;
+
+    // Default to the common 128x128 window skin layout
+    w->layout.background   = (RPGrect){0, 0, 64, 64};
+    w->layout.frame        = (RPGrect){64, 0, 64, 64};
+    w->layout.cursor       = (RPGrect){64, 64, 32, 32};
+    w->layout.frameBorder  = 16;
+    w->layout.cursorBorder = 4;
+    w->layout.margin       = 2;
+
+    *window = w;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_Free(RPGwindow *window)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (window->openness.active)
+    {
+        RPG_Batch_DeleteItem(&RPG_GAME->windows, &window->base.renderable);
+    }
+    RPG_BasicSprite_Detach(&window->base);
+    RPG_Renderable_Free(&window->base.renderable);
+    glDeleteVertexArrays(1, &window->vao);
+    glDeleteBuffers(1, &window->vbo);
+    RPG_FREE(window->vertices);
+    RPG_FREE(window);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetViewport(RPGwindow *window, RPGviewport **viewport)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (viewport != NULL)
+    {
+        *viewport = window->viewport;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetSkin(RPGwindow *window, RPGimage **skin)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (skin != NULL)
+    {
+        *skin = window->skin;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetSkin(RPGwindow *window, RPGimage *skin)
+{
+    RPG_RETURN_IF_NULL(window);
+    window->skin      = skin;
+    window->updateVAO = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetSkinLayout(RPGwindow *window, RPGrect *background, RPGrect *frame, RPGint frameBorder, RPGrect *cursor,
+                                    RPGint cursorBorder)
+{
+    RPG_RETURN_IF_NULL(window);
+    RPG_RETURN_IF_NULL(background);
+    RPG_RETURN_IF_NULL(frame);
+    RPG_RETURN_IF_NULL(cursor);
+    if (frameBorder < 0 || cursorBorder < 0 || background->w <= 0 || background->h <= 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    window->layout.background   = *background;
+    window->layout.frame        = *frame;
+    window->layout.cursor       = *cursor;
+    window->layout.frameBorder  = frameBorder;
+    window->layout.cursorBorder = cursorBorder;
+    window->updateVAO           = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetTiled(RPGwindow *window, RPGbool *tiled)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (tiled != NULL)
+    {
+        *tiled = window->tiled;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetTiled(RPGwindow *window, RPGbool tiled)
+{
+    RPG_RETURN_IF_NULL(window);
+    window->tiled     = tiled;
+    window->updateVAO = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetContents(RPGwindow *window, RPGimage **contents)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (contents != NULL)
+    {
+        *contents = window->contents;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetContents(RPGwindow *window, RPGimage *contents)
+{
+    RPG_RETURN_IF_NULL(window);
+    window->contents  = contents;
+    window->updateVAO = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetSize(RPGwindow *window, RPGint *width, RPGint *height)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (width != NULL)
+    {
+        *width = window->width;
+    }
+    if (height != NULL)
+    {
+        *height = window->height;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetSize(RPGwindow *window, RPGint width, RPGint height)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (width < 1 || height < 1)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (window->width != width || window->height != height)
+    {
+        window->width     = width;
+        window->height    = height;
+        window->updateVAO = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetPadding(RPGwindow *window, RPGint *padding)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (padding != NULL)
+    {
+        *padding = window->padding;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetPadding(RPGwindow *window, RPGint padding)
+{
+    RPG_RETURN_IF_NULL(window);
+    window->padding   = imax(padding, 0);
+    window->updateVAO = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetContentsOrigin(RPGwindow *window, RPGint *x, RPGint *y)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (x != NULL)
+    {
+        *x = window->ox;
+    }
+    if (y != NULL)
+    {
+        *y = window->oy;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetContentsOrigin(RPGwindow *window, RPGint x, RPGint y)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (window->ox != x || window->oy != y)
+    {
+        window->ox        = imax(x, 0);
+        window->oy        = imax(y, 0);
+        window->updateVAO = RPG_TRUE;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetCursorRect(RPGwindow *window, RPGrect *rect)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (rect != NULL)
+    {
+        *rect = window->cursor;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetCursorRect(RPGwindow *window, RPGrect *rect)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (rect == NULL)
+    {
+        window->cursor = (RPGrect){0, 0, 0, 0};
+    }
+    else
+    {
+        window->cursor = *rect;
+    }
+    window->updateVAO = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_GetOpenness(RPGwindow *window, RPGfloat *openness)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (openness != NULL)
+    {
+        *openness = window->openness.value;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_SetOpenness(RPGwindow *window, RPGfloat openness)
+{
+    RPG_RETURN_IF_NULL(window);
+    window->openness.value = RPG_CLAMPF(openness, 0.0f, 1.0f);
+    window->openness.speed = 0.0f;
+    window->updateVAO      = RPG_TRUE;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_Open(RPGwindow *window, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (duration < 1)
+    {
+        return RPG_Window_SetOpenness(window, 1.0f);
+    }
+    RPG_Window_Animate(window, 1.0f / duration);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_Window_Close(RPGwindow *window, RPGint duration)
+{
+    RPG_RETURN_IF_NULL(window);
+    if (duration < 1)
+    {
+        return RPG_Window_SetOpenness(window, 0.0f);
+    }
+    RPG_Window_Animate(window, -1.0f / duration);
+    return RPG_NO_ERROR;
+}
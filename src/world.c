@@ -0,0 +1,513 @@
+#include "internal.h"
+
+#define RPG_WORLD_INIT_CAPACITY 16
+
+/****************************************************************************************
+ * Shapes
+ ****************************************************************************************/
+
+/**
+ * @brief Retrieves a shape that is in use by its identifier.
+ *
+ * @param world The world the shape belongs to.
+ * @param id The identifier of the shape.
+ * @return The shape, or NULL if the identifier is out of range or the slot is unused.
+ */
+static inline RPGshape *RPG_World_GetShape(RPGworld *world, RPGint id)
+{
+    if (id < 0 || id >= world->count || world->shapes[id].object == NULL)
+    {
+        return NULL;
+    }
+    return &world->shapes[id];
+}
+
+/**
+ * @brief Reserves a slot for a new shape, reusing one that was previously removed when available.
+ *
+ * @param world The world to add the shape to.
+ * @param object The object the shape follows.
+ * @param type The geometry of the shape.
+ * @param layer The layers the shape belongs to.
+ * @param mask The layers the shape collides with.
+ * @return The identifier of the new shape.
+ */
+static RPGint RPG_World_NewShape(RPGworld *world, RPGbasic *object, RPG_SHAPE_TYPE type, RPGuint layer, RPGuint mask)
+{
+    RPGint id;
+    if (world->unused >= 0)
+    {
+        id            = world->unused;
+        world->unused = world->shapes[id].next;
+    }
+    else
+    {
+        if (world->count == world->capacity)
+        {
+            world->capacity = imax(RPG_WORLD_INIT_CAPACITY, world->capacity * 2);
+            world->shapes   = RPG_REALLOC(world->shapes, sizeof(RPGshape) * world->capacity);
+            world->order    = RPG_REALLOC(world->order, sizeof(RPGint) * world->capacity);
+        }
+        id = world->count++;
+    }
+    RPGshape *shape = &world->shapes[id];
+    memset(shape, 0, sizeof(RPGshape));
+    shape->object = object;
+    shape->type   = type;
+    shape->layer  = layer;
+    shape->mask   = mask;
+    shape->next   = -1;
+
+    // New shapes are appended, and sorted into place on the next step
+    world->order[world->orderCount++] = id;
+    return id;
+}
+
+/**
+ * @brief Releases the slot of a shape and removes any reference to it from the sort order and contacts.
+ *
+ * @param world The world the shape belongs to.
+ * @param id The identifier of the shape.
+ */
+static void RPG_World_DeleteShape(RPGworld *world, RPGint id)
+{
+    world->shapes[id].object = NULL;
+    world->shapes[id].next   = world->unused;
+    world->unused            = id;
+
+    for (RPGint i = 0; i < world->orderCount; i++)
+    {
+        if (world->order[i] == id)
+        {
+            memmove(&world->order[i], &world->order[i + 1], sizeof(RPGint) * (world->orderCount - i - 1));
+            world->orderCount--;
+            break;
+        }
+    }
+    RPGint n = 0;
+    for (RPGint i = 0; i < world->contactCount; i++)
+    {
+        if (world->contacts[i].a != id && world->contacts[i].b != id)
+        {
+            world->contacts[n++] = world->contacts[i];
+        }
+    }
+    world->contactCount = n;
+}
+
+/**
+ * @brief Computes the bounding box of a shape from the current location of its object in world space.
+ *
+ * The location of a child object is moved by the transforms of its parents, but the shape itself is neither rotated nor scaled.
+ *
+ * @param shape The shape to update.
+ */
+static inline void RPG_World_UpdateBounds(RPGshape *shape)
+{
+    RPGfloat wx, wy;
+    RPG_BasicSprite_ToWorld(shape->object, (RPGfloat) shape->object->x, (RPGfloat) shape->object->y, &wx, &wy);
+    shape->worldX = (RPGint) floorf(wx + 0.5f);
+    shape->worldY = (RPGint) floorf(wy + 0.5f);
+    RPGint x      = shape->worldX + shape->x;
+    RPGint y      = shape->worldY + shape->y;
+    if (shape->type == RPG_SHAPE_CIRCLE)
+    {
+        shape->bounds = (RPGrect){x - shape->w, y - shape->w, shape->w * 2, shape->w * 2};
+    }
+    else
+    {
+        shape->bounds = (RPGrect){x, y, shape->w, shape->h};
+    }
+}
+
+/****************************************************************************************
+ * Narrow Phase
+ ****************************************************************************************/
+
+/**
+ * @brief Tests whether a pixel is covered by a shape, including the alpha mask of its sprite when the shape is precise.
+ *
+ * @param shape The shape to test.
+ * @param x The location of the pixel on the x-axis.
+ * @param y The location of the pixel on the y-axis.
+ * @return RPG_TRUE if the pixel is covered, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_World_Covers(RPGshape *shape, RPGint x, RPGint y)
+{
+    if (shape->type == RPG_SHAPE_CIRCLE)
+    {
+        // Sampled at the center of the pixel
+        RPGfloat dx = (x + 0.5f) - (shape->bounds.x + shape->w);
+        RPGfloat dy = (y + 0.5f) - (shape->bounds.y + shape->w);
+        if (dx * dx + dy * dy >= (RPGfloat)(shape->w * shape->w))
+        {
+            return RPG_FALSE;
+        }
+    }
+    if (shape->precise && shape->object->renderable.pick == RPG_PICK_SPRITE)
+    {
+        RPGsprite *sprite = (RPGsprite *) shape->object;
+        if (sprite->image != NULL)
+        {
+            // Scale and rotation are not applied, the image is tested as it lies at the sprite's location
+            RPGint u = x - (shape->worldX + sprite->base.ox);
+            RPGint v = y - (shape->worldY + sprite->base.oy);
+            if (u < 0 || v < 0 || u >= sprite->rect.w || v >= sprite->rect.h)
+            {
+                return RPG_FALSE;
+            }
+            return RPG_Image_HitTest(sprite->image, sprite->rect.x + u, sprite->rect.y + v);
+        }
+    }
+    return RPG_TRUE;
+}
+
+/**
+ * @brief Tests whether two shapes with overlapping bounds actually intersect.
+ *
+ * @param a The first shape.
+ * @param b The second shape.
+ * @return RPG_TRUE if the shapes intersect, otherwise RPG_FALSE.
+ */
+static RPGbool RPG_World_Intersects(RPGshape *a, RPGshape *b)
+{
+    if (a->precise || b->precise)
+    {
+        // Only the pixels within both bounding boxes can be covered by both shapes
+        RPGint left   = imax(a->bounds.x, b->bounds.x);
+        RPGint top    = imax(a->bounds.y, b->bounds.y);
+        RPGint right  = imin(a->bounds.x + a->bounds.w, b->bounds.x + b->bounds.w);
+        RPGint bottom = imin(a->bounds.y + a->bounds.h, b->bounds.y + b->bounds.h);
+        for (RPGint y = top; y < bottom; y++)
+        {
+            for (RPGint x = left; x < right; x++)
+            {
+                if (RPG_World_Covers(a, x, y) && RPG_World_Covers(b, x, y))
+                {
+                    return RPG_TRUE;
+                }
+            }
+        }
+        return RPG_FALSE;
+    }
+    if (a->type == RPG_SHAPE_BOX && b->type == RPG_SHAPE_BOX)
+    {
+        // Bounds are already known to overlap
+        return RPG_TRUE;
+    }
+    if (a->type == RPG_SHAPE_CIRCLE && b->type == RPG_SHAPE_CIRCLE)
+    {
+        RPGint dx = (a->bounds.x + a->w) - (b->bounds.x + b->w);
+        RPGint dy = (a->bounds.y + a->w) - (b->bounds.y + b->w);
+        RPGint r  = a->w + b->w;
+        return dx * dx + dy * dy < r * r;
+    }
+    RPGshape *circle = a->type == RPG_SHAPE_CIRCLE ? a : b;
+    RPGshape *box    = a->type == RPG_SHAPE_CIRCLE ? b : a;
+    RPGint cx        = circle->bounds.x + circle->w;
+    RPGint cy        = circle->bounds.y + circle->w;
+    RPGint dx        = cx - imax(box->bounds.x, imin(cx, box->bounds.x + box->bounds.w));
+    RPGint dy        = cy - imax(box->bounds.y, imin(cy, box->bounds.y + box->bounds.h));
+    return dx * dx + dy * dy < circle->w * circle->w;
+}
+
+/****************************************************************************************
+ * Broad Phase
+ ****************************************************************************************/
+
+/**
+ * @brief Appends a pair of shapes to the contact list.
+ *
+ * @param world The world to add the contact to.
+ * @param a The identifier of the first shape.
+ * @param b The identifier of the second shape.
+ */
+static void RPG_World_AddContact(RPGworld *world, RPGint a, RPGint b)
+{
+    if (world->contactCount == world->contactCapacity)
+    {
+        world->contactCapacity = imax(RPG_WORLD_INIT_CAPACITY, world->contactCapacity * 2);
+        world->contacts        = RPG_REALLOC(world->contacts, sizeof(RPGcontact) * world->contactCapacity);
+    }
+    world->contacts[world->contactCount++] = (RPGcontact){imin(a, b), imax(a, b)};
+}
+
+/**
+ * @brief Sorts the shapes of a world by the left edge of their bounds.
+ *
+ * @param world The world to sort.
+ */
+static void RPG_World_Sort(RPGworld *world)
+{
+    // The order persists between steps, and objects move little from one update to the next, so it is nearly sorted
+    // already and an insertion sort is close to linear.
+    RPGint *order = world->order;
+    RPGint id, key, j;
+    for (RPGint i = 1; i < world->orderCount; i++)
+    {
+        id  = order[i];
+        key = world->shapes[id].bounds.x;
+        for (j = i - 1; j >= 0 && world->shapes[order[j]].bounds.x > key; j--)
+        {
+            order[j + 1] = order[j];
+        }
+        order[j + 1] = id;
+    }
+}
+
+/**
+ * @brief Finds every pair of intersecting shapes in a world, replacing the previous contacts.
+ *
+ * @param world The world to step.
+ */
+static void RPG_World_Sweep(RPGworld *world)
+{
+    for (RPGint i = 0; i < world->orderCount; i++)
+    {
+        RPG_World_UpdateBounds(&world->shapes[world->order[i]]);
+    }
+    RPG_World_Sort(world);
+
+    world->contactCount = 0;
+    RPGshape *a, *b;
+    RPGint right;
+    for (RPGint i = 0; i < world->orderCount; i++)
+    {
+        a     = &world->shapes[world->order[i]];
+        right = a->bounds.x + a->bounds.w;
+        // Every shape after the first that starts past the right edge cannot overlap on the x-axis
+        for (RPGint j = i + 1; j < world->orderCount; j++)
+        {
+            b = &world->shapes[world->order[j]];
+            if (b->bounds.x >= right)
+            {
+                break;
+            }
+            if (a->object == b->object || !(a->layer & b->mask) || !(b->layer & a->mask))
+            {
+                continue;
+            }
+            if (b->bounds.y >= a->bounds.y + a->bounds.h || a->bounds.y >= b->bounds.y + b->bounds.h)
+            {
+                continue;
+            }
+            if (RPG_World_Intersects(a, b))
+            {
+                RPG_World_AddContact(world, world->order[i], world->order[j]);
+            }
+        }
+    }
+}
+
+void RPG_World_UpdateAll(RPGgame *game)
+{
+    for (RPGint i = 0; i < game->worlds.count; i++)
+    {
+        RPG_World_Sweep(game->worlds.items[i]);
+    }
+}
+
+void RPG_World_Detach(RPGbasic *object)
+{
+    RPGworld *world;
+    for (RPGint i = 0; i < RPG_GAME->worlds.count; i++)
+    {
+        world = RPG_GAME->worlds.items[i];
+        for (RPGint id = 0; id < world->count; id++)
+        {
+            if (world->shapes[id].object == object)
+            {
+                RPG_World_DeleteShape(world, id);
+            }
+        }
+    }
+}
+
+/****************************************************************************************
+ * World
+ ****************************************************************************************/
+
+RPG_RESULT RPG_World_Create(RPGworld **world)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPG_ALLOC_ZERO(w, RPGworld);
+    w->unused = -1;
+
+    RPGgame *game = RPG_GAME;
+    if (game->worlds.count == game->worlds.capacity)
+    {
+        game->worlds.capacity = imax(4, game->worlds.capacity * 2);
+        game->worlds.items    = RPG_REALLOC(game->worlds.items, sizeof(RPGworld *) * game->worlds.capacity);
+    }
+    game->worlds.items[game->worlds.count++] = w;
+    *world                                   = w;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_Free(RPGworld *world)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGgame *game = RPG_GAME;
+    for (RPGint i = 0; i < game->worlds.count; i++)
+    {
+        if (game->worlds.items[i] == world)
+        {
+            game->worlds.items[i] = game->worlds.items[--game->worlds.count];
+            break;
+        }
+    }
+    RPG_FREE(world->shapes);
+    RPG_FREE(world->order);
+    RPG_FREE(world->contacts);
+    RPG_FREE(world);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_AddBox(RPGworld *world, RPGbasic *object, RPGrect *box, RPGuint layer, RPGuint mask, RPGint *shape)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPG_RETURN_IF_NULL(object);
+    RPG_RETURN_IF_NULL(box);
+    if (box->w <= 0 || box->h <= 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGint id   = RPG_World_NewShape(world, object, RPG_SHAPE_BOX, layer, mask);
+    RPGshape *s = &world->shapes[id];
+    s->x        = box->x;
+    s->y        = box->y;
+    s->w        = box->w;
+    s->h        = box->h;
+    if (shape != NULL)
+    {
+        *shape = id;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_AddCircle(RPGworld *world, RPGbasic *object, RPGint x, RPGint y, RPGint radius, RPGuint layer, RPGuint mask,
+                               RPGint *shape)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPG_RETURN_IF_NULL(object);
+    if (radius <= 0)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPGint id   = RPG_World_NewShape(world, object, RPG_SHAPE_CIRCLE, layer, mask);
+    RPGshape *s = &world->shapes[id];
+    s->x        = x;
+    s->y        = y;
+    s->w        = radius;
+    if (shape != NULL)
+    {
+        *shape = id;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_RemoveShape(RPGworld *world, RPGint shape)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (RPG_World_GetShape(world, shape) == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    RPG_World_DeleteShape(world, shape);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_GetShapeObject(RPGworld *world, RPGint shape, RPGbasic **object)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGshape *s = RPG_World_GetShape(world, shape);
+    if (s == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (object != NULL)
+    {
+        *object = s->object;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_GetShapeLayers(RPGworld *world, RPGint shape, RPGuint *layer, RPGuint *mask)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGshape *s = RPG_World_GetShape(world, shape);
+    if (s == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (layer != NULL)
+    {
+        *layer = s->layer;
+    }
+    if (mask != NULL)
+    {
+        *mask = s->mask;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_SetShapeLayers(RPGworld *world, RPGint shape, RPGuint layer, RPGuint mask)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGshape *s = RPG_World_GetShape(world, shape);
+    if (s == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    s->layer = layer;
+    s->mask  = mask;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_GetShapePrecise(RPGworld *world, RPGint shape, RPGbool *precise)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGshape *s = RPG_World_GetShape(world, shape);
+    if (s == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    if (precise != NULL)
+    {
+        *precise = s->precise;
+    }
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_SetShapePrecise(RPGworld *world, RPGint shape, RPGbool precise)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPGshape *s = RPG_World_GetShape(world, shape);
+    if (s == NULL)
+    {
+        return RPG_ERR_OUT_OF_RANGE;
+    }
+    s->precise = precise;
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_Step(RPGworld *world)
+{
+    RPG_RETURN_IF_NULL(world);
+    RPG_World_Sweep(world);
+    return RPG_NO_ERROR;
+}
+
+RPG_RESULT RPG_World_GetContacts(RPGworld *world, const RPGcontact **contacts, RPGint *count)
+{
+    RPG_RETURN_IF_NULL(world);
+    if (contacts != NULL)
+    {
+        *contacts = world->contacts;
+    }
+    if (count != NULL)
+    {
+        *count = world->contactCount;
+    }
+    return RPG_NO_ERROR;
+}